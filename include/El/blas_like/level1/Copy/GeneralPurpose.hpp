@@ -89,7 +89,8 @@ void Helper
     // ====================
     const Int totalSend = remoteEntries.size();
     mpi::Comm comm;
-    vector<int> sendCounts, owners(totalSend);
+    vector<Int> sendCounts;
+    vector<int> owners(totalSend);
     if( includeViewers )
     {
         comm = g.ViewingComm();
@@ -131,7 +132,7 @@ void Helper
 
     // Pack the data
     // =============
-    vector<int> sendOffs;
+    vector<Int> sendOffs;
     Scan( sendCounts, sendOffs );
     vector<Entry<S>> sendBuf;
     FastResize( sendBuf, totalSend );
@@ -143,13 +144,15 @@ void Helper
 
     // Exchange and unpack the data
     // ============================
-    auto recvBuf = mpi::AllToAll( sendBuf, sendCounts, sendOffs, comm );
+    // A process's share of a redistribution may exceed the range of an int
+    auto recvBuf = mpi::LargeAllToAll( sendBuf, sendCounts, sendOffs, comm );
     if( B.Participating() )
     {
         Int recvBufSize = recvBuf.size();
         mpi::Broadcast( recvBufSize, 0, B.RedundantComm() );
         FastResize( recvBuf, recvBufSize );
-        mpi::Broadcast( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
+        mpi::LargeBroadcast
+        ( recvBuf.data(), recvBufSize, 0, B.RedundantComm() );
         for( Int k=0; k<recvBufSize; ++k )
         {
             const auto& entry = recvBuf[k];
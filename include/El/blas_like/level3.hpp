@@ -17,6 +17,47 @@ template<typename T> Int LocalTrrkBlocksize();
 template<typename T> void SetLocalTrr2kBlocksize( Int blocksize );
 template<typename T> Int LocalTrr2kBlocksize();
 
+// Batched
+// =======
+// Each column of a batch stores one member, packed in column-major order
+// (e.g., each member of an m x k batch of A occupies m*k entries of a
+// column), so that many small problems can be solved with a single call.
+// Members are processed in groups which are interleaved so that the
+// innermost loops vectorize across the group, and the groups are divided
+// among the OpenMP threads. The distributed variants redistribute each batch
+// into a [STAR,VR] distribution, so that every member is owned by a single
+// process, and then call the sequential variants on the local members.
+
+// C_j := alpha op(A_j) op(B_j) + beta C_j for each member j, where op(A_j)
+// is m x k and op(B_j) is k x n
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C );
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const AbstractDistMatrix<T>& A,
+           const AbstractDistMatrix<T>& B,
+  T beta,        AbstractDistMatrix<T>& C );
+
+// B_j := alpha op(A_j)^{-1} B_j (or alpha B_j op(A_j)^{-1}) for each member
+// j, where B_j is m x n and A_j is triangular
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, F alpha, const Matrix<F>& A, Matrix<F>& B );
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, F alpha, const AbstractDistMatrix<F>& A,
+                               AbstractDistMatrix<F>& B );
+
 // Gemm
 // ====
 namespace GemmAlgorithmNS {
@@ -26,11 +67,24 @@ enum GemmAlgorithm {
   GEMM_SUMMA_B,
   GEMM_SUMMA_C,
   GEMM_SUMMA_DOT,
-  GEMM_CANNON
+  GEMM_CANNON,
+  GEMM_SUMMA_25D,
+  GEMM_SUMMA_C_PIPELINED
 };
 }
 using namespace GemmAlgorithmNS;
 
+// The number of layers used by GEMM_SUMMA_25D (zero, the default, selects the
+// largest number of layers which reduces communication within the budget)
+void SetGemm25DNumLayers( Int numLayers );
+Int Gemm25DNumLayers();
+
+// The number of bytes per process which GEMM_SUMMA_25D may devote to its
+// layers (zero, the default, selects a quarter of the physical memory of each
+// node divided evenly among the processes on the node)
+void SetGemm25DMemoryBudget( double bytes );
+double Gemm25DMemoryBudget();
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -173,6 +227,23 @@ void Multiply
   const DistMultiVec<T>& X,
   T beta,
         DistMultiVec<T>& Y );
+
+// Multiply using an (explicitly maintained) SELL-C-sigma copy of a sparse
+// matrix, which is typically faster on machines with wide SIMD units
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SELLMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                Matrix<T>& Y );
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha,
+  const DistSparseMatrix<T>& A,
+  const DistSELLMatrix<T>& ASELL,
+  const DistMultiVec<T>& X,
+  T beta,
+        DistMultiVec<T>& Y );
 template<typename T>
 void Multiply
 ( Orientation orientation,
@@ -182,6 +253,89 @@ void Multiply
   T beta,
         AbstractDistMatrix<T>& Y );
 
+// Sparse-sparse multiplication
+// ----------------------------
+// C := A B is split into a symbolic phase, which only depends upon the
+// sparsity patterns of A and B (and determines both the rows of B which must
+// be fetched and the sparsity pattern of C), and a numeric phase. The plan
+// from the symbolic phase may be reused for any pair of matrices with the
+// same sparsity patterns, e.g., for forming A D A^T within each iteration of
+// an Interior Point Method.
+struct DistSparseMultiplyPlan
+{
+    bool ready;
+    Int height, width;
+    // Whether the pattern of C includes the (structural) main diagonal and
+    // whether it is restricted to the lower triangle
+    bool diagonal, onlyLower;
+    // For verifying that the sparsity patterns are unchanged
+    Int numLocalEntriesA, numLocalEntriesB;
+
+    // The local rows of B which are sent to the other processes, ordered by
+    // their destination, and the number of entries sent to and received
+    // from each process
+    vector<Int> sendRows;
+    vector<Int> sendSizes, sendOffs, recvSizes, recvOffs;
+    vector<int> sendNeighbors, recvNeighbors;
+
+    // For each local entry of A, the index of the fetched row of B which it
+    // multiplies, and the sparsity pattern of the fetched rows
+    vector<Int> fetchInds;
+    vector<Int> fetchedOffsets, fetchedCols;
+
+    // The sparsity pattern of the local rows of C, whose column indices all
+    // lie within [firstCol,firstCol+numCols)
+    vector<Int> offsets, cols;
+    Int firstCol, numCols;
+
+    DistSparseMultiplyPlan()
+    : ready(false), height(0), width(0), diagonal(false), onlyLower(false),
+      numLocalEntriesA(0), numLocalEntriesB(0), firstCol(0), numCols(0)
+    { }
+
+    void Clear()
+    {
+        ready = false;
+        height = width = 0;
+        diagonal = onlyLower = false;
+        numLocalEntriesA = numLocalEntriesB = 0;
+        SwapClear( sendRows );
+        SwapClear( sendSizes );
+        SwapClear( sendOffs );
+        SwapClear( recvSizes );
+        SwapClear( recvOffs );
+        SwapClear( sendNeighbors );
+        SwapClear( recvNeighbors );
+        SwapClear( fetchInds );
+        SwapClear( fetchedOffsets );
+        SwapClear( fetchedCols );
+        SwapClear( offsets );
+        SwapClear( cols );
+        firstCol = numCols = 0;
+    }
+};
+
+// If 'diagonal' is true, the main diagonal is inserted into the pattern of
+// C (e.g., so that it may later be shifted without changing the pattern),
+// and, if 'onlyLower' is true, only the lower triangle of C is formed
+void MultiplySymbolic
+( const DistGraph& A, const DistGraph& B, DistSparseMultiplyPlan& plan,
+  bool diagonal=false, bool onlyLower=false );
+
+// C is only restructured if its sparsity pattern differs from the plan
+template<typename T>
+void MultiplyNumeric
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+  const DistSparseMultiplyPlan& plan,
+        DistSparseMatrix<T>& C );
+
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C );
+
 // MultiShiftQuasiTrsm
 // ===================
 template<typename F>
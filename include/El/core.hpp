@@ -246,6 +246,7 @@ class DistMatrix;
 #include <El/core/Grid.hpp>
 #include <El/core/DistMatrix.hpp>
 #include <El/core/Proxy.hpp>
+#include <El/core/Workspace.hpp>
 
 // Implement the intertwined parts of the library
 #include <El/core/Element/impl.hpp>
@@ -266,5 +267,6 @@ class DistMatrix;
 #include <El/core/DistMap.hpp>
 #include <El/core/DistMultiVec/impl.hpp>
 #include <El/core/DistSparseMatrix/impl.hpp>
+#include <El/core/SELLMatrix.hpp>
 
 #endif // ifndef EL_CORE_HPP
@@ -22,7 +22,13 @@ struct DistGraphMultMeta
     Int numRecvInds;
     vector<int> sendSizes, sendOffs,
                 recvSizes, recvOffs;
+    // The processes which we send a nonzero number of indices to (or
+    // receive a nonzero number of indices from)
+    vector<int> sendNeighbors, recvNeighbors;
     vector<Int> sendInds, colOffs;
+    // The local sources whose targets are all (or are not all) local, so
+    // that their contributions can be computed during the communication
+    vector<Int> interiorRows, boundaryRows;
 
     DistGraphMultMeta() : ready(false), numRecvInds(0) { }
 
@@ -34,8 +40,12 @@ struct DistGraphMultMeta
         SwapClear( recvSizes );
         SwapClear( sendOffs );
         SwapClear( recvOffs );
+        SwapClear( sendNeighbors );
+        SwapClear( recvNeighbors );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( interiorRows );
+        SwapClear( boundaryRows );
     }
 
     const DistGraphMultMeta& operator=( const DistGraphMultMeta& meta )
@@ -46,8 +56,12 @@ struct DistGraphMultMeta
         sendOffs = meta.sendOffs;
         recvSizes = meta.recvSizes;
         recvOffs = meta.recvOffs;
+        sendNeighbors = meta.sendNeighbors;
+        recvNeighbors = meta.recvNeighbors;
         sendInds = meta.sendInds;
         colOffs = meta.colOffs;
+        interiorRows = meta.interiorRows;
+        boundaryRows = meta.boundaryRows;
         return *this;
     }
 };
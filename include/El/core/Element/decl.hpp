@@ -159,6 +159,16 @@ template<typename Real> struct PromoteHelper<Complex<Real>>
 
 template<typename F> using Promote = typename PromoteHelper<F>::type;
 
+// Decrease the precision (if possible)
+// ------------------------------------
+template<typename F> struct DemoteHelper { typedef F type; };
+template<> struct DemoteHelper<double> { typedef float type; };
+
+template<typename Real> struct DemoteHelper<Complex<Real>>
+{ typedef Complex<typename DemoteHelper<Real>::type> type; };
+
+template<typename F> using Demote = typename DemoteHelper<F>::type;
+
 template<typename S,typename T>
 struct CanCast
 {   
@@ -86,6 +86,16 @@ public:
 
     static int FindFactor( int p ) EL_NO_EXCEPT;
 
+    // The division of the owning processes into numLayers layers of
+    // consecutive owning ranks (e.g., for 2.5D algorithms), each of which is
+    // viewed by all of the viewers of this grid. The layers are formed (a
+    // collective operation over the viewers) upon first use and then kept
+    // until this grid is destroyed.
+    const Grid& Layer( int numLayers, int layer ) const;
+    // The processes occupying the same position within each layer
+    // (mpi::COMM_NULL for processes which do not own this grid)
+    mpi::Comm LayerDepthComm( int numLayers ) const;
+
     // To be used internally by Elemental
     static void InitializeDefault();
     static void FinalizeDefault(); 
@@ -118,7 +128,16 @@ private:
         mdRank_, mdPerpRank_,
         vcRank_, vrRank_;
 
+    struct Layering
+    {
+        int numLayers;
+        vector<unique_ptr<Grid>> layers;
+        mpi::Comm depthComm;
+    };
+    mutable vector<Layering> layerings_;
+
     void SetUpGrid();
+    const Layering& FormLayering( int numLayers ) const;
 
     // Disable copying this class due to MPI_Comm/MPI_Group ownership issues
     // and potential performance loss from duplicating MPI communicators, e.g.,
@@ -205,6 +205,7 @@ private:
     template<typename S> friend class AbstractDistMatrix;
     template<typename S> friend class ElementalMatrix;
     template<typename S> friend class BlockMatrix;
+    template<typename S> friend class WorkspaceLoan;
 };
 
 } // namespace El
@@ -11,6 +11,69 @@
 
 namespace El {
 
+// The strategy used by Memory<G> for acquiring and releasing buffers
+enum MemoryPolicy
+{
+  // Unaligned allocations which are immediately returned to the system
+  MEMORY_STANDARD,
+  // Allocations aligned to GetMemoryAlignment() bytes
+  MEMORY_ALIGNED,
+  // Aligned allocations whose released blocks are cached in size-class free
+  // lists so that they may be recycled by subsequent requests
+  MEMORY_POOLED
+};
+
+// The policy, alignment, and pool limit may be modified at any point, 
+// including before El::Initialize, and only affect subsequent allocations.
+// Each buffer remembers how it was allocated so that it is always returned
+// in a consistent manner.
+void SetMemoryPolicy( MemoryPolicy policy );
+MemoryPolicy GetMemoryPolicy();
+
+// The alignment must be a power of two; choosing the page size (or the 
+// huge-page size on Linux) is supported
+void SetMemoryAlignment( size_t alignment );
+size_t GetMemoryAlignment();
+
+// The maximum number of bytes that the pool may hold in its free lists
+void SetMemoryPoolLimit( size_t numBytes );
+size_t GetMemoryPoolLimit();
+
+// Return all of the cached blocks to the system
+void EmptyMemoryPool();
+
+struct MemoryPoolStatistics
+{
+    // Every allocation request, whether or not it was served by the pool
+    size_t numRequests=0;
+    // Requests served by a cached block
+    size_t numHits=0;
+    // Requests which required a fresh system allocation
+    size_t numMisses=0;
+    // Blocks returned to the system since the pool limit was reached
+    size_t numEvictions=0;
+
+    size_t cachedBytes=0;
+    size_t peakCachedBytes=0;
+    size_t liveBytes=0;
+    size_t peakLiveBytes=0;
+
+    double HitRate() const EL_NO_EXCEPT
+    { return numRequests==0 ? 0. : double(numHits)/double(numRequests); }
+};
+
+MemoryPoolStatistics GetMemoryPoolStatistics();
+void ResetMemoryPoolStatistics();
+void PrintMemoryPoolStatistics( ostream& os=cout );
+
+namespace memory {
+
+// Byte-level interface to the allocator backing Memory<G>
+void* AllocateBytes( size_t numBytes );
+void FreeBytes( void* ptr ) EL_NO_EXCEPT;
+
+} // namespace memory
+
 template<typename G>
 class Memory
 {
@@ -11,16 +11,32 @@ namespace El {
 
 namespace {
 
+// Non-trivial datatypes (e.g., BigFloat) are constructed and destructed 
+// in-place within the raw buffer returned by the allocator.
+
 template<typename G>
 static G* New( size_t size )
 {
-    return new G[size];
+    G* ptr = static_cast<G*>( memory::AllocateBytes( size*sizeof(G) ) );
+    if( !std::is_trivially_default_constructible<G>::value )
+    {
+        for( size_t i=0; i<size; ++i )
+            new(&ptr[i]) G;
+    }
+    return ptr;
 }
 
 template<typename G>
-static void Delete( G*& ptr )
+static void Delete( G*& ptr, size_t size )
 {
-    delete[] ptr;
+    if( ptr == nullptr )
+        return;
+    if( !std::is_trivially_destructible<G>::value )
+    {
+        for( size_t i=0; i<size; ++i )
+            ptr[i].~G();
+    }
+    memory::FreeBytes( ptr );
     ptr = nullptr;
 }
 
@@ -38,7 +54,7 @@ Memory<G>::Memory( size_t size )
 
 template<typename G>
 Memory<G>::Memory( Memory<G>&& mem )
-: size_(mem.size_), rawBuffer_(nullptr), buffer_(nullptr)
+: size_(0), rawBuffer_(nullptr), buffer_(nullptr)
 { ShallowSwap(mem); }
 
 template<typename G>
@@ -56,7 +72,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 template<typename G>
 Memory<G>::~Memory() 
 { 
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
 }
 
 template<typename G>
@@ -70,13 +86,15 @@ G* Memory<G>::Require( size_t size )
 {
     if( size > size_ )
     {
-        Delete( rawBuffer_ );
+        Delete( rawBuffer_, size_ );
+        buffer_ = nullptr;
+        size_ = 0;
 
 #ifndef EL_RELEASE
         try {
 #endif
 
-            // TODO: Optionally overallocate to force alignment of buffer_
+            // The alignment of buffer_ is handled by the allocator
             rawBuffer_ = New<G>( size );
             buffer_ = rawBuffer_;
 
@@ -110,7 +128,7 @@ void Memory<G>::Release()
 template<typename G>
 void Memory<G>::Empty()
 {
-    Delete( rawBuffer_ );
+    Delete( rawBuffer_, size_ );
     buffer_ = nullptr;
     size_ = 0;
 }
@@ -0,0 +1,111 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_CORE_SELLMATRIX_HPP
+#define EL_CORE_SELLMATRIX_HPP
+
+namespace El {
+
+// The SELL-C-sigma storage format
+// ===============================
+// An optional, vectorization-friendly copy of a sparse matrix which can be
+// passed to Multiply in place of (or alongside) the CSR data of a
+// SparseMatrix or DistSparseMatrix. Within windows of 'sortScope' (sigma)
+// rows, the rows are sorted by decreasing numbers of nonzeros and then
+// grouped into chunks of 'chunkSize' (C) rows. Each chunk is stored
+// column-major and is padded to the length of its longest row, so that
+// the rows of a chunk can be processed in SIMD lanes.
+//
+// The copy is not kept in sync with the original matrix: after changing
+// the values (but not the sparsity pattern), call UpdateValues; after
+// changing the sparsity pattern, rebuild the copy.
+
+const Int SELL_MAX_CHUNK_SIZE = 32;
+
+template<typename T>
+class SELLMatrix
+{
+public:
+    SELLMatrix();
+    SELLMatrix( const SparseMatrix<T>& A, Int chunkSize=8, Int sortScope=256 );
+
+    void Empty();
+    void Build( const SparseMatrix<T>& A, Int chunkSize=8, Int sortScope=256 );
+    void UpdateValues( const SparseMatrix<T>& A );
+
+    // Build the SELL form of the subset of the rows of a CSR matrix, where
+    // nonzero e is stored in column inds[e]-shift. The rows of the result
+    // retain their original indices.
+    void Build
+    ( Int height, Int width,
+      const vector<Int>& rows,
+      const Int* rowOffsets,
+      const Int* inds, Int shift,
+      const T* values,
+      Int chunkSize, Int sortScope );
+    void UpdateValues( const T* values );
+
+    Int Height() const EL_NO_EXCEPT;
+    Int Width() const EL_NO_EXCEPT;
+    Int ChunkSize() const EL_NO_EXCEPT;
+    Int SortScope() const EL_NO_EXCEPT;
+    Int NumChunks() const EL_NO_EXCEPT;
+    // The number of entries of the original matrix and the number of
+    // stored entries (including the explicit zeros used for padding)
+    Int NumEntries() const EL_NO_EXCEPT;
+    Int NumStoredEntries() const EL_NO_EXCEPT;
+
+    // Row r of chunk c is the original row rowBuffer[c*chunkSize+r], or -1
+    // if it is padding, and has lengthBuffer[c*chunkSize+r] nonzeros. The
+    // stored entries of chunk c lie within [chunkOffsets[c],chunkOffsets[c+1])
+    // and entry k of row r lies at chunkOffsets[c]+k*chunkSize+r; entries
+    // beyond the length of their row are padding and must be skipped.
+    const Int* LockedRowBuffer() const EL_NO_EXCEPT;
+    const Int* LockedLengthBuffer() const EL_NO_EXCEPT;
+    const Int* LockedChunkOffsetBuffer() const EL_NO_EXCEPT;
+    const Int* LockedColBuffer() const EL_NO_EXCEPT;
+    const T* LockedValueBuffer() const EL_NO_EXCEPT;
+
+private:
+    Int height_=0, width_=0;
+    Int chunkSize_=8, sortScope_=256;
+    Int numEntries_=0;
+    vector<Int> rows_, lengths_, chunkOffsets_, cols_;
+    // The index into the original values for each stored entry (or -1)
+    vector<Int> sources_;
+    vector<T> vals_;
+};
+
+// The SELL-C-sigma form of the local portion of a DistSparseMatrix, which
+// is split into the rows which only involve local portions of the
+// multivectors (whose columns are local row indices of the multivectors)
+// and the remaining rows (whose columns index the exchanged rows). See
+// the interiorRows and boundaryRows of DistGraphMultMeta.
+template<typename T>
+class DistSELLMatrix
+{
+public:
+    DistSELLMatrix();
+    DistSELLMatrix
+    ( const DistSparseMatrix<T>& A, Int chunkSize=8, Int sortScope=256 );
+
+    void Empty();
+    void Build
+    ( const DistSparseMatrix<T>& A, Int chunkSize=8, Int sortScope=256 );
+    void UpdateValues( const DistSparseMatrix<T>& A );
+
+    const SELLMatrix<T>& Interior() const EL_NO_EXCEPT;
+    const SELLMatrix<T>& Boundary() const EL_NO_EXCEPT;
+
+private:
+    SELLMatrix<T> interior_, boundary_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_CORE_SELLMATRIX_HPP
@@ -0,0 +1,188 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_WORKSPACE_HPP
+#define EL_WORKSPACE_HPP
+
+namespace El {
+
+// A scoped arena of local buffers which the temporaries within level-3
+// kernels may borrow from and hand back to. While no WorkspaceScope is
+// active, borrowing is a no-op and temporaries allocate as usual.
+//
+// Typical usage is to wrap an outer loop which repeatedly calls kernels
+// with the same shapes, e.g.,
+//
+//   WorkspaceScope scope;
+//   for( Int it=0; it<maxIts; ++it )
+//       Gemm( NORMAL, NORMAL, F(1), A, B, F(0), C );
+//
+// after the first iteration, the SUMMA panels reuse the cached buffers.
+//
+// Each thread has its own arena (and statistics), so that the concurrent
+// tasks of, e.g., a task-parallel multifrontal traversal neither share
+// buffers nor race on the bookkeeping; a scope only affects the thread
+// which opened it.
+
+struct WorkspaceStatistics
+{
+    // Number of temporaries which were handed a cached buffer
+    size_t numBorrows=0;
+    // Number of buffers returned to the arena
+    size_t numReturns=0;
+    // Number of returned buffers discarded to respect the byte limit
+    size_t numEvictions=0;
+
+    // Bytes cached in the arena and bytes currently on loan
+    size_t cachedBytes=0;
+    size_t loanedBytes=0;
+    // The peak of cachedBytes+loanedBytes over the lifetime of the scope
+    size_t peakBytes=0;
+};
+
+class WorkspaceScope
+{
+public:
+    // Nested scopes share the arena of the outermost scope; the byte limit
+    // of an inner scope may only lower the current limit
+    WorkspaceScope( size_t maxBytes=size_t(1) << 30 );
+    ~WorkspaceScope();
+private:
+    size_t oldMaxBytes_;
+};
+
+bool WorkspaceActive();
+WorkspaceStatistics GetWorkspaceStatistics();
+void PrintWorkspaceStatistics( ostream& os=cout );
+
+namespace workspace {
+
+// Type-independent bookkeeping for the arena
+size_t MaxBytes();
+void RegisterClear( void (*clear)() );
+void RecordBorrow( size_t bytes );
+// Returns true if a buffer of the given size may be cached
+bool RecordReturn( size_t loanedBytes, size_t returnedBytes );
+void RecordRelease( size_t bytes );
+
+template<typename T>
+inline vector<Memory<T>>& Cache()
+{
+    static thread_local vector<Memory<T>> cache;
+    return cache;
+}
+
+template<typename T>
+inline void Clear()
+{
+    auto& cache = Cache<T>();
+    for( auto& memory : cache )
+        RecordRelease( memory.Size()*sizeof(T) );
+    SwapClear( cache );
+}
+
+} // namespace workspace
+
+// Hands cached buffers to the local matrices of (freshly constructed)
+// temporaries and returns them to the arena upon destruction. A loan must
+// be declared after the temporaries it manages so that it is destroyed
+// first.
+template<typename T>
+class WorkspaceLoan
+{
+public:
+    template<typename... MatrixTypes>
+    WorkspaceLoan( MatrixTypes&... matrices )
+    {
+        if( !WorkspaceActive() )
+            return;
+        Borrow( matrices... );
+    }
+
+    ~WorkspaceLoan()
+    {
+        if( !WorkspaceActive() )
+            return;
+        for( Int j=borrowers_.size()-1; j>=0; --j )
+            Return( *borrowers_[j], loanedSizes_[j] );
+    }
+
+    WorkspaceLoan( const WorkspaceLoan<T>& ) = delete;
+    WorkspaceLoan<T>& operator=( const WorkspaceLoan<T>& ) = delete;
+
+private:
+    vector<Matrix<T>*> borrowers_;
+    vector<size_t> loanedSizes_;
+
+    void Borrow() { }
+
+    template<typename... MatrixTypes>
+    void Borrow( AbstractDistMatrix<T>& A, MatrixTypes&... matrices )
+    {
+        Borrow( A.Matrix() );
+        Borrow( matrices... );
+    }
+
+    template<typename... MatrixTypes>
+    void Borrow( Matrix<T>& A, MatrixTypes&... matrices )
+    {
+        Lend( A );
+        Borrow( matrices... );
+    }
+
+    void Lend( Matrix<T>& A )
+    {
+        if( A.Viewing() || A.memory_.Size() != 0 )
+            return;
+        auto& cache = workspace::Cache<T>();
+        size_t loanedSize = 0;
+        if( !cache.empty() )
+        {
+            // Hand out the largest buffer so that the temporaries converge
+            // to buffers which are large enough after a single pass
+            Int largest = 0;
+            for( Int j=1; j<Int(cache.size()); ++j )
+                if( cache[j].Size() > cache[largest].Size() )
+                    largest = j;
+            A.memory_.ShallowSwap( cache[largest] );
+            std::swap( cache[largest], cache.back() );
+            cache.pop_back();
+            loanedSize = A.memory_.Size();
+            workspace::RecordBorrow( loanedSize*sizeof(T) );
+        }
+        borrowers_.push_back( &A );
+        loanedSizes_.push_back( loanedSize );
+    }
+
+    void Return( Matrix<T>& A, size_t loanedSize )
+    {
+        if( A.Viewing() )
+        {
+            workspace::RecordReturn( loanedSize*sizeof(T), 0 );
+            return;
+        }
+        const size_t returnedSize = A.memory_.Size();
+        const bool cache =
+          workspace::RecordReturn
+          ( loanedSize*sizeof(T), returnedSize*sizeof(T) );
+        if( cache )
+        {
+            auto& cacheList = workspace::Cache<T>();
+            if( cacheList.empty() )
+                workspace::RegisterClear( &workspace::Clear<T> );
+            cacheList.emplace_back();
+            cacheList.back().ShallowSwap( A.memory_ );
+            // The buffer is no longer ours to view
+            A.Empty_( false );
+        }
+    }
+};
+
+} // namespace El
+
+#endif // ifndef EL_WORKSPACE_HPP
@@ -81,6 +81,18 @@ void Axpy
   const dcomplex& alpha, 
   const dcomplex* x, BlasInt incx,
         dcomplex* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+void Axpy
+( BlasInt n,
+  const BigInt& alpha,
+  const BigInt* x, BlasInt incx,
+        BigInt* y, BlasInt incy );
+void Axpy
+( BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* x, BlasInt incx,
+        BigFloat* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Copy
@@ -114,6 +126,16 @@ double Dot
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+BigInt Dot
+( BlasInt n,
+  const BigInt* x, BlasInt incx,
+  const BigInt* y, BlasInt incy );
+BigFloat Dot
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy );
+#endif
 
 template<typename T>
 T Dotc
@@ -134,6 +156,16 @@ double Dotu
 ( BlasInt n,
   const double* x, BlasInt incx,
   const double* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+BigInt Dotu
+( BlasInt n,
+  const BigInt* x, BlasInt incx,
+  const BigInt* y, BlasInt incy );
+BigFloat Dotu
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy );
+#endif
 
 template<typename F>
 Base<F> Nrm2( BlasInt n, const F* x, BlasInt incx );
@@ -253,6 +285,22 @@ void Gemv
   const dcomplex* x, BlasInt incx,
   const dcomplex& beta,
         dcomplex* y, BlasInt incy );
+#ifdef EL_HAVE_MPC
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* x, BlasInt incx,
+  const BigInt& beta,
+        BigInt* y, BlasInt incy );
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat& beta,
+        BigFloat* y, BlasInt incy );
+#endif
 
 template<typename T>
 void Ger
@@ -563,6 +611,12 @@ void Trsv
 ( char uplo, char trans, char diag, BlasInt m,
   const dcomplex* A, BlasInt ALDim,
         dcomplex* x, BlasInt incx );
+#ifdef EL_HAVE_MPC
+void Trsv
+( char uplo, char trans, char diag, BlasInt m,
+  const BigFloat* A, BlasInt ALDim,
+        BigFloat* x, BlasInt incx );
+#endif
 
 // Level 3 BLAS
 // ============
@@ -603,6 +657,22 @@ void Gemm
   const dcomplex* B, BlasInt BLDim,
   const dcomplex& beta,
         dcomplex* C, BlasInt CLDim );
+#ifdef EL_HAVE_MPC
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* B, BlasInt BLDim,
+  const BigInt& beta,
+        BigInt* C, BlasInt CLDim );
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* B, BlasInt BLDim,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim );
+#endif
 
 template<typename T>
 void Hemm
@@ -20,6 +20,7 @@ namespace mpi {
 #if defined(EL_HAVE_MPI3_NONBLOCKING_COLLECTIVES) || \
     defined(EL_HAVE_MPIX_NONBLOCKING_COLLECTIVES)
 #define EL_HAVE_NONBLOCKING 1
+#define EL_HAVE_NONBLOCKING_COLLECTIVES
 #else
 #define EL_HAVE_NONBLOCKING 0
 #endif
@@ -90,6 +91,8 @@ struct Request
     MPI_Request backend;
 
     vector<byte> buffer;
+    // Serialized send data which must outlive a non-blocking collective
+    vector<byte> sendBuffer;
     bool receivingPacked=false;
     int recvCount;
     T* unpackedRecvBuf;
@@ -205,6 +208,9 @@ void Create
 ( Comm parentComm, Group subsetGroup, Comm& subsetComm ) EL_NO_RELEASE_EXCEPT;
 void Dup( Comm original, Comm& duplicate ) EL_NO_RELEASE_EXCEPT;
 void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT;
+// The processes of comm which share memory with the calling process (only the
+// calling process itself before MPI-3)
+void SplitShared( Comm comm, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT;
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT;
 bool Congruent( Comm comm1, Comm comm2 ) EL_NO_RELEASE_EXCEPT;
 void ErrorHandlerSet
@@ -637,6 +643,22 @@ void AllGather
 ( const T* sbuf, int sc,
         T* rbuf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllGather
+// ----------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // AllGather with variable recv sizes
 // ----------------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -730,6 +752,42 @@ vector<T> AllToAll
   const vector<int>& sendDispls,
   Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllToAll
+// ---------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request );
+
+// Non-blocking AllToAll with non-uniform send/recv sizes
+// ------------------------------------------------------
+// NOTE: The count and displacement arrays must remain valid until the
+//       request has completed
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request );
+
 // Reduce
 // ------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -889,6 +947,44 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void AllReduce( T* buf, int count, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking AllReduce
+// ----------------------
+// NOTE: User-defined reduction functions (see SetUserReduceFunc) must not be
+//       modified until the request has completed
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm,
+  Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request );
+
+// Single-buffer non-blocking AllReduce
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request );
+
 // ReduceScatter
 // -------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -947,6 +1043,25 @@ EL_NO_RELEASE_EXCEPT
 template<typename T>
 void ReduceScatter( T* buf, int rc, Comm comm ) EL_NO_RELEASE_EXCEPT;
 
+// Non-blocking ReduceScatter
+// --------------------------
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request );
+template<typename Real,typename=EnableIf<IsPacked<Real>>>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op,
+  Comm comm, Request<Complex<Real>>& request );
+template<typename T,typename=DisableIf<IsPacked<T>>,typename=void>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, Request<T>& request );
+
+// Default to SUM
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request );
+
 // Variable-length ReduceScatter
 // -----------------------------
 template<typename Real,typename=EnableIf<IsPacked<Real>>>
@@ -1072,6 +1187,45 @@ void VerifySendsAndRecvs
 ( const vector<int>& sendCounts,
   const vector<int>& recvCounts, Comm comm );
 
+// Large-count transfers
+// =====================
+// The following routines accept 64-bit (Int) counts and offsets and split
+// any message which would exceed MaxMessageCount() entries into a sequence
+// of messages which each fit within an int. They are collective in the
+// same manner as their standard counterparts and default to a single
+// message when all of the counts are small enough.
+
+// The default leaves room for complex data transmitted as pairs of reals
+Int MaxMessageCount();
+void SetMaxMessageCount( Int maxCount );
+
+template<typename T>
+void LargeBroadcast( T* buf, Int count, int root, Comm comm );
+
+template<typename T>
+void LargeSendRecv
+( const T* sbuf, Int sc, int to,
+        T* rbuf, Int rc, int from, Comm comm );
+
+// NOTE: Process q's contribution is stored starting at rbuf[q*rc]
+template<typename T>
+void LargeAllGather( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm );
+
+// NOTE: Agreeing upon the number of rounds requires an extra AllReduce;
+//       the following vector form, which must exchange the counts anyway,
+//       avoids it by piggybacking upon that exchange
+template<typename T>
+void LargeAllToAll
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm );
+
+template<typename T>
+vector<T> LargeAllToAll
+( const vector<T>& sendBuf,
+  const vector<Int>& sendCounts,
+  const vector<Int>& sendOffs,
+  Comm comm );
+
 void CreateCustom() EL_NO_RELEASE_EXCEPT;
 void DestroyCustom() EL_NO_RELEASE_EXCEPT;
 
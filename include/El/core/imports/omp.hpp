@@ -22,6 +22,35 @@
 # define EL_PARALLEL_FOR_COLLAPSE2
 #endif
 
+// Request vectorization of an inner loop (requires OpenMP 4.0)
+#if defined(EL_HYBRID) && defined(_OPENMP) && _OPENMP >= 201307
+# define EL_SIMD _Pragma("omp simd")
+#else
+# define EL_SIMD
+#endif
+
+// Task-based parallelism (requires OpenMP 3.0). Local variables referenced
+// within a task are captured by value, so pointers should be preferred over
+// references to large objects.
+#ifdef EL_HYBRID
+# define EL_PARALLEL_REGION _Pragma("omp parallel")
+# define EL_SINGLE _Pragma("omp single")
+# define EL_TASK _Pragma("omp task")
+# define EL_TASKWAIT _Pragma("omp taskwait")
+#else
+# define EL_PARALLEL_REGION
+# define EL_SINGLE
+# define EL_TASK
+# define EL_TASKWAIT
+#endif
+
+// Split a loop into tasks from within a task region (requires OpenMP 4.5)
+#if defined(EL_HYBRID) && defined(_OPENMP) && _OPENMP >= 201511
+# define EL_TASKLOOP _Pragma("omp taskloop")
+#else
+# define EL_TASKLOOP
+#endif
+
 #ifdef EL_AVOID_OMP_FMA
 # define EL_FMA_PARALLEL_FOR 
 #else
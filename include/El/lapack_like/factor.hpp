@@ -16,6 +16,41 @@
 
 namespace El {
 
+// Batched
+// =======
+// Factor each member of a batch stored as in BatchedGemm, i.e., with each
+// column holding one (packed, column-major) member. The distributed variants
+// redistribute the batch so that each member is owned by a single process.
+
+// Factor each m x n member with partial pivoting. Column j of p holds the
+// (0-based, LAPACK-style) sequence of row swaps applied to member j.
+template<typename F>
+void BatchedLU( Int m, Int n, Matrix<F>& A, Matrix<Int>& p );
+template<typename F>
+void BatchedLU
+( Int m, Int n, AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p );
+
+template<typename F>
+void BatchedCholesky( UpperOrLower uplo, Int n, Matrix<F>& A );
+template<typename F>
+void BatchedCholesky( UpperOrLower uplo, Int n, AbstractDistMatrix<F>& A );
+
+// Overwrite each m x n member with the same packed Householder representation
+// as QR, with column j of householderScalars and signature corresponding to
+// member j
+template<typename F>
+void BatchedQR
+( Int m, Int n,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature );
+template<typename F>
+void BatchedQR
+( Int m, Int n,
+  AbstractDistMatrix<F>& A,
+  AbstractDistMatrix<F>& householderScalars,
+  AbstractDistMatrix<Base<F>>& signature );
+
 // Cholesky
 // ========
 template<typename F>
@@ -167,12 +202,14 @@ template<typename F>
 void LDL
 ( const ldl::NodeInfo& info,
         ldl::Front<F>& L, 
-  LDLFrontType newType=LDL_2D );
+  LDLFrontType newType=LDL_2D,
+  const ldl::MultifrontalCtrl& ctrl=ldl::MultifrontalCtrl() );
 template<typename F>
 void LDL
 ( const ldl::DistNodeInfo& info,
         ldl::DistFront<F>& L, 
-  LDLFrontType newType=LDL_2D );
+  LDLFrontType newType=LDL_2D,
+  const ldl::MultifrontalCtrl& ctrl=ldl::MultifrontalCtrl() );
 
 namespace ldl {
 
@@ -233,24 +270,29 @@ void SolveAfter
 template<typename F>
 void SolveAfter
 ( const vector<Int>& invMap, const NodeInfo& info,
-  const Front<F>& front, Matrix<F>& X ); 
+  const Front<F>& front, Matrix<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() ); 
 template<typename F>
 void SolveAfter
 ( const DistMap& invMap, const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVec<F>& X ); 
+  const DistFront<F>& front, DistMultiVec<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() ); 
 
 template<typename F>
 void SolveAfter
 ( const NodeInfo& info,
-  const Front<F>& front, MatrixNode<F>& X );
+  const Front<F>& front, MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 template<typename F>
 void SolveAfter
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVecNode<F>& X );
+  const DistFront<F>& front, DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 template<typename F>
 void SolveAfter
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMatrixNode<F>& X );
+  const DistFront<F>& front, DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 
 template<typename F>
 Int SolveWithIterativeRefinement
@@ -454,6 +496,102 @@ Int SolveAfter
         ldl::DistMultiVecNodeMeta& meta,
   const RegSolveCtrl<Base<F>>& ctrl );
 
+// Mixed-precision variants which apply the inverse of a factorization stored
+// in a lower precision (e.g., single-precision fronts for a double-precision
+// system) while the residuals and the refinement stay in the precision of A
+// -----------------------------------------------------------------------------
+template<typename F>
+Int RegularizedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+        Base<F> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false );
+template<typename F>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+        Base<F> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false );
+
+template<typename F>
+Int RegularizedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+        Base<F> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false );
+template<typename F>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+        Base<F> relTolRefine,
+        Int maxRefineIts,
+        bool progress=false );
+
+template<typename F>
+Int SolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int SolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl );
+
+template<typename F>
+Int SolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl );
+template<typename F>
+Int SolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl );
+
 } // namespace reg_ldl
 
 // LU
@@ -468,7 +606,8 @@ enum LUPivotType
     LU_PARTIAL, 
     LU_FULL,
     LU_ROOK, /* not yet supported */
-    LU_WITHOUT_PIVOTING
+    LU_WITHOUT_PIVOTING,
+    LU_TOURNAMENT /* communication-avoiding (CALU) */
 };
 }
 using namespace LUPivotTypeNS;
@@ -489,6 +628,18 @@ void LU( Matrix<F>& A, Permutation& P );
 template<typename F>
 void LU( ElementalMatrix<F>& A, DistPermutation& P );
 
+// LU with either partial or tournament pivoting
+// ---------------------------------------------
+// Tournament pivoting (CALU) selects the pivots of each panel with a single
+// reduction tree rather than a reduction per column. The sequential version
+// is equivalent to partial pivoting.
+template<typename F>
+void LU( Matrix<F>& A, Permutation& P, LUPivotType pivotType );
+template<typename F>
+void LU( ElementalMatrix<F>& A, DistPermutation& P, LUPivotType pivotType );
+template<typename F>
+void LU( DistMatrix<F,VC,STAR>& A, DistPermutation& P, LUPivotType pivotType );
+
 // LU with full pivoting
 // ---------------------
 // P A Q^T = L U
@@ -671,6 +822,10 @@ struct QRCtrl
     // instead, as it is often the case that one may desire a custom pivoting
     // rule.
     bool smallestFirst=false;
+
+    // Factor each panel of a distributed matrix with TSQR over the process
+    // column (CAQR) rather than with one reduction per column
+    bool communicationAvoiding=false;
 };
 
 // Return an implicit representation of Q and R such that A = Q R
@@ -693,6 +848,21 @@ void QR
 ( DistMatrix<F,MC,MR,BLOCK>& A,
   DistMatrix<F,MR,STAR,BLOCK>& householderScalars );
 
+// Allow for the selection of communication-avoiding (CAQR) panel factorization
+// ---------------------------------------------------------------------------
+template<typename F>
+void QR
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl );
+template<typename F>
+void QR
+( ElementalMatrix<F>& A,
+  ElementalMatrix<F>& householderScalars, 
+  ElementalMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl );
+
 // Return an implicit representation of (Q,R,Omega) such that A Omega^T ~= Q R
 // ---------------------------------------------------------------------------
 template<typename F>
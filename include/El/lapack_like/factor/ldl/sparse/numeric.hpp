@@ -35,12 +35,14 @@ enum LDLFrontType
   LDL_INTRAPIV_1D,        LDL_INTRAPIV_2D,
   LDL_INTRAPIV_SELINV_1D, LDL_INTRAPIV_SELINV_2D,
   BLOCK_LDL_1D,           BLOCK_LDL_2D,
-  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D
+  BLOCK_LDL_INTRAPIV_1D,  BLOCK_LDL_INTRAPIV_2D,
+  BLR_LDL_1D,             BLR_LDL_2D
 };
 
 bool Unfactored( LDLFrontType type );
 bool FrontIs1D( LDLFrontType type );
 bool BlockFactorization( LDLFrontType type );
+bool BLRFactorization( LDLFrontType type );
 bool SelInvFactorization( LDLFrontType type );
 bool PivotedFactorization( LDLFrontType type );
 LDLFrontType ConvertTo2D( LDLFrontType type );
@@ -51,6 +53,71 @@ LDLFrontType InitialFactorType( LDLFrontType type );
 
 namespace ldl {
 
+// Controls for the block low-rank (BLR) compression of the sequential fronts
+// of a BLR_LDL_1D or BLR_LDL_2D factorization (distributed fronts, and the
+// sequential fronts which they duplicate, are always stored densely)
+struct BLRCtrl
+{
+    // Only fronts with at least this many rows are compressed
+    Int minFrontSize=2048;
+    // The height and width of the (square) tiles of compressed fronts
+    Int tileSize=256;
+    // The singular values of each tile which are smaller than tol times the
+    // largest singular value of that tile are dropped
+    double tol=1e-8;
+};
+
+// Controls for the traversal of the sequential portion of the elimination
+// tree within the multifrontal factorization and solves. The subtree-level
+// parallelism makes use of OpenMP tasks and is therefore only active when
+// Elemental was configured with EL_HYBRID.
+struct MultifrontalCtrl
+{
+    // Process independent subtrees concurrently
+    bool parallelTree=false;
+    // Subtrees with fewer variables are processed within a single task
+    Int minTaskSize=1000;
+    // Child updates at least this large are extend-added by several threads
+    Int minThreadedUpdateSize=128;
+
+    BLRCtrl blr;
+};
+
+// Whether the traversal of a sequential subtree must first open a parallel
+// region in which its tasks can be executed
+inline bool NeedParallelRegion( const MultifrontalCtrl& ctrl )
+{
+#ifdef EL_HYBRID
+    return ctrl.parallelTree && !omp_in_parallel();
+#else
+    return false;
+#endif
+}
+
+// Whether the subtree rooted at the given node should be traversed by a
+// separate task
+inline bool SpawnTask( const NodeInfo& info, const MultifrontalCtrl& ctrl )
+{ return ctrl.parallelTree && SubtreeSize(info) >= ctrl.minTaskSize; }
+
+// A prediction, made from the symbolic analysis alone, of the memory (in
+// numbers of entries) which the multifrontal factorization will require
+// on this process. The number of bytes is found by scaling by sizeof(F).
+struct MemoryPrediction
+{
+    // The entries of the fronts, which are kept as the factorization
+    double factorEntries=0;
+    // The largest number of entries of child updates, update matrices,
+    // communication buffers, and temporary copies held at once
+    double peakWorkEntries=0;
+
+    double PeakEntries() const { return factorEntries + peakWorkEntries; }
+};
+MemoryPrediction PredictMemory
+( const NodeInfo& rootInfo, const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
+MemoryPrediction PredictMemory
+( const DistNodeInfo& rootInfo,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
+
 template<typename T>
 struct DistMatrixNode;
 template<typename T>
@@ -221,6 +288,120 @@ struct DistMatrixNode
     void ComputeCommMeta( const DistNodeInfo& info ) const;
 };
 
+// Out-of-core storage of factored fronts
+// ======================================
+// After the factorization, the dense portions of the fronts (Front::LDense,
+// and the local data of DistFront::L1D or DistFront::L2D) can be spilled to a
+// file on node-local disk (see SpillFronts). The solves then read each front
+// back just before it is used, after asking the operating system to begin
+// reading the front which follows it in the traversal, and free it afterwards.
+class SpillFile
+{
+public:
+    // The file is truncated upon construction and removed upon destruction
+    SpillFile( const string& filename );
+    ~SpillFile();
+
+    // Append the bytes to the end of the file and return their offset
+    size_t Write( const void* buffer, size_t numBytes );
+    void Read( size_t offset, void* buffer, size_t numBytes ) const;
+    // Ask for the given range to be read into the page cache in the background
+    void Prefetch( size_t offset, size_t numBytes ) const;
+
+    template<typename F>
+    size_t Write( const Matrix<F>& A );
+    // NOTE: A must already have the dimensions of the stored matrix
+    template<typename F>
+    void Read( size_t offset, Matrix<F>& A ) const;
+
+private:
+    string filename_;
+    int fd_;
+    size_t size_;
+};
+
+template<typename F>
+inline size_t SpillFile::Write( const Matrix<F>& A )
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    const size_t offset = size_;
+    if( A.LDim() == height )
+        Write( A.LockedBuffer(), height*width*sizeof(F) );
+    else
+        for( Int j=0; j<width; ++j )
+            Write( A.LockedBuffer(0,j), height*sizeof(F) );
+    return offset;
+}
+
+template<typename F>
+inline void SpillFile::Read( size_t offset, Matrix<F>& A ) const
+{
+    const Int height = A.Height();
+    const Int width = A.Width();
+    if( A.LDim() == height )
+        Read( offset, A.Buffer(), height*width*sizeof(F) );
+    else
+        for( Int j=0; j<width; ++j )
+            Read( offset+j*height*sizeof(F), A.Buffer(0,j), height*sizeof(F) );
+}
+
+// Block low-rank storage of factored fronts
+// =========================================
+// The unit-lower factor of a compressed front is split into square tiles of
+// (at most) ctrl.tileSize rows and columns, where the row tiles of the
+// fully-summed portion coincide with the column tiles. The diagonal tiles are
+// kept dense and every tile beneath them is stored either densely or as the
+// product of an m x r matrix U and an r x n matrix V.
+template<typename F>
+struct BLRTile
+{
+    // If false, the tile is stored in U and V is empty
+    bool lowRank=false;
+    Matrix<F> U, V;
+
+    Int Height() const { return U.Height(); }
+    Int NumEntries() const
+    { return U.Height()*U.Width() + V.Height()*V.Width(); }
+};
+
+template<typename F>
+struct BLRMatrix
+{
+    Int height=0, width=0;
+    // The boundaries of the row tiles; the first diag.size()+1 of them are
+    // also the boundaries of the column tiles
+    vector<Int> offsets;
+    // The unit-lower diagonal tiles
+    vector<Matrix<F>> diag;
+    // panels[k][t] is the tile in row tile k+1+t of column tile k
+    vector<vector<BLRTile<F>>> panels;
+
+    bool Compressed() const { return !diag.empty(); }
+    void Empty();
+
+    Int NumTopLeftEntries() const;
+    Int NumBottomLeftEntries() const;
+    Int NumEntries() const;
+
+    // X := inv(L) X, or X := inv(L)^T X or inv(L)^H X
+    void ForwardSolve( Matrix<F>& X ) const;
+    void BackwardSolve( Matrix<F>& X, bool conjugate ) const;
+};
+
+// Factor a dense front while compressing the tiles of each panel of its
+// left portion, which are then used in low-rank form to update the trailing
+// tiles and the Schur complement (stored in ABR). The diagonal of the
+// factorization is returned in d and AL is emptied.
+template<typename F>
+void BLRFactor
+( Matrix<F>& AL,
+  Matrix<F>& ABR,
+  Matrix<F>& d,
+  BLRMatrix<F>& L,
+  bool conjugate,
+  const BLRCtrl& ctrl=BLRCtrl() );
+
 // Only keep track of the left and bottom-right piece of the fronts
 // (with the bottom-right piece stored in workspace) since only the left side
 // needs to be kept after the factorization is complete.
@@ -235,8 +416,12 @@ struct Front
     bool sparseLeaf;
     LDLFrontType type;
 
-    Matrix<F> LDense;
+    // Mutable so that the (logically const) solves may read a spilled LDense
+    // back in and free it again with Load and Release
+    mutable Matrix<F> LDense;
     SparseMatrix<F> LSparse;
+    // Replaces LDense when a BLR factorization compressed this front
+    BLRMatrix<F> LBLR;
 
     Matrix<F> diag;
     Matrix<F> subdiag;
@@ -249,6 +434,12 @@ struct Front
     vector<Front<F>*> children;
     DistFront<F>* duplicate;
 
+    // When LDense has been spilled to disk, the file holding it and its
+    // location and dimensions within the file
+    shared_ptr<SpillFile> spillFile;
+    size_t spillOffset;
+    Int spillHeight, spillWidth;
+
     Front( Front<F>* parentNode=nullptr );
     Front( DistFront<F>* dupNode );
     Front
@@ -278,6 +469,12 @@ struct Front
 
     const Front<F>& operator=( const Front<F>& front );
 
+    // Read a spilled LDense back in, free it again, or begin reading it in
+    // the background (these have no effect if LDense was not spilled)
+    void Load() const;
+    void Release() const;
+    void Prefetch() const;
+
     Int Height() const;
     Int NumEntries() const;
     Int NumTopLeftEntries() const;
@@ -316,8 +513,10 @@ struct DistFront
     // When this node is a duplicate of a sequential node, L1D or L2D will be 
     // attached to the sequential L matrix of the duplicate
 
-    DistMatrix<F,VC,STAR> L1D;
-    DistMatrix<F> L2D;
+    // Mutable so that the (logically const) solves may read the spilled
+    // local data back in and free it again with Load and Release
+    mutable DistMatrix<F,VC,STAR> L1D;
+    mutable DistMatrix<F> L2D;
 
     DistMatrix<F,VC,STAR> diag;
     DistMatrix<F,VC,STAR> subdiag;
@@ -330,6 +529,13 @@ struct DistFront
     DistFront<F>* child;
     Front<F>* duplicate;
 
+    // When the local data of L1D or L2D (depending upon the front type) has
+    // been spilled to disk, the file holding it and its location within the
+    // file, along with the global dimensions of the front
+    shared_ptr<SpillFile> spillFile;
+    size_t spillOffset;
+    Int spillHeight, spillWidth;
+
     DistFront( DistFront<F>* parentNode=nullptr );
 
     DistFront
@@ -384,6 +590,12 @@ struct DistFront
 
     const DistFront<F>& operator=( const DistFront<F>& front );
 
+    // Read the spilled front back in, free it again, or begin reading it in
+    // the background (these have no effect if the front was not spilled)
+    void Load() const;
+    void Release() const;
+    void Prefetch() const;
+
     Int NumLocalEntries() const;
     Int NumTopLeftLocalEntries() const;
     Int NumBottomLeftLocalEntries() const;
@@ -395,6 +607,26 @@ struct DistFront
     ( const DistNodeInfo& info, bool computeRecvInds ) const;
 };
 
+// Spill the dense portions of the fronts of a factored tree to disk (the
+// distributed variant appends the rank in mpi::COMM_WORLD to the filename).
+// Until RestoreFronts is called, only the solves may be applied to the fronts.
+template<typename F>
+void SpillFronts( Front<F>& front, const string& filename );
+template<typename F>
+void SpillFronts( DistFront<F>& front, const string& filename );
+template<typename F>
+void RestoreFronts( Front<F>& front );
+template<typename F>
+void RestoreFronts( DistFront<F>& front );
+
+// Copy a factored tree into a lower precision (e.g., for the mixed-precision
+// variants of reg_ldl::SolveAfter). The fronts must neither be spilled nor
+// BLR-compressed.
+template<typename F>
+void DemoteFronts( const Front<F>& front, Front<Demote<F>>& frontLow );
+template<typename F>
+void DemoteFronts( const DistFront<F>& front, DistFront<Demote<F>>& frontLow );
+
 template<typename F>
 void ChangeFrontType( Front<F>& front, LDLFrontType type, bool recurse=true );
 template<typename F>
@@ -413,26 +645,32 @@ void DiagonalScale
 
 template<typename F>
 void DiagonalSolve
-( const NodeInfo& info, const Front<F>& front, MatrixNode<F>& X );
+( const NodeInfo& info, const Front<F>& front, MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 template<typename F>
 void DiagonalSolve
-( const DistNodeInfo& info, const DistFront<F>& front, DistMultiVecNode<F>& X );
+( const DistNodeInfo& info, const DistFront<F>& front, DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 template<typename F>
 void DiagonalSolve
-( const DistNodeInfo& info, const DistFront<F>& L, DistMatrixNode<F>& X );
+( const DistNodeInfo& info, const DistFront<F>& L, DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 
 template<typename F>
 void LowerSolve
 ( Orientation orientation, const NodeInfo& info,
-  const Front<F>& L, MatrixNode<F>& X );
+  const Front<F>& L, MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 template<typename F>
 void LowerSolve
 ( Orientation orientation, const DistNodeInfo& info,
-  const DistFront<F>& L, DistMultiVecNode<F>& X );
+  const DistFront<F>& L, DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 template<typename F>
 void LowerSolve
 ( Orientation orientation, const DistNodeInfo& info,
-  const DistFront<F>& L, DistMatrixNode<F>& X );
+  const DistFront<F>& L, DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() );
 
 template<typename F>
 void LowerMultiply
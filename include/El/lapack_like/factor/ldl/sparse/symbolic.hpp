@@ -30,10 +30,38 @@
 namespace El {
 namespace ldl {
 
+// NOTE: The sequential analysis also chooses the order in which the
+// children of each node are processed so as to reduce the peak memory of
+// the factorization (see NodeInfo::childOrder)
 Int Analysis( NodeInfo& rootInfo, Int myOff=0 );
 void Analysis
 ( DistNodeInfo& rootInfo, bool storeFactRecvInds=true );
 
+// The number of variables eliminated within the subtree rooted at a node
+Int SubtreeSize( const NodeInfo& node );
+
+// Merge children into their parents while the fraction of explicit zeros
+// in each merged front is at most 'relaxedFill', and then renumber the tree.
+// This should precede BuildMap and Analysis.
+void Amalgamate( Separator& rootSep, NodeInfo& rootInfo, double relaxedFill );
+
+// A summary of the fronts of an (analyzed) elimination tree
+struct FrontStatistics
+{
+    Int numFronts=0;
+    // The number of entries in the lower-trapezoidal portions of the fronts
+    // (the fill of the factorization) and how many of them are explicit zeros
+    // introduced by relaxed amalgamation. These are stored as doubles since
+    // they routinely exceed the range of a 32-bit Int.
+    double numEntries=0;
+    double numRelaxedZeros=0;
+    // The number of fronts with 2^k <= size < 2^(k+1) is sizeHistogram[k]
+    vector<Int> sizeHistogram;
+};
+FrontStatistics GetFrontStatistics( const NodeInfo& rootInfo );
+FrontStatistics GetFrontStatistics( const DistNodeInfo& rootInfo );
+void PrintFrontStatistics( const FrontStatistics& stats, ostream& os=cout );
+
 void GetChildGridDims
 ( const DistNodeInfo& info, vector<int>& gridHeights, vector<int>& gridWidths );
 
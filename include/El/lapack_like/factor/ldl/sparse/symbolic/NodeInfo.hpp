@@ -27,6 +27,10 @@ struct NodeInfo
     vector<NodeInfo*> children;
     DistNodeInfo* duplicate; 
 
+    // The number of explicit zeros introduced by relaxed amalgamation
+    // (a double, as for the front statistics, to avoid overflow)
+    double relaxedZeros;
+
     // Known after analysis
     // --------------------
     Int myOff;
@@ -35,6 +39,14 @@ struct NodeInfo
     // (maps from the child update indices to our frontal indices).
     vector<vector<Int>> childRelInds;
 
+    // The order in which a sequential factorization processes the children,
+    // how many of them (in that order) have their updates held until our
+    // update matrix is formed, and the resulting largest number of entries
+    // of update matrices and temporaries held while factoring the subtree
+    vector<Int> childOrder;
+    Int numStackedChildren;
+    double peakWorkEntries;
+
     // Symbolic analysis for modification of SuiteSparse LDL
     // -----------------------------------------------------
     // NOTE: These are only used within leaf nodes
@@ -42,7 +54,8 @@ struct NodeInfo
     vector<Int> LParents;
 
     NodeInfo( NodeInfo* parentNode=nullptr )
-    : parent(parentNode), duplicate(nullptr)
+    : parent(parentNode), duplicate(nullptr), relaxedZeros(0),
+      numStackedChildren(0), peakWorkEntries(0)
     { }
 
     NodeInfo( DistNodeInfo* duplicateNode );
@@ -113,7 +126,8 @@ struct DistNodeInfo
 };
 
 inline NodeInfo::NodeInfo( DistNodeInfo* duplicateNode )
-: parent(nullptr), duplicate(duplicateNode)
+: parent(nullptr), duplicate(duplicateNode), relaxedZeros(0),
+  numStackedChildren(0), peakWorkEntries(0)
 {
     size = duplicate->size;
     off = duplicate->off;
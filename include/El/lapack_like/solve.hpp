@@ -16,10 +16,51 @@ namespace El {
 
 // Linear
 // ======
+enum LinearSolveRefineAlg
+{
+  LINEAR_SOLVE_REFINE_CLASSICAL,
+  LINEAR_SOLVE_REFINE_FGMRES
+};
+
+template<typename Real>
+struct LinearSolveCtrl
+{
+    // If enabled, the LU factorization is performed in the next-lower
+    // precision (e.g., float when solving a system over double) and the
+    // accuracy of the working precision is recovered with iterative refinement
+    // against the original matrix
+    bool mixedPrecision=false;
+
+    // Either LU_PARTIAL or LU_TOURNAMENT (only used for distributed matrices)
+    LUPivotType pivotType=LU_PARTIAL;
+
+    LinearSolveRefineAlg refineAlg=LINEAR_SOLVE_REFINE_CLASSICAL;
+    Real relTol;
+    Int maxRefineIts=10;
+    Int restart=10;
+
+    // Refactor in the working precision if the low-precision factorization
+    // is singular or the refinement stagnates before the normwise backward
+    // error, || B - A X ||_F / ( || A ||_F || X ||_F + || B ||_F ), reaches
+    // 'relTol'
+    bool fallback=true;
+    bool progress=false;
+
+    LinearSolveCtrl()
+    {
+        const Real eps = limits::Epsilon<Real>();
+        relTol = Pow(eps,Real(0.75));
+    }
+};
+
 template<typename F>
-void LinearSolve( const Matrix<F>& A, Matrix<F>& B );
+void LinearSolve
+( const Matrix<F>& A, Matrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
-void LinearSolve( const ElementalMatrix<F>& A, ElementalMatrix<F>& B );
+void LinearSolve
+( const ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl=LinearSolveCtrl<Base<F>>() );
 template<typename F>
 void LinearSolve
 ( const DistMatrix<F,MC,MR,BLOCK>& A, DistMatrix<F,MC,MR,BLOCK>& B );
@@ -38,7 +79,9 @@ namespace lin_solve {
 template<typename F>
 void Overwrite( Matrix<F>& A, Matrix<F>& B );
 template<typename F>
-void Overwrite( ElementalMatrix<F>& A, ElementalMatrix<F>& B );
+void Overwrite
+( ElementalMatrix<F>& A, ElementalMatrix<F>& B,
+  LUPivotType pivotType=LU_PARTIAL );
 
 } // namespace lin_solve
 
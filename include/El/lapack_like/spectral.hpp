@@ -1303,6 +1303,84 @@ SVDInfo TSQR
 
 } // namespace svd
 
+// Randomized low-rank approximation
+// =================================
+// Approximate the dominant singular triplets (or, for Hermitian matrices,
+// eigenpairs) of A from an orthonormal basis, Q, for a randomized sample of
+// its range. The sample is formed by applying A to Gaussian test vectors and
+// then performing 'numPowerIts' subspace iterations, so that a rank-k
+// approximation requires O(m n k) work rather than the O(m n min(m,n)) of a
+// full SVD.
+//
+// By default, 'rank' triplets are computed from a sample of
+// 'rank+oversample' columns. If 'adaptive' is true, the sample is instead
+// grown 'blocksize' columns at a time until ||A - Q Q^H A||_F <= tol ||A||_F
+// (or the sample has 'maxRank' columns, where zero signifies min(m,n)), and
+// the approximation is truncated to the smallest rank which satisfies the
+// same tolerance. Since the error is estimated as a difference of squared
+// Frobenius norms, tolerances much below the square-root of the machine
+// epsilon are not meaningful.
+template<typename Real>
+struct RandomizedSVDCtrl
+{
+    Int rank=10;
+    Int oversample=10;
+    Int numPowerIts=2;
+
+    bool adaptive=false;
+    Real tol=Real(0);
+    Int blocksize=32;
+    Int maxRank=0;
+};
+
+// Return Q, with orthonormal columns, such that A ~= Q Q^H A, as well as an
+// estimate of || A - Q Q^H A ||_F
+template<typename F>
+Base<F> RandomizedRangeFinder
+( const Matrix<F>& A,
+        Matrix<F>& Q,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+template<typename F>
+Base<F> RandomizedRangeFinder
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& Q,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+
+// Return a truncated SVD, A ~= U diag(s) V^H, with s in descending order, as
+// well as an estimate of || A - U diag(s) V^H ||_F
+template<typename F>
+Base<F> RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+template<typename F>
+Base<F> RandomizedSVD
+( const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<F>& U,
+        AbstractDistMatrix<Base<F>>& s,
+        AbstractDistMatrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+
+// Return the eigenpairs of largest magnitude of a Hermitian matrix,
+// A ~= Z diag(w) Z^H, with |w| in descending order, as well as an estimate of
+// || A - Z diag(w) Z^H ||_F
+template<typename F>
+Base<F> RandomizedHermitianEig
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+        Matrix<Base<F>>& w,
+        Matrix<F>& Z,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+template<typename F>
+Base<F> RandomizedHermitianEig
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& A,
+        AbstractDistMatrix<Base<F>>& w,
+        AbstractDistMatrix<F>& Z,
+  const RandomizedSVDCtrl<Base<F>>& ctrl=RandomizedSVDCtrl<Base<F>>() );
+
 // Hermitian SVD
 // =============
 
@@ -24,10 +24,14 @@ struct BisectCtrl
     Int numSeqSeps;
     Int cutoff;
     bool storeFactRecvInds;
+    // The largest fraction of explicit zeros allowed in a front formed by
+    // merging children into their parent (relaxed supernode amalgamation).
+    // A value of zero disables amalgamation.
+    double relaxedFill;
 
     BisectCtrl()
     : sequential(true), numDistSeps(1), numSeqSeps(1), cutoff(1024),
-      storeFactRecvInds(false)
+      storeFactRecvInds(false), relaxedFill(0)
     { }
 };
 
@@ -20,6 +20,42 @@ enum KKTSystem {
 }
 using namespace KKTSystemNS;
 
+// Reusable analyses of sparse KKT systems
+// =======================================
+// The nested dissection ordering, the symbolic factorization, and (for
+// distributed matrices) the communication metadata of the KKT systems of
+// the sparse Interior Point Methods only depend upon their sparsity
+// patterns. When solving a sequence of problems which share a sparsity
+// pattern (and only differ in their data), the same analysis object can be
+// attached to each MehrotraCtrl so that these are only computed once. The
+// pattern of each new KKT system is checked against the analyzed one, and
+// the analysis is recomputed if they differ.
+struct KKTAnalysis
+{
+    Graph graph;
+    vector<Int> map, invMap;
+    ldl::Separator rootSep;
+    ldl::NodeInfo info;
+
+    // Analyze the given sparsity pattern unless it was the last one analyzed.
+    // Returns true if a new analysis was performed.
+    bool Analyze( const Graph& kktGraph, const BisectCtrl& ctrl=BisectCtrl() );
+};
+
+struct DistKKTAnalysis
+{
+    DistGraph graph;
+    DistMap map, invMap;
+    ldl::DistSeparator rootSep;
+    ldl::DistNodeInfo info;
+    // The results of MappedSources and MappedTargets for the KKT matrix
+    vector<Int> mappedSources, mappedTargets, colOffs;
+    ldl::DistMultiVecNodeMeta dmvMeta;
+
+    bool Analyze
+    ( const DistGraph& kktGraph, const BisectCtrl& ctrl=BisectCtrl() );
+};
+
 // Mehrotra's Predictor-Corrector Infeasible Interior Point Method
 // ===============================================================
 template<typename Real>
@@ -144,6 +180,12 @@ struct MehrotraCtrl
     Real reg1Perm = Pow(limits::Epsilon<Real>(),Real(0.35));
     Real reg2Perm = Pow(limits::Epsilon<Real>(),Real(0.35));
 
+    // Optional analyses of the sparsity patterns of the KKT systems which
+    // persist across solves (see KKTAnalysis); the former is used by the
+    // sequential sparse solvers and the latter by the distributed ones
+    KKTAnalysis* kktAnalysis=nullptr;
+    DistKKTAnalysis* distKKTAnalysis=nullptr;
+
     // TODO: Add a user-definable (muAff,mu) -> sigma function to replace
     //       the default, (muAff/mu)^3 
 };
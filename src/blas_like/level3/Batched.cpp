@@ -0,0 +1,305 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+#include <El/blas_like/level3.hpp>
+
+#include "./Batched/Util.hpp"
+
+namespace El {
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B,
+  T beta,        Matrix<T>& C )
+{
+    DEBUG_CSE
+    const Int batchSize = C.Width();
+    batched::CheckBatch( A, m*k, batchSize );
+    batched::CheckBatch( B, k*n, batchSize );
+    batched::CheckBatch( C, m*n, batchSize );
+    const bool normalA = ( orientA == NORMAL );
+    const bool normalB = ( orientB == NORMAL );
+    const bool conjA = ( orientA == ADJOINT );
+    const bool conjB = ( orientB == ADJOINT );
+
+    const T* ABuf = A.LockedBuffer();
+    const T* BBuf = B.LockedBuffer();
+          T* CBuf = C.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+    const Int CLDim = C.LDim();
+
+    auto groupKernel =
+      [&]( Int first, Int groupSize )
+      {
+          T* AGroup = batched::ThreadBuffer<T,0>( m*k*groupSize );
+          T* BGroup = batched::ThreadBuffer<T,1>( k*n*groupSize );
+          T* CGroup = batched::ThreadBuffer<T,2>( m*n*groupSize );
+          T* gamma = batched::ThreadBuffer<T,3>( groupSize );
+          batched::Interleave
+          ( m*k, groupSize, &ABuf[first*ALDim], ALDim, AGroup );
+          batched::Interleave
+          ( k*n, groupSize, &BBuf[first*BLDim], BLDim, BGroup );
+          batched::Interleave
+          ( m*n, groupSize, &CBuf[first*CLDim], CLDim, CGroup );
+
+          // C := beta C (explicitly zeroing C when beta = 0 so that any
+          // non-finite entries are not propagated)
+          if( beta == T(0) )
+          {
+              for( Int e=0; e<m*n*groupSize; ++e )
+                  CGroup[e] = 0;
+          }
+          else if( beta != T(1) )
+          {
+              for( Int e=0; e<m*n*groupSize; ++e )
+                  CGroup[e] *= beta;
+          }
+
+          // C(:,j) += op(A)(:,l) (alpha op(B)(l,j))
+          for( Int j=0; j<n; ++j )
+          {
+              for( Int l=0; l<k; ++l )
+              {
+                  const T* b = &BGroup[(normalB ? l+j*k : j+l*n)*groupSize];
+                  EL_SIMD
+                  for( Int w=0; w<groupSize; ++w )
+                      gamma[w] = alpha*batched::MaybeConj(conjB,b[w]);
+                  for( Int i=0; i<m; ++i )
+                  {
+                      const T* a =
+                        &AGroup[(normalA ? i+l*m : l+i*k)*groupSize];
+                      T* c = &CGroup[(i+j*m)*groupSize];
+                      EL_SIMD
+                      for( Int w=0; w<groupSize; ++w )
+                          c[w] += batched::MaybeConj(conjA,a[w])*gamma[w];
+                  }
+              }
+          }
+
+          batched::Deinterleave
+          ( m*n, groupSize, CGroup, &CBuf[first*CLDim], CLDim );
+      };
+    batched::ForEachGroup( batchSize, batched::GroupSize<T>(), groupKernel );
+}
+
+template<typename T>
+void BatchedGemm
+( Orientation orientA, Orientation orientB,
+  Int m, Int n, Int k,
+  T alpha, const AbstractDistMatrix<T>& APre,
+           const AbstractDistMatrix<T>& BPre,
+  T beta,        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, BPre, CPre ))
+    if( APre.Width() != CPre.Width() || BPre.Width() != CPre.Width() )
+        LogicError("Batches must have the same number of members");
+
+    // Distribute whole members over the processes, with each member of A
+    // and B stored on the same process as the corresponding member of C
+    DistMatrixReadWriteProxy<T,T,STAR,VR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrl;
+    ctrl.rowConstrain = true;
+    ctrl.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,STAR,VR> AProx( APre, ctrl );
+    DistMatrixReadProxy<T,T,STAR,VR> BProx( BPre, ctrl );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    BatchedGemm
+    ( orientA, orientB, m, n, k,
+      alpha, A.LockedMatrix(), B.LockedMatrix(), beta, C.Matrix() );
+}
+
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, F alpha, const Matrix<F>& A, Matrix<F>& B )
+{
+    DEBUG_CSE
+    const Int batchSize = B.Width();
+    const Int d = ( side == LEFT ? m : n );
+    batched::CheckBatch( A, d*d, batchSize );
+    batched::CheckBatch( B, m*n, batchSize );
+    const bool normal = ( orientation == NORMAL );
+    const bool conjugate = ( orientation == ADJOINT );
+    // Whether op(A) is lower-triangular
+    const bool opLower = ( (uplo == LOWER) == normal );
+
+    const F* ABuf = A.LockedBuffer();
+          F* BBuf = B.Buffer();
+    const Int ALDim = A.LDim();
+    const Int BLDim = B.LDim();
+
+    auto groupKernel =
+      [&]( Int first, Int groupSize )
+      {
+          F* AGroup = batched::ThreadBuffer<F,0>( d*d*groupSize );
+          F* BGroup = batched::ThreadBuffer<F,1>( m*n*groupSize );
+          batched::Interleave
+          ( d*d, groupSize, &ABuf[first*ALDim], ALDim, AGroup );
+          batched::Interleave
+          ( m*n, groupSize, &BBuf[first*BLDim], BLDim, BGroup );
+
+          if( alpha != F(1) )
+          {
+              for( Int e=0; e<m*n*groupSize; ++e )
+                  BGroup[e] *= alpha;
+          }
+
+          // Return the (unconjugated) entries of op(A)(i,j)
+          auto opA =
+            [&]( Int i, Int j ) -> const F*
+            { return &AGroup[(normal ? i+j*d : j+i*d)*groupSize]; };
+          auto x =
+            [&]( Int i, Int j ) -> F*
+            { return &BGroup[(i+j*m)*groupSize]; };
+
+          if( side == LEFT )
+          {
+              // Solve op(A) X = B one row of X at a time, eliminating each
+              // row from the remainder of B once it is known
+              for( Int t=0; t<m; ++t )
+              {
+                  const Int i = ( opLower ? t : m-1-t );
+                  if( diag == NON_UNIT )
+                  {
+                      const F* delta = opA(i,i);
+                      for( Int j=0; j<n; ++j )
+                      {
+                          F* chi = x(i,j);
+                          EL_SIMD
+                          for( Int w=0; w<groupSize; ++w )
+                              chi[w] /= batched::MaybeConj(conjugate,delta[w]);
+                      }
+                  }
+                  const Int rBeg = ( opLower ? i+1 : 0 );
+                  const Int rEnd = ( opLower ? m : i );
+                  for( Int j=0; j<n; ++j )
+                  {
+                      const F* chi = x(i,j);
+                      for( Int r=rBeg; r<rEnd; ++r )
+                      {
+                          const F* eta = opA(r,i);
+                          F* psi = x(r,j);
+                          EL_SIMD
+                          for( Int w=0; w<groupSize; ++w )
+                              psi[w] -=
+                                batched::MaybeConj(conjugate,eta[w])*chi[w];
+                      }
+                  }
+              }
+          }
+          else
+          {
+              // Solve X op(A) = B one column of X at a time, eliminating
+              // each column from the remainder of B once it is known
+              for( Int t=0; t<n; ++t )
+              {
+                  const Int j = ( opLower ? n-1-t : t );
+                  if( diag == NON_UNIT )
+                  {
+                      const F* delta = opA(j,j);
+                      for( Int i=0; i<m; ++i )
+                      {
+                          F* chi = x(i,j);
+                          EL_SIMD
+                          for( Int w=0; w<groupSize; ++w )
+                              chi[w] /= batched::MaybeConj(conjugate,delta[w]);
+                      }
+                  }
+                  const Int sBeg = ( opLower ? 0 : j+1 );
+                  const Int sEnd = ( opLower ? j : n );
+                  for( Int s=sBeg; s<sEnd; ++s )
+                  {
+                      const F* eta = opA(j,s);
+                      for( Int i=0; i<m; ++i )
+                      {
+                          const F* chi = x(i,j);
+                          F* psi = x(i,s);
+                          EL_SIMD
+                          for( Int w=0; w<groupSize; ++w )
+                              psi[w] -=
+                                chi[w]*batched::MaybeConj(conjugate,eta[w]);
+                      }
+                  }
+              }
+          }
+
+          batched::Deinterleave
+          ( m*n, groupSize, BGroup, &BBuf[first*BLDim], BLDim );
+      };
+    batched::ForEachGroup( batchSize, batched::GroupSize<F>(), groupKernel );
+}
+
+template<typename F>
+void BatchedTrsm
+( LeftOrRight side, UpperOrLower uplo,
+  Orientation orientation, UnitOrNonUnit diag,
+  Int m, Int n, F alpha, const AbstractDistMatrix<F>& APre,
+                               AbstractDistMatrix<F>& BPre )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, BPre ))
+    if( APre.Width() != BPre.Width() )
+        LogicError("Batches must have the same number of members");
+
+    DistMatrixReadWriteProxy<F,F,STAR,VR> BProx( BPre );
+    auto& B = BProx.Get();
+
+    ElementalProxyCtrl ctrl;
+    ctrl.rowConstrain = true;
+    ctrl.rowAlign = B.RowAlign();
+
+    DistMatrixReadProxy<F,F,STAR,VR> AProx( APre, ctrl );
+    auto& A = AProx.GetLocked();
+
+    BatchedTrsm
+    ( side, uplo, orientation, diag, m, n,
+      alpha, A.LockedMatrix(), B.Matrix() );
+}
+
+#define PROTO_INT(T) \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const Matrix<T>& A, const Matrix<T>& B, \
+    T beta,        Matrix<T>& C ); \
+  template void BatchedGemm \
+  ( Orientation orientA, Orientation orientB, \
+    Int m, Int n, Int k, \
+    T alpha, const AbstractDistMatrix<T>& A, \
+             const AbstractDistMatrix<T>& B, \
+    T beta,        AbstractDistMatrix<T>& C );
+
+#define PROTO(T) \
+  PROTO_INT(T) \
+  template void BatchedTrsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, T alpha, const Matrix<T>& A, Matrix<T>& B ); \
+  template void BatchedTrsm \
+  ( LeftOrRight side, UpperOrLower uplo, \
+    Orientation orientation, UnitOrNonUnit diag, \
+    Int m, Int n, T alpha, const AbstractDistMatrix<T>& A, \
+                                 AbstractDistMatrix<T>& B );
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
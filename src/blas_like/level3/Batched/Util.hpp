@@ -0,0 +1,99 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_BATCHED_UTIL_HPP
+#define EL_BATCHED_UTIL_HPP
+
+// Each column of a batch holds one (packed, column-major) member. The batched
+// kernels copy groups of members into an interleaved buffer, Y, in which
+// entry e of member w of the group is stored in Y[w+e*groupSize], so that
+// the innermost loop of each kernel runs over the members of the group with
+// unit stride and can be vectorized.
+//
+// NOTE: The kernels are executed within OpenMP parallel regions and must
+//       therefore avoid routines which modify the (debug) call stack.
+
+namespace El {
+namespace batched {
+
+// The number of members interleaved into a group: enough to fill a cache line
+// (and the widest SIMD registers) with a single entry of each member
+template<typename T>
+Int GroupSize()
+{ return Max( Int(1), Int(64/sizeof(T)) ); }
+
+template<typename T>
+inline T MaybeConj( bool conjugate, const T& alpha )
+{ return conjugate ? Conj(alpha) : alpha; }
+
+// Return (a pointer to) at least 'size' entries of this thread's buffer with
+// the given index. The buffers are kept (and only grown) across groups and
+// calls so that the group kernels do not allocate; the contents are only
+// valid until the next request for the same type and index.
+template<typename T,Int index>
+T* ThreadBuffer( Int size )
+{
+    static thread_local vector<T> buffer;
+    if( Int(buffer.size()) < size )
+        buffer.resize( size );
+    return buffer.data();
+}
+
+template<typename T>
+void Interleave
+( Int size, Int groupSize, const T* ABuf, Int ALDim, T* Y )
+{
+    for( Int w=0; w<groupSize; ++w )
+    {
+        const T* a = &ABuf[w*ALDim];
+        for( Int e=0; e<size; ++e )
+            Y[w+e*groupSize] = a[e];
+    }
+}
+
+template<typename T>
+void Deinterleave
+( Int size, Int groupSize, const T* Y, T* ABuf, Int ALDim )
+{
+    for( Int w=0; w<groupSize; ++w )
+    {
+        T* a = &ABuf[w*ALDim];
+        for( Int e=0; e<size; ++e )
+            a[e] = Y[w+e*groupSize];
+    }
+}
+
+// Ensure that the batch A stores batchSize members, each with the given
+// number of entries
+template<typename T>
+void CheckBatch( const Matrix<T>& A, Int memberSize, Int batchSize )
+{
+    if( A.Height() != memberSize || A.Width() != batchSize )
+        LogicError
+        ("Expected a ",memberSize," x ",batchSize," batch but received a ",
+         A.Height()," x ",A.Width()," matrix");
+}
+
+// Call groupKernel( first, groupSize ) for each group of the members of a
+// batch, where the groups are distributed over the OpenMP threads
+template<typename GroupKernel>
+void ForEachGroup( Int batchSize, Int groupSize, GroupKernel groupKernel )
+{
+    const Int numGroups = (batchSize+groupSize-1) / groupSize;
+    EL_PARALLEL_FOR
+    for( Int group=0; group<numGroups; ++group )
+    {
+        const Int first = group*groupSize;
+        groupKernel( first, Min(groupSize,batchSize-first) );
+    }
+}
+
+} // namespace batched
+} // namespace El
+
+#endif // ifndef EL_BATCHED_UTIL_HPP
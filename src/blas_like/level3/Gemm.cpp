@@ -9,13 +9,30 @@
 #include <El-lite.hpp>
 #include <El/blas_like/level3.hpp>
 
+#include <unistd.h>
+
 #include "./Gemm/NN.hpp"
 #include "./Gemm/NT.hpp"
 #include "./Gemm/TN.hpp"
 #include "./Gemm/TT.hpp"
+#include "./Gemm/SUMMA25D.hpp"
+#include "./Gemm/Pipelined.hpp"
 
 namespace El {
 
+namespace {
+
+Int gemm25DNumLayers = 0;
+double gemm25DMemoryBudget = 0;
+
+} // anonymous namespace
+
+void SetGemm25DNumLayers( Int numLayers ) { gemm25DNumLayers = numLayers; }
+Int Gemm25DNumLayers() { return gemm25DNumLayers; }
+
+void SetGemm25DMemoryBudget( double bytes ) { gemm25DMemoryBudget = bytes; }
+double Gemm25DMemoryBudget() { return gemm25DMemoryBudget; }
+
 template<typename T>
 void Gemm
 ( Orientation orientA, Orientation orientB,
@@ -96,12 +113,20 @@ void Gemm
 {
     DEBUG_CSE
     C *= beta;
+    if( alg == GEMM_SUMMA_25D )
+    {
+        gemm::SUMMA25D
+        ( orientA, orientB, alpha, A, B, C, Gemm25DNumLayers() );
+        return;
+    }
+    if( alg == GEMM_SUMMA_C_PIPELINED )
+    {
+        gemm::SUMMA_CPipelined( orientA, orientB, alpha, A, B, C );
+        return;
+    }
     if( orientA == NORMAL && orientB == NORMAL )
     {
-        if( alg == GEMM_CANNON )
-            gemm::Cannon_NN( alpha, A, B, C );
-        else 
-            gemm::SUMMA_NN( alpha, A, B, C, alg );
+        gemm::SUMMA_NN( alpha, A, B, C, alg );
     }
     else if( orientA == NORMAL )
     {
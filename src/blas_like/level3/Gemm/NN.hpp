@@ -10,84 +10,6 @@
 namespace El {
 namespace gemm {
 
-// Cannon's algorithm
-template<typename T>
-void Cannon_NN
-( T alpha,
-  const AbstractDistMatrix<T>& APre,
-  const AbstractDistMatrix<T>& BPre,
-        AbstractDistMatrix<T>& CPre )
-{
-    DEBUG_CSE
-    const Grid& g = APre.Grid();
-    if( g.Height() != g.Width() )
-        LogicError("Process grid must be square for Cannon's");
-
-    // Force A, B, and C to be in [MC,MR] distributions aligned with C
-    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
-    auto& C = CProx.Get();
-
-    ElementalProxyCtrl ctrlA, ctrlB;
-    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
-    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
-    
-    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
-    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
-    auto& A = AProx.GetLocked();
-    auto& B = BProx.GetLocked();
-
-    const Int row = g.Row();
-    const Int col = g.Col();
-    const Int pSqrt = g.Height();
-    mpi::Comm rowComm = g.RowComm();
-    mpi::Comm colComm = g.ColComm(); 
-    if( A.Width() % pSqrt != 0 )
-        LogicError("For now, width(A) must be integer multiple of sqrt(p)");
-
-    // Load the initial A and B packages (may want to transpose B...)
-    const Int localHeightA = A.LocalHeight();
-    const Int localHeightB = B.LocalHeight();
-    const Int localWidthA = A.LocalWidth();
-    const Int localWidthB = B.LocalWidth();
-    Matrix<T> pkgA(localHeightA,localWidthA,localHeightA), 
-              pkgB(localHeightB,localWidthB,localHeightB);
-    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
-        MemCopy
-        ( pkgA.Buffer(0,jLoc), A.LockedBuffer(0,jLoc), localHeightA );
-    for( Int jLoc=0; jLoc<localWidthB; ++jLoc )
-        MemCopy
-        ( pkgB.Buffer(0,jLoc), B.LockedBuffer(0,jLoc), localHeightB );
-
-    // Perform the initial circular shifts so that our A and B packages align
-    const Int rowShiftA = A.RowShift();
-    const Int colShiftB = B.ColShift();
-    const Int leftInitA  = Mod(col-colShiftB,pSqrt);
-    const Int rightInitA = Mod(col+colShiftB,pSqrt);
-    const Int aboveInitB = Mod(row-rowShiftA,pSqrt);
-    const Int belowInitB = Mod(row+rowShiftA,pSqrt);
-    const Int pkgSizeA = localHeightA*localWidthA;
-    const Int pkgSizeB = localHeightB*localWidthB;
-    mpi::SendRecv( pkgA.Buffer(), pkgSizeA, leftInitA, rightInitA, rowComm );
-    mpi::SendRecv( pkgB.Buffer(), pkgSizeB, aboveInitB, belowInitB, colComm );
-
-    // Now begin the data flow
-    const Int aboveRow = Mod(row-1,pSqrt);
-    const Int belowRow = Mod(row+1,pSqrt);
-    const Int leftCol  = Mod(col-1,pSqrt);
-    const Int rightCol = Mod(col+1,pSqrt);
-    for( Int q=0; q<pSqrt; ++q )
-    {
-        Gemm( NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix() );
-        if( q != pSqrt-1 )
-        {
-            mpi::SendRecv
-            ( pkgA.Buffer(), pkgSizeA, leftCol, rightCol, rowComm );
-            mpi::SendRecv
-            ( pkgB.Buffer(), pkgSizeB, aboveRow, belowRow, colComm );
-        }
-    }
-}
-
 // Normal Normal Gemm that avoids communicating the matrix A
 template<typename T>
 void SUMMA_NNA
@@ -112,6 +34,7 @@ void SUMMA_NNA
     DistMatrix<T,VR,STAR> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
     DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+    WorkspaceLoan<T> loan( B1_VR_STAR, B1Trans_STAR_MR, D1_MC_STAR );
 
     B1_VR_STAR.AlignWith( A );
     B1Trans_STAR_MR.AlignWith( A );
@@ -156,6 +79,7 @@ void SUMMA_NNB
     // Temporary distributions
     DistMatrix<T,STAR,MC> A1_STAR_MC(g);
     DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    WorkspaceLoan<T> loan( A1_STAR_MC, D1Trans_MR_STAR );
 
     A1_STAR_MC.AlignWith( B );
     D1Trans_MR_STAR.AlignWith( B );
@@ -198,6 +122,7 @@ void SUMMA_NNC
     // Temporary distributions
     DistMatrix<T,MC,STAR> A1_MC_STAR(g);
     DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g); 
+    WorkspaceLoan<T> loan( A1_MC_STAR, B1Trans_MR_STAR );
 
     A1_MC_STAR.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -217,6 +142,134 @@ void SUMMA_NNC
     }
 }
 
+// Cannon's algorithm
+//
+// On a sqrt(p) x sqrt(p) grid, the columns of A (and rows of B) whose indices
+// are congruent to kappa modulo sqrt(p) form the packages of class kappa. At
+// step q, process (r,c) multiplies its packages of class (r+c+q) mod sqrt(p);
+// packages of A then shift left and those of B shift up. Since packages of
+// different classes differ in size by at most one column (row), arbitrary
+// dimensions are supported. The shifts are double-buffered so that each one
+// overlaps the local multiplication of the previous packages.
+template<typename T>
+void Cannon_NN
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Grid& g = APre.Grid();
+    if( g.Height() != g.Width() )
+    {
+        // Cannon's algorithm requires a square process grid
+        SUMMA_NNC( alpha, APre, BPre, CPre );
+        return;
+    }
+
+    // Force A, B, and C to be in [MC,MR] distributions aligned with C
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+    
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    const Int row = g.Row();
+    const Int col = g.Col();
+    const Int pSqrt = g.Height();
+    mpi::Comm rowComm = g.RowComm();
+    mpi::Comm colComm = g.ColComm(); 
+
+    const Int sumDim = A.Width();
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    const Int maxPkgSize = MaxLength( sumDim, pSqrt );
+    auto pkgClass = [&]( Int q ) { return Mod(row+col+q,pSqrt); };
+    auto pkgSize = [&]( Int q ) { return Length(sumDim,pkgClass(q),pSqrt); };
+
+    vector<T> bufA[2], bufB[2];
+    for( Int buffer=0; buffer<2; ++buffer )
+    {
+        FastResize( bufA[buffer], localHeight*maxPkgSize );
+        FastResize( bufB[buffer], maxPkgSize*localWidth );
+    }
+
+    // Pack our local data, which is of class A.RowShift() for A and
+    // B.ColShift() for B
+    const Int localWidthA = A.LocalWidth();
+    const Int localHeightB = B.LocalHeight();
+    for( Int jLoc=0; jLoc<localWidthA; ++jLoc )
+        MemCopy
+        ( &bufA[1][jLoc*localHeight], A.LockedBuffer(0,jLoc), localHeight );
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+        MemCopy
+        ( &bufB[1][jLoc*localHeightB], B.LockedBuffer(0,jLoc), localHeightB );
+
+    // Perform the initial skew by sending our packages to the processes which
+    // multiply them first
+    mpi::Request<T> requests[4];
+    const Int sendColA = Mod(A.RowShift()-row,pSqrt);
+    const Int recvColA = Mod(row+col+A.RowAlign(),pSqrt);
+    const Int sendRowB = Mod(B.ColShift()-col,pSqrt);
+    const Int recvRowB = Mod(row+col+B.ColAlign(),pSqrt);
+    mpi::IRecv
+    ( bufA[0].data(), localHeight*pkgSize(0), recvColA, rowComm, requests[0] );
+    mpi::IRecv
+    ( bufB[0].data(), pkgSize(0)*localWidth, recvRowB, colComm, requests[1] );
+    mpi::ISend
+    ( bufA[1].data(), localHeight*localWidthA, sendColA, rowComm, requests[2] );
+    mpi::ISend
+    ( bufB[1].data(), localHeightB*localWidth, sendRowB, colComm, requests[3] );
+    mpi::WaitAll( 4, requests );
+
+    // Now begin the data flow
+    const Int aboveRow = Mod(row-1,pSqrt);
+    const Int belowRow = Mod(row+1,pSqrt);
+    const Int leftCol  = Mod(col-1,pSqrt);
+    const Int rightCol = Mod(col+1,pSqrt);
+    Matrix<T> pkgA, pkgB;
+    Int buffer = 0;
+    for( Int q=0; q<pSqrt; ++q )
+    {
+        const Int size = pkgSize(q);
+        const bool shift = ( q != pSqrt-1 );
+        if( shift )
+        {
+            const Int nextSize = pkgSize(q+1);
+            mpi::IRecv
+            ( bufA[1-buffer].data(), localHeight*nextSize, rightCol, rowComm,
+              requests[0] );
+            mpi::IRecv
+            ( bufB[1-buffer].data(), nextSize*localWidth, belowRow, colComm,
+              requests[1] );
+            mpi::ISend
+            ( bufA[buffer].data(), localHeight*size, leftCol, rowComm,
+              requests[2] );
+            mpi::ISend
+            ( bufB[buffer].data(), size*localWidth, aboveRow, colComm,
+              requests[3] );
+        }
+
+        pkgA.LockedAttach
+        ( localHeight, size, bufA[buffer].data(), Max(localHeight,1) );
+        pkgB.LockedAttach
+        ( size, localWidth, bufB[buffer].data(), Max(size,1) );
+        Gemm( NORMAL, NORMAL, alpha, pkgA, pkgB, T(1), C.Matrix() );
+
+        if( shift )
+        {
+            mpi::WaitAll( 4, requests );
+            buffer = 1-buffer;
+        }
+    }
+}
+
 // Normal Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -248,6 +301,7 @@ void SUMMA_NNDot
     auto& C = CProx.Get();
 
     DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceLoan<T> loan( C11_STAR_STAR );
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -315,6 +369,7 @@ void SUMMA_NN
     case GEMM_SUMMA_B:   SUMMA_NNB( alpha, A, B, C ); break;
     case GEMM_SUMMA_C:   SUMMA_NNC( alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NNDot( alpha, A, B, C, blockSizeDot ); break;
+    case GEMM_CANNON:    Cannon_NN( alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -35,6 +35,7 @@ void SUMMA_NTA
     // Temporary distributions
     DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
     DistMatrix<T,MC,STAR> D1_MC_STAR(g);
+    WorkspaceLoan<T> loan( B1Trans_MR_STAR, D1_MC_STAR );
 
     B1Trans_MR_STAR.AlignWith( A );
     D1_MC_STAR.AlignWith( A );
@@ -79,6 +80,7 @@ void SUMMA_NTB
     DistMatrix<T,MR,STAR> A1Trans_MR_STAR(g);
     DistMatrix<T,STAR,MC> D1_STAR_MC(g);
     DistMatrix<T,MR,MC> D1_MR_MC(g);
+    WorkspaceLoan<T> loan( A1Trans_MR_STAR, D1_STAR_MC, D1_MR_MC );
 
     A1Trans_MR_STAR.AlignWith( B );
     D1_STAR_MC.AlignWith( B );
@@ -126,6 +128,7 @@ void SUMMA_NTC
     DistMatrix<T,MC,STAR> A1_MC_STAR(g);
     DistMatrix<T,VR,STAR> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR> B1Trans_STAR_MR(g);
+    WorkspaceLoan<T> loan( A1_MC_STAR, B1_VR_STAR, B1Trans_STAR_MR );
 
     A1_MC_STAR.AlignWith( C );
     B1_VR_STAR.AlignWith( C );
@@ -147,6 +150,34 @@ void SUMMA_NTC
     }
 }
 
+// Normal Transpose Gemm via Cannon's algorithm (after explicitly forming B^T
+// or B^H so that its rows are aligned with C)
+template<typename T>
+void Cannon_NT
+( Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( g.Height() != g.Width() )
+    {
+        // Cannon's algorithm requires a square process grid
+        SUMMA_NTC( orientB, alpha, A, B, CPre );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    DistMatrix<T> BTrans(g);
+    BTrans.AlignRows( C.RowAlign() );
+    Transpose( B, BTrans, orientB==ADJOINT );
+    Cannon_NN( alpha, A, BTrans, C );
+}
+
 // Normal Transpose Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -179,6 +210,7 @@ void SUMMA_NTDot
     auto& C = CProx.Get();
 
     DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceLoan<T> loan( C11_STAR_STAR );
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -249,6 +281,7 @@ void SUMMA_NT
     case GEMM_SUMMA_B: SUMMA_NTB( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_NTC( orientB, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_NTDot( orientB, alpha, A, B, C ); break;
+    case GEMM_CANNON: Cannon_NT( orientB, alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -0,0 +1,183 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+namespace El {
+namespace gemm {
+
+// Stationary-C SUMMA which overlaps the gathering of panel k+1 of A and B
+// with the local update using panel k. Each panel is gathered with a
+// non-blocking AllGather into one of two sets of buffers.
+template<typename T>
+void SUMMA_NNCPipelined
+( T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+#ifndef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SUMMA_NNC( alpha, APre, BPre, CPre );
+#else
+    const Int sumDim = APre.Width();
+    const Int bsize = Blocksize();
+    const Grid& g = APre.Grid();
+
+    // Force A, B, and C to be in [MC,MR] distributions aligned with C
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    ElementalProxyCtrl ctrlA, ctrlB;
+    ctrlA.colConstrain = true; ctrlA.colAlign = C.ColAlign();
+    ctrlB.rowConstrain = true; ctrlB.rowAlign = C.RowAlign();
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre, ctrlA );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre, ctrlB );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+
+    const Int localHeight = C.LocalHeight();
+    const Int localWidth = C.LocalWidth();
+    const Int colStride = g.Height();
+    const Int rowStride = g.Width();
+    mpi::Comm colComm = g.ColComm();
+    mpi::Comm rowComm = g.RowComm();
+
+    // Every process contributes a padded portion of each panel
+    const Int maxPanelWidth = MaxLength( Min(bsize,sumDim), rowStride );
+    const Int maxPanelHeight = MaxLength( Min(bsize,sumDim), colStride );
+    const Int portionSizeA = localHeight*maxPanelWidth;
+    const Int portionSizeB = maxPanelHeight*localWidth;
+
+    vector<T> sendA[2], recvA[2], sendB[2], recvB[2];
+    mpi::Request<T> requestA[2], requestB[2];
+    for( Int buffer=0; buffer<2; ++buffer )
+    {
+        FastResize( sendA[buffer], portionSizeA );
+        FastResize( recvA[buffer], rowStride*portionSizeA );
+        FastResize( sendB[buffer], portionSizeB );
+        FastResize( recvB[buffer], colStride*portionSizeB );
+    }
+
+    // Pack the local portions of panel k of A and B and start gathering them
+    auto startPanel =
+      [&]( Int k, Int buffer )
+      {
+          const Int nb = Min(bsize,sumDim-k);
+          auto A1 = A( ALL, IR(k,k+nb) );
+          auto B1 = B( IR(k,k+nb), ALL );
+
+          T* sendBufA = sendA[buffer].data();
+          const Int A1LocalWidth = A1.LocalWidth();
+          for( Int jLoc=0; jLoc<A1LocalWidth; ++jLoc )
+              MemCopy
+              ( &sendBufA[jLoc*localHeight], A1.LockedBuffer(0,jLoc),
+                localHeight );
+
+          T* sendBufB = sendB[buffer].data();
+          const Int B1LocalHeight = B1.LocalHeight();
+          for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+              MemCopy
+              ( &sendBufB[jLoc*maxPanelHeight], B1.LockedBuffer(0,jLoc),
+                B1LocalHeight );
+
+          mpi::IAllGather
+          ( sendBufA, portionSizeA, recvA[buffer].data(), portionSizeA,
+            rowComm, requestA[buffer] );
+          mpi::IAllGather
+          ( sendBufB, portionSizeB, recvB[buffer].data(), portionSizeB,
+            colComm, requestB[buffer] );
+      };
+
+    DistMatrix<T,MC,STAR> A1_MC_STAR(g);
+    DistMatrix<T,STAR,MR> B1_STAR_MR(g);
+    A1_MC_STAR.AlignWith( C );
+    B1_STAR_MR.AlignWith( C );
+
+    if( sumDim > 0 )
+        startPanel( 0, 0 );
+    for( Int k=0, buffer=0; k<sumDim; k+=bsize, buffer=1-buffer )
+    {
+        const Int nb = Min(bsize,sumDim-k);
+        if( k+nb < sumDim )
+            startPanel( k+nb, 1-buffer );
+
+        // Unpack panel k of A into A1[MC,*], where the portion from process
+        // column q holds the panel columns q owns in A1[MC,MR]
+        const Int A1RowAlign = A( ALL, IR(k,k+nb) ).RowAlign();
+        mpi::Wait( requestA[buffer] );
+        A1_MC_STAR.Resize( A.Height(), nb );
+        auto& A1Loc = A1_MC_STAR.Matrix();
+        for( Int q=0; q<rowStride; ++q )
+        {
+            const T* portion = &recvA[buffer][q*portionSizeA];
+            const Int shift = Shift( q, A1RowAlign, rowStride );
+            const Int width = Length( nb, shift, rowStride );
+            for( Int t=0; t<width; ++t )
+                MemCopy
+                ( A1Loc.Buffer(0,shift+t*rowStride), &portion[t*localHeight],
+                  localHeight );
+        }
+
+        // Unpack panel k of B into B1[*,MR] in the same manner
+        const Int B1ColAlign = B( IR(k,k+nb), ALL ).ColAlign();
+        mpi::Wait( requestB[buffer] );
+        B1_STAR_MR.Resize( nb, B.Width() );
+        auto& B1Loc = B1_STAR_MR.Matrix();
+        for( Int q=0; q<colStride; ++q )
+        {
+            const T* portion = &recvB[buffer][q*portionSizeB];
+            const Int shift = Shift( q, B1ColAlign, colStride );
+            const Int height = Length( nb, shift, colStride );
+            for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+                for( Int t=0; t<height; ++t )
+                    B1Loc(shift+t*colStride,jLoc) =
+                      portion[t+jLoc*maxPanelHeight];
+        }
+
+        // C[MC,MR] += alpha A1[MC,*] B1[*,MR]
+        LocalGemm
+        ( NORMAL, NORMAL, alpha, A1_MC_STAR, B1_STAR_MR, T(1), C );
+    }
+#endif
+}
+
+// Form op(A) and op(B) explicitly (if necessary) so that the pipelined
+// stationary-C algorithm can be used for any orientation
+template<typename T>
+void SUMMA_CPipelined
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& C )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( A, B, C ))
+    const Grid& g = A.Grid();
+    DistMatrix<T> AOp(g), BOp(g);
+    if( orientA != NORMAL )
+    {
+        AOp.AlignCols( C.ColAlign() );
+        Transpose( A, AOp, orientA==ADJOINT );
+    }
+    if( orientB != NORMAL )
+    {
+        BOp.AlignRows( C.RowAlign() );
+        Transpose( B, BOp, orientB==ADJOINT );
+    }
+    SUMMA_NNCPipelined
+    ( alpha,
+      ( orientA == NORMAL ? A : AOp ),
+      ( orientB == NORMAL ? B : BOp ),
+      C );
+}
+
+} // namespace gemm
+} // namespace El
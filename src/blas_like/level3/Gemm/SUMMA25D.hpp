@@ -0,0 +1,167 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// 2.5D matrix multiplication: the p processes are viewed as c layers of
+// two-dimensional meshes of p/c processes. Each layer receives a contiguous
+// slice of the summation dimension of op(A) and op(B), forms its contribution
+// to C with a standard SUMMA algorithm on its mesh, and the contributions are
+// then summed through the depth of the process grid. Relative to SUMMA over
+// all p processes, the volume of communication is reduced by a factor of
+// roughly sqrt(c) in exchange for c copies of C.
+//
+// See Solomonik and Demmel, "Communication-optimal parallel 2.5D matrix
+// multiplication and LU factorization algorithms", Euro-Par, 2011.
+
+namespace El {
+namespace gemm {
+
+// The number of bytes of physical memory on this process's node (zero if this
+// cannot be queried)
+inline double PhysicalMemory()
+{
+#if defined(_SC_PHYS_PAGES) && defined(_SC_PAGESIZE)
+    return double(sysconf(_SC_PHYS_PAGES))*double(sysconf(_SC_PAGESIZE));
+#else
+    return 0;
+#endif
+}
+
+// The number of bytes which each process may devote to the layers: either the
+// budget set with SetGemm25DMemoryBudget or a fraction of the physical memory
+// of the node divided evenly among the processes of the grid on the node
+inline double MemoryBudget25D( const Grid& g )
+{
+    DEBUG_CSE
+    double budget = Gemm25DMemoryBudget();
+    if( budget <= 0 )
+    {
+        // Only a fraction is claimed since the remainder is typically needed
+        // for the operands themselves
+        const double memoryFraction = 0.25;
+        mpi::Comm nodeComm;
+        mpi::SplitShared( g.ViewingComm(), nodeComm );
+        budget = memoryFraction*PhysicalMemory() / mpi::Size(nodeComm);
+        mpi::Free( nodeComm );
+    }
+    return mpi::AllReduce( budget, mpi::MIN, g.ViewingComm() );
+}
+
+// Return the largest number of layers, c, such that c divides p, c^3 <= p
+// (beyond which the layers would no longer be able to reduce communication),
+// and the additional storage fits within the memory budget of every process.
+template<typename T>
+Int NumLayers25D( const Grid& g, Int m, Int n, Int sumDim )
+{
+    DEBUG_CSE
+    const Int p = g.Size();
+    const double budget = MemoryBudget25D( g );
+
+    Int numLayers = 1;
+    for( Int c=2; c*c*c<=p; ++c )
+    {
+        if( p % c != 0 )
+            continue;
+        // Each process stores its share of a slice of op(A) and op(B), its
+        // layer's copy of C, and its share of the summed result
+        const double numEntries =
+          (double(m)*sumDim + double(sumDim)*n + (c+1)*double(m)*n) / p;
+        if( numEntries*sizeof(T) <= budget )
+            numLayers = c;
+    }
+    return numLayers;
+}
+
+template<typename T>
+void SUMMA25D
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& APre,
+  const AbstractDistMatrix<T>& BPre,
+        AbstractDistMatrix<T>& CPre,
+  Int numLayers=0 )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, BPre, CPre ))
+    const Grid& g = APre.Grid();
+    const Int m = CPre.Height();
+    const Int n = CPre.Width();
+    const Int sumDim = ( orientA==NORMAL ? APre.Width() : APre.Height() );
+    const Int p = g.Size();
+    if( numLayers == 0 )
+        numLayers = NumLayers25D<T>( g, m, n, sumDim );
+    if( p % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must divide the number of "
+         "processes, ",p);
+    if( numLayers == 1 )
+    {
+        Gemm( orientA, orientB, alpha, APre, BPre, T(1), CPre );
+        return;
+    }
+
+    DistMatrixReadProxy<T,T,MC,MR> AProx( APre );
+    DistMatrixReadProxy<T,T,MC,MR> BProx( BPre );
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.GetLocked();
+    auto& C = CProx.Get();
+
+    // Layer l owns the processes with owning ranks l*layerSize through
+    // (l+1)*layerSize-1, and every layer is viewed by all of g's viewers so
+    // that data can be translated between g and the layers. The layers are
+    // cached by g, so only the first multiplication over g forms them.
+    const Int layerSize = p / numLayers;
+    const Int myLayer = ( g.InGrid() ? g.OwningRank() / layerSize : -1 );
+    const Grid& myGrid = ( myLayer >= 0 ? g.Layer(numLayers,myLayer) : g );
+
+    // Distribute the slices of the summation dimension over the layers
+    DistMatrix<T> ALayer(myGrid), BLayer(myGrid), CLayer(myGrid);
+    for( Int layer=0; layer<numLayers; ++layer )
+    {
+        const Range<Int>
+          indSum( (layer*sumDim)/numLayers, ((layer+1)*sumDim)/numLayers );
+        const Grid& layerGrid = g.Layer( numLayers, layer );
+        DistMatrix<T> AOther(layerGrid), BOther(layerGrid);
+        auto& ASlice = ( layer == myLayer ? ALayer : AOther );
+        auto& BSlice = ( layer == myLayer ? BLayer : BOther );
+        if( orientA == NORMAL )
+            Copy( A( ALL, indSum ), ASlice );
+        else
+            Copy( A( indSum, ALL ), ASlice );
+        if( orientB == NORMAL )
+            Copy( B( indSum, ALL ), BSlice );
+        else
+            Copy( B( ALL, indSum ), BSlice );
+    }
+
+    // Each layer forms its contribution to C, and the contributions are
+    // summed onto the first layer
+    if( myLayer >= 0 )
+    {
+        Gemm( orientA, orientB, alpha, ALayer, BLayer, CLayer );
+
+        // Processes in the same position of each layer own the same portion
+        // of C, which was freshly allocated and is therefore contiguous
+        auto& CLayerLoc = CLayer.Matrix();
+        mpi::Reduce
+        ( CLayerLoc.Buffer(), CLayerLoc.Height()*CLayerLoc.Width(),
+          0, g.LayerDepthComm(numLayers) );
+    }
+
+    // C += the summed contributions
+    DistMatrix<T> CRootOther(g.Layer(numLayers,0)), CSum(g);
+    CRootOther.Resize( m, n );
+    CSum.AlignWith( C );
+    Copy( ( myLayer == 0 ? CLayer : CRootOther ), CSum );
+    Axpy( T(1), CSum, C );
+}
+
+} // namespace gemm
+} // namespace El
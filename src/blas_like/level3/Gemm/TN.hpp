@@ -35,6 +35,7 @@ void SUMMA_TNA
     DistMatrix<T,MC,STAR> B1_MC_STAR(g);
     DistMatrix<T,MR,STAR> D1_MR_STAR(g);
     DistMatrix<T,MR,MC  > D1_MR_MC(g);
+    WorkspaceLoan<T> loan( B1_MC_STAR, D1_MR_STAR, D1_MR_MC );
 
     B1_MC_STAR.AlignWith( A );
     D1_MR_STAR.AlignWith( A );
@@ -81,6 +82,7 @@ void SUMMA_TNB
     // Temporary distributions
     DistMatrix<T,MC,STAR> A1_MC_STAR(g);
     DistMatrix<T,MR,STAR> D1Trans_MR_STAR(g);
+    WorkspaceLoan<T> loan( A1_MC_STAR, D1Trans_MR_STAR );
 
     A1_MC_STAR.AlignWith( B );
     D1Trans_MR_STAR.AlignWith( B );
@@ -123,6 +125,7 @@ void SUMMA_TNC
     // Temporary distributions
     DistMatrix<T,STAR,MC> A1_STAR_MC(g);
     DistMatrix<T,MR,STAR> B1Trans_MR_STAR(g);
+    WorkspaceLoan<T> loan( A1_STAR_MC, B1Trans_MR_STAR );
 
     A1_STAR_MC.AlignWith( C );
     B1Trans_MR_STAR.AlignWith( C );
@@ -142,6 +145,34 @@ void SUMMA_TNC
     }
 }
 
+// Transpose Normal Gemm via Cannon's algorithm (after explicitly forming A^T
+// or A^H so that its columns are aligned with C)
+template<typename T>
+void Cannon_TN
+( Orientation orientA,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( g.Height() != g.Width() )
+    {
+        // Cannon's algorithm requires a square process grid
+        SUMMA_TNC( orientA, alpha, A, B, CPre );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    DistMatrix<T> ATrans(g);
+    ATrans.AlignCols( C.ColAlign() );
+    Transpose( A, ATrans, orientA==ADJOINT );
+    Cannon_NN( alpha, ATrans, B, C );
+}
+
 // Transpose Normal Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -174,6 +205,7 @@ void SUMMA_TNDot
     auto& C = CProx.Get();
 
     DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceLoan<T> loan( C11_STAR_STAR );
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -244,6 +276,7 @@ void SUMMA_TN
     case GEMM_SUMMA_B: SUMMA_TNB( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_C: SUMMA_TNC( orientA, alpha, A, B, C ); break;
     case GEMM_SUMMA_DOT: SUMMA_TNDot( orientA, alpha, A, B, C ); break;
+    case GEMM_CANNON: Cannon_TN( orientA, alpha, A, B, C ); break;
     default: LogicError("Unsupported Gemm option");
     }
 }
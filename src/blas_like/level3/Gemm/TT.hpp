@@ -36,6 +36,7 @@ void SUMMA_TTA
     DistMatrix<T,STAR,MC  > B1_STAR_MC(g);
     DistMatrix<T,MR,  MC  > D1_MR_MC(g);
     DistMatrix<T,MR,  STAR> D1_MR_STAR(g);
+    WorkspaceLoan<T> loan( B1_STAR_MC, D1_MR_MC, D1_MR_STAR );
 
     B1_STAR_MC.AlignWith( A ); 
     D1_MR_STAR.AlignWith( A );  
@@ -86,6 +87,7 @@ void SUMMA_TTB
     DistMatrix<T,STAR,MR  > A1Trans_STAR_MR(g);
     DistMatrix<T,STAR,MC  > D1_STAR_MC(g);
     DistMatrix<T,MR,  MC  > D1_MR_MC(g);
+    WorkspaceLoan<T> loan( A1_VR_STAR, A1Trans_STAR_MR, D1_STAR_MC, D1_MR_MC );
 
     A1_VR_STAR.AlignWith( B );
     A1Trans_STAR_MR.AlignWith( B );
@@ -136,6 +138,7 @@ void SUMMA_TTC
     DistMatrix<T,STAR,MC  > A1_STAR_MC(g);
     DistMatrix<T,VR,  STAR> B1_VR_STAR(g);
     DistMatrix<T,STAR,MR  > B1Trans_STAR_MR(g);
+    WorkspaceLoan<T> loan( A1_STAR_MC, B1_VR_STAR, B1Trans_STAR_MR );
 
     A1_STAR_MC.AlignWith( C );
     B1_VR_STAR.AlignWith( C );
@@ -158,6 +161,37 @@ void SUMMA_TTC
     }
 }
 
+// Transpose Transpose Gemm via Cannon's algorithm (after explicitly forming
+// op(A) and op(B) so that they are aligned with C)
+template<typename T>
+void Cannon_TT
+( Orientation orientA,
+  Orientation orientB,
+  T alpha,
+  const AbstractDistMatrix<T>& A,
+  const AbstractDistMatrix<T>& B,
+        AbstractDistMatrix<T>& CPre )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    if( g.Height() != g.Width() )
+    {
+        // Cannon's algorithm requires a square process grid
+        SUMMA_TTC( orientA, orientB, alpha, A, B, CPre );
+        return;
+    }
+
+    DistMatrixReadWriteProxy<T,T,MC,MR> CProx( CPre );
+    auto& C = CProx.Get();
+
+    DistMatrix<T> ATrans(g), BTrans(g);
+    ATrans.AlignCols( C.ColAlign() );
+    BTrans.AlignRows( C.RowAlign() );
+    Transpose( A, ATrans, orientA==ADJOINT );
+    Transpose( B, BTrans, orientB==ADJOINT );
+    Cannon_NN( alpha, ATrans, BTrans, C );
+}
+
 // Transpose Transpose Gemm for panel-panel dot products
 //
 // Use summations of local multiplications from a 1D distribution of A and B
@@ -191,6 +225,7 @@ void SUMMA_TTDot
     auto& C = CProx.Get();
 
     DistMatrix<T,STAR,STAR> C11_STAR_STAR(g);
+    WorkspaceLoan<T> loan( C11_STAR_STAR );
     for( Int kOuter=0; kOuter<m; kOuter+=blockSize )
     {
         const Int nbOuter = Min(blockSize,m-kOuter);
@@ -269,6 +304,9 @@ void SUMMA_TT
     case GEMM_SUMMA_DOT:
         SUMMA_TTDot( orientA, orientB, alpha, A, B, C );
         break;
+    case GEMM_CANNON:
+        Cannon_TT( orientA, orientB, alpha, A, B, C );
+        break;
     default: LogicError("Unsupported Gemm option");
     }
 }
@@ -302,149 +302,183 @@ void MultiplyCSR
     }
 }
 
+// Y(rows,:) += alpha A(rows,:) X for a subset of the local rows of A, where
+// nonzero e of A multiplies the (inds[e]-shift)'th row of X
 template<typename T>
-void MultiplyCSRInterX
-( Orientation orientation,
-  Int m, Int n, Int numRHS,
+void MultiplyCSRRows
+( const vector<Int>& rows, Int numRHS,
   T alpha,
   const Int* rowOffsets,
-  const Int* colIndices,
+  const Int* inds, Int shift,
   const T*   values,
-  const T*   X,
-  T beta,
+  const T*   X, Int rowStrideX, Int colStrideX,
         T*   Y, Int ldY )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
-    {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
-    }
-
-    if( orientation == NORMAL )
-    {
-        for( Int i=0; i<m; ++i )
-        {
-            for( Int k=0; k<numRHS; ++k )
-            {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]*numRHS+k];
-                Y[i+k*ldY] = alpha*sum + beta*Y[i+k*ldY];
-            }
-        }
-    }
-    else
+    for( const Int i : rows )
     {
-        const bool conj = ( orientation == ADJOINT );
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
         for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j+k*ldY] *= beta;
-        if( conj )
-        {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
-        }
-        else
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]+k*ldY] += prod*X[i*numRHS+k];         
-                }
-            }
+            T sum = 0;
+            for( Int e=eStart; e<eStop; ++e )
+                sum += values[e]*X[(inds[e]-shift)*rowStrideX+k*colStrideX];
+            Y[i+k*ldY] += alpha*sum;
         }
     }
 }
 
+// Y += alpha op(A(rows,:)) X(rows,:) for a subset of the local rows of A,
+// where nonzero e of A updates the (inds[e]-shift)'th row of Y
 template<typename T>
-void MultiplyCSRInterY
+void MultiplyCSRRowsAdjoint
 ( Orientation orientation,
-  Int m, Int n, Int numRHS,
+  const vector<Int>& rows, Int numRHS,
   T alpha,
   const Int* rowOffsets,
-  const Int* colIndices,
+  const Int* inds, Int shift,
   const T*   values,
   const T*   X, Int ldX,
-  T beta,
-        T*   Y )
+        T*   Y, Int rowStrideY, Int colStrideY )
 {
     DEBUG_CSE
-    if( numRHS == 1 )
+    const bool conj = ( orientation == ADJOINT );
+    for( const Int i : rows )
     {
-        MultiplyCSR
-        ( orientation, m, n, alpha, 
-          rowOffsets, colIndices, values, X, beta, Y );
-        return;
+        const Int eStart = rowOffsets[i];
+        const Int eStop = rowOffsets[i+1];
+        for( Int e=eStart; e<eStop; ++e )
+        {
+            const T prod = alpha*( conj ? Conj(values[e]) : values[e] );
+            T* y = &Y[(inds[e]-shift)*rowStrideY];
+            for( Int k=0; k<numRHS; ++k )
+                y[k*colStrideY] += prod*X[i+k*ldX];
+        }
     }
+}
+
+// Y += alpha op(A) X, where A is in the SELL-C-sigma format and the rows
+// (columns) of X and Y are accessed with the given strides. In the normal
+// case, the chunks are distributed over threads and the rows of each chunk
+// are processed in SIMD lanes. Since the scatters of the transposed case
+// may collide, it is threaded over the right-hand sides when there are
+// enough of them and otherwise over blocks of chunks, each of which
+// accumulates into a private buffer.
+template<typename T>
+void MultiplySELL
+( Orientation orientation,
+  T alpha,
+  const SELLMatrix<T>& A,
+  const T* X, Int rowStrideX, Int colStrideX,
+  Int numRHS,
+        T* Y, Int rowStrideY, Int colStrideY )
+{
+    DEBUG_CSE
+    const Int chunkSize = A.ChunkSize();
+    const Int numChunks = A.NumChunks();
+    const Int* rows = A.LockedRowBuffer();
+    const Int* lengths = A.LockedLengthBuffer();
+    const Int* chunkOffs = A.LockedChunkOffsetBuffer();
+    const Int* cols = A.LockedColBuffer();
+    const T* values = A.LockedValueBuffer();
 
     if( orientation == NORMAL )
     {
-        for( Int i=0; i<m; ++i )
+        EL_PARALLEL_FOR
+        for( Int c=0; c<numChunks; ++c )
         {
-            for( Int k=0; k<numRHS; ++k )
+            const Int chunkOff = chunkOffs[c];
+            const Int chunkWidth = (chunkOffs[c+1]-chunkOff) / chunkSize;
+            const Int* chunkRows = &rows[c*chunkSize];
+            const Int* chunkLengths = &lengths[c*chunkSize];
+            T sums[SELL_MAX_CHUNK_SIZE];
+            for( Int t=0; t<numRHS; ++t )
             {
-                T sum = 0;
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                    sum += values[e]*X[colIndices[e]+k*ldX];
-                Y[i*numRHS+k] = alpha*sum + beta*Y[i*numRHS+k];
+                const T* x = &X[t*colStrideX];
+                for( Int r=0; r<chunkSize; ++r )
+                    sums[r] = 0;
+                for( Int k=0; k<chunkWidth; ++k )
+                {
+                    const Int* colsK = &cols[chunkOff+k*chunkSize];
+                    const T* valuesK = &values[chunkOff+k*chunkSize];
+                    // Mask out the padding rather than multiplying it by
+                    // a (possibly non-finite) entry of x
+                    EL_SIMD
+                    for( Int r=0; r<chunkSize; ++r )
+                        sums[r] +=
+                          ( k < chunkLengths[r] ?
+                            valuesK[r]*x[colsK[r]*rowStrideX] : T(0) );
+                }
+                for( Int r=0; r<chunkSize; ++r )
+                    if( chunkRows[r] >= 0 )
+                        Y[chunkRows[r]*rowStrideY+t*colStrideY] +=
+                          alpha*sums[r];
             }
         }
+        return;
+    }
+
+    const bool conj = ( orientation == ADJOINT );
+    // y += alpha op(A(rows of chunks [cBeg,cEnd),:))^T x
+    auto scatter =
+      [&]( Int cBeg, Int cEnd, const T* x, T* y, Int strideY )
+      {
+          for( Int c=cBeg; c<cEnd; ++c )
+          {
+              const Int chunkOff = chunkOffs[c];
+              for( Int r=0; r<chunkSize; ++r )
+              {
+                  const Int i = rows[c*chunkSize+r];
+                  const Int length = lengths[c*chunkSize+r];
+                  if( i < 0 )
+                      continue;
+                  const T alphaX = alpha*x[i*rowStrideX];
+                  for( Int k=0; k<length; ++k )
+                  {
+                      const Int s = chunkOff + k*chunkSize + r;
+                      const T value = ( conj ? Conj(values[s]) : values[s] );
+                      y[cols[s]*strideY] += value*alphaX;
+                  }
+              }
+          }
+      };
+
+    Int numThreads = 1;
+#ifdef EL_HYBRID
+    numThreads = omp_get_max_threads();
+#endif
+    const Int numBlocks = Min( numThreads, numChunks );
+    if( numRHS >= numThreads || numBlocks <= 1 )
+    {
+        EL_PARALLEL_FOR
+        for( Int t=0; t<numRHS; ++t )
+            scatter
+            ( 0, numChunks, &X[t*colStrideX], &Y[t*colStrideY], rowStrideY );
     }
     else
     {
-        const bool conj = ( orientation == ADJOINT );
-        for( Int k=0; k<numRHS; ++k )
-            for( Int j=0; j<n; ++j )
-                Y[j*numRHS+k] *= beta;
-        if( conj )
+        const Int width = A.Width();
+        vector<T> partials( numBlocks*numRHS*width, T(0) );
+        EL_PARALLEL_FOR
+        for( Int b=0; b<numBlocks; ++b )
         {
-            for( Int i=0; i<m; ++i )
-            {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*Conj(values[e]);
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
-            }
+            const Int cBeg = (b*numChunks) / numBlocks;
+            const Int cEnd = ((b+1)*numChunks) / numBlocks;
+            for( Int t=0; t<numRHS; ++t )
+                scatter
+                ( cBeg, cEnd, &X[t*colStrideX],
+                  &partials[(b*numRHS+t)*width], 1 );
         }
-        else
-        {
-            for( Int i=0; i<m; ++i )
+        EL_PARALLEL_FOR
+        for( Int j=0; j<width; ++j )
+            for( Int t=0; t<numRHS; ++t )
             {
-                const Int eStart = rowOffsets[i];
-                const Int eStop = rowOffsets[i+1];
-                for( Int e=eStart; e<eStop; ++e )
-                {
-                    T prod = alpha*values[e];
-                    for( Int k=0; k<numRHS; ++k )
-                        Y[colIndices[e]*numRHS+k] += prod*X[i+k*ldX];         
-                }
+                T sum = 0;
+                for( Int b=0; b<numBlocks; ++b )
+                    sum += partials[(b*numRHS+t)*width+j];
+                Y[j*rowStrideY+t*colStrideY] += sum;
             }
-        }
     }
 }
 
@@ -521,6 +555,60 @@ void MultiplyCSRInter
     }
 }
 
+// Begin exchanging the rows of a multivector of width b described by the
+// sizes and offsets of the multiplication metadata (which are in units of
+// rows). Only the neighboring processes are involved, so that the cost
+// scales with the number of neighbors rather than the size of the
+// communicator. Messages which exceed mpi::MaxMessageCount() entries are
+// split into several pieces, which arrive in order.
+template<typename T,typename Count>
+void StartRowExchange
+( const T* sendVals,
+  const vector<int>& sendNeighbors,
+  const vector<Count>& sendSizes, const vector<Count>& sendOffs,
+        T* recvVals,
+  const vector<int>& recvNeighbors,
+  const vector<Count>& recvSizes, const vector<Count>& recvOffs,
+  Int b, mpi::Comm comm, vector<mpi::Request<T>>& requests )
+{
+    DEBUG_CSE
+    const Int maxCount = mpi::MaxMessageCount();
+    Int numRequests = 0;
+    for( const int q : recvNeighbors )
+        numRequests += (recvSizes[q]*b+maxCount-1) / maxCount;
+    for( const int q : sendNeighbors )
+        numRequests += (sendSizes[q]*b+maxCount-1) / maxCount;
+    requests.resize( numRequests );
+
+    Int numPosted = 0;
+    for( const int q : recvNeighbors )
+    {
+        const Int size = recvSizes[q]*b;
+        const Int off = recvOffs[q]*b;
+        for( Int k=0; k<size; k+=maxCount )
+            mpi::IRecv
+            ( &recvVals[off+k], Min(maxCount,size-k), q, comm,
+              requests[numPosted++] );
+    }
+    for( const int q : sendNeighbors )
+    {
+        const Int size = sendSizes[q]*b;
+        const Int off = sendOffs[q]*b;
+        for( Int k=0; k<size; k+=maxCount )
+            mpi::ISend
+            ( &sendVals[off+k], Min(maxCount,size-k), q, comm,
+              requests[numPosted++] );
+    }
+}
+
+template<typename T>
+void FinishRowExchange( vector<mpi::Request<T>>& requests )
+{
+    DEBUG_CSE
+    mpi::WaitAll( requests.size(), requests.data() );
+    requests.clear();
+}
+
 } // anonymous namespace
 
 template<typename T>
@@ -563,11 +651,16 @@ void Multiply
 }
 
 
+namespace {
+
+// If ASELL is non-null, its SELL-C-sigma kernels are used in place of the
+// CSR data of A
 template<typename T>
-void Multiply
+void DistMultiply
 ( Orientation orientation, 
         T alpha, 
   const DistSparseMatrix<T>& A,
+  const DistSELLMatrix<T>* ASELL,
   const DistMultiVec<T>& X,
         T beta,
         DistMultiVec<T>& Y )
@@ -584,7 +677,6 @@ void Multiply
     const bool time = false;
 
     mpi::Comm comm = A.Comm();
-    const int commSize = mpi::Size( comm );
     const int commRank = mpi::Rank( comm );
     // TODO: Use sequential implementation if commSize = 1?
 
@@ -597,19 +689,7 @@ void Multiply
 
     A.InitializeMultMeta();
     const auto& meta = A.LockedDistGraph().multMeta;
-    // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    vector<int> recvSizes=meta.recvSizes,
-                recvOffs=meta.recvOffs,
-                sendSizes=meta.sendSizes,
-                sendOffs=meta.sendOffs;
-    for( int q=0; q<commSize; ++q )
-    {
-        recvSizes[q] *= b;    
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
-    }
 
     if( orientation == NORMAL )
     {
@@ -633,24 +713,57 @@ void Multiply
                 sendVals[s*b+t] = XBuffer[iLoc+t*ldX];
         }
 
-        // Now send them
+        // Start sending them
         vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
+        vector<mpi::Request<T>> requests;
+        StartRowExchange
+        ( sendVals.data(),
+          meta.sendNeighbors, meta.sendSizes, meta.sendOffs,
+          recvVals.data(),
+          meta.recvNeighbors, meta.recvSizes, meta.recvOffs,
+          b, comm, requests );
+
+        // Perform the local multiply-accumulate, y := alpha A x + y, for the
+        // rows which only depend upon our portion of x while the remainder
+        // of x is in flight
+        if( time && commRank == 0 )
+            timer.Start();
+        T* YBuffer = Y.Matrix().Buffer();
+        const Int ldY = Y.Matrix().LDim();
+        if( ASELL == nullptr )
+            MultiplyCSRRows
+            ( meta.interiorRows, b,
+              alpha, A.LockedOffsetBuffer(),
+                     A.LockedTargetBuffer(), firstLocalRow,
+                     A.LockedValueBuffer(),
+                     XBuffer, 1, ldX,
+                     YBuffer, ldY );
+        else
+            MultiplySELL
+            ( NORMAL, alpha, ASELL->Interior(),
+              XBuffer, 1, ldX, b, YBuffer, 1, ldY );
+        if( time && commRank == 0 )
+            Output("  Interior multiply time: ",timer.Stop());
+
+        FinishRowExchange( requests );
+
+        // Now handle the rows which required remote portions of x
         if( time && commRank == 0 )
             timer.Start();
-        MultiplyCSRInterX
-        ( NORMAL, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(), 
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 recvVals.data(), 
-          T(1),  Y.Matrix().Buffer(), Y.Matrix().LDim() );
+        if( ASELL == nullptr )
+            MultiplyCSRRows
+            ( meta.boundaryRows, b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(), Int(0),
+                     A.LockedValueBuffer(),
+                     recvVals.data(), b, 1,
+                     YBuffer, ldY );
+        else
+            MultiplySELL
+            ( NORMAL, alpha, ASELL->Boundary(),
+              recvVals.data(), b, 1, b, YBuffer, 1, ldY );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterX time: ",timer.Stop());
+            Output("  Boundary multiply time: ",timer.Stop());
     }
     else
     {
@@ -659,32 +772,65 @@ void Multiply
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
 
-        // Form and pack the updates to Y
+        // Form and pack the updates to Y from the rows which update remote
+        // portions of Y
         if( time && commRank == 0 )
             timer.Start();
+        const T* XBuffer = X.LockedMatrix().LockedBuffer();
+        const Int ldX = X.LockedMatrix().LDim();
         vector<T> sendVals( meta.numRecvInds*b, 0 );
-        MultiplyCSRInterY
-        ( orientation, A.LocalHeight(), meta.numRecvInds, b,
-          alpha, A.LockedOffsetBuffer(),
-                 meta.colOffs.data(),
-                 A.LockedValueBuffer(),
-                 X.LockedMatrix().LockedBuffer(), X.LockedMatrix().LDim(),
-          T(1),  sendVals.data() );
+        if( ASELL == nullptr )
+            MultiplyCSRRowsAdjoint
+            ( orientation, meta.boundaryRows, b,
+              alpha, A.LockedOffsetBuffer(),
+                     meta.colOffs.data(), Int(0),
+                     A.LockedValueBuffer(),
+                     XBuffer, ldX,
+                     sendVals.data(), b, 1 );
+        else
+            MultiplySELL
+            ( orientation, alpha, ASELL->Boundary(),
+              XBuffer, 1, ldX, b, sendVals.data(), b, 1 );
         if( time && commRank == 0 )
-            Output("  MultiplyCSRInterY time: ",timer.Stop());
+            Output("  Boundary multiply time: ",timer.Stop());
 
-        // Inject the updates to Y into the network
+        // Start injecting the updates to Y into the network
         const Int numRecvInds = meta.sendInds.size();
         vector<T> recvVals;
         FastResize( recvVals, numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
-     
-        // Accumulate the received indices onto Y
+        vector<mpi::Request<T>> requests;
+        StartRowExchange
+        ( sendVals.data(),
+          meta.recvNeighbors, meta.recvSizes, meta.recvOffs,
+          recvVals.data(),
+          meta.sendNeighbors, meta.sendSizes, meta.sendOffs,
+          b, comm, requests );
+
+        // Directly accumulate the updates from the rows which only touch
+        // our portion of Y while the other updates are in flight
+        if( time && commRank == 0 )
+            timer.Start();
         const Int firstLocalRow = Y.FirstLocalRow();
         T* YBuffer = Y.Matrix().Buffer(); 
         const Int ldY = Y.Matrix().LDim();
+        if( ASELL == nullptr )
+            MultiplyCSRRowsAdjoint
+            ( orientation, meta.interiorRows, b,
+              alpha, A.LockedOffsetBuffer(),
+                     A.LockedTargetBuffer(), firstLocalRow,
+                     A.LockedValueBuffer(),
+                     XBuffer, ldX,
+                     YBuffer, 1, ldY );
+        else
+            MultiplySELL
+            ( orientation, alpha, ASELL->Interior(),
+              XBuffer, 1, ldX, b, YBuffer, 1, ldY );
+        if( time && commRank == 0 )
+            Output("  Interior multiply time: ",timer.Stop());
+
+        FinishRowExchange( requests );
+
+        // Accumulate the received indices onto Y
         for( Int s=0; s<numRecvInds; ++s )
         {
             const Int i = meta.sendInds[s];
@@ -697,6 +843,359 @@ void Multiply
         Output("Multiply total time: ",totalTimer.Stop());
 }
 
+} // anonymous namespace
+
+template<typename T>
+void Multiply
+( Orientation orientation,
+  T alpha, const SELLMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                Matrix<T>& Y )
+{
+    DEBUG_CSE
+    const Int m = ( orientation == NORMAL ? A.Height() : A.Width() );
+    const Int n = ( orientation == NORMAL ? A.Width() : A.Height() );
+    if( X.Height() != n || Y.Height() != m || X.Width() != Y.Width() )
+        LogicError("Nonconformal SELL Multiply");
+    Scale( beta, Y );
+    MultiplySELL
+    ( orientation, alpha, A,
+      X.LockedBuffer(), 1, X.LDim(), X.Width(), Y.Buffer(), 1, Y.LDim() );
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation, 
+        T alpha, 
+  const DistSparseMatrix<T>& A,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y )
+{
+    DEBUG_CSE
+    DistMultiply
+    ( orientation, alpha, A, static_cast<const DistSELLMatrix<T>*>(nullptr),
+      X, beta, Y );
+}
+
+template<typename T>
+void Multiply
+( Orientation orientation, 
+        T alpha, 
+  const DistSparseMatrix<T>& A,
+  const DistSELLMatrix<T>& ASELL,
+  const DistMultiVec<T>& X,
+        T beta,
+        DistMultiVec<T>& Y )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( ASELL.Interior().Height() != A.LocalHeight() ||
+          ASELL.Interior().NumEntries()+ASELL.Boundary().NumEntries() !=
+          A.NumLocalEntries() )
+          LogicError("The SELL copy does not match the sparse matrix");
+    )
+    DistMultiply( orientation, alpha, A, &ASELL, X, beta, Y );
+}
+
+void MultiplySymbolic
+( const DistGraph& A, const DistGraph& B, DistSparseMultiplyPlan& plan,
+  bool diagonal, bool onlyLower )
+{
+    DEBUG_CSE
+    if( A.NumTargets() != B.NumSources() )
+        LogicError
+        ("Nonconformal sparse-sparse multiply: ",
+         A.NumSources()," x ",A.NumTargets()," times ",
+         B.NumSources()," x ",B.NumTargets());
+    if( !mpi::Congruent( A.Comm(), B.Comm() ) )
+        LogicError("Communicators of A and B must match");
+    A.AssertLocallyConsistent();
+    B.AssertLocallyConsistent();
+    mpi::Comm comm = A.Comm();
+    const int commSize = mpi::Size( comm );
+
+    plan.Clear();
+    plan.height = A.NumSources();
+    plan.width = B.NumTargets();
+    plan.diagonal = diagonal;
+    plan.onlyLower = onlyLower;
+    plan.numLocalEntriesA = A.NumLocalEdges();
+    plan.numLocalEntriesB = B.NumLocalEdges();
+
+    // Compute the (sorted) set of rows of B that we need, which are the
+    // unique columns of our rows of A
+    const Int numLocalEntriesA = A.NumLocalEdges();
+    const Int* colBufA = A.LockedTargetBuffer();
+    vector<ValueInt<Int>> uniqueCols(numLocalEntriesA);
+    for( Int e=0; e<numLocalEntriesA; ++e )
+        uniqueCols[e] = ValueInt<Int>{colBufA[e],e};
+    std::sort( uniqueCols.begin(), uniqueCols.end(), ValueInt<Int>::Lesser );
+    plan.fetchInds.resize( numLocalEntriesA );
+    {
+        Int uniqueOff=-1, lastUnique=-1;
+        for( Int e=0; e<numLocalEntriesA; ++e )
+        {
+            if( lastUnique != uniqueCols[e].value )
+            {
+                ++uniqueOff;
+                lastUnique = uniqueCols[e].value;
+                uniqueCols[uniqueOff] = uniqueCols[e];
+            }
+            plan.fetchInds[uniqueCols[e].index] = uniqueOff;
+        }
+        uniqueCols.resize( uniqueOff+1 );
+    }
+    const Int numFetched = uniqueCols.size();
+
+    // Request the rows from their owners
+    // ==================================
+    vector<Int> fetchedRows( numFetched );
+    vector<int> recvRowSizes( commSize, 0 );
+    for( Int r=0; r<numFetched; ++r )
+    {
+        fetchedRows[r] = uniqueCols[r].value;
+        ++recvRowSizes[B.SourceOwner(fetchedRows[r])];
+    }
+    vector<int> recvRowOffs, sendRowSizes(commSize), sendRowOffs;
+    Scan( recvRowSizes, recvRowOffs );
+    mpi::AllToAll( recvRowSizes.data(), 1, sendRowSizes.data(), 1, comm );
+    const int numSendRows = Scan( sendRowSizes, sendRowOffs );
+    plan.sendRows.resize( numSendRows );
+    mpi::AllToAll
+    ( fetchedRows.data(),    recvRowSizes.data(), recvRowOffs.data(),
+      plan.sendRows.data(),  sendRowSizes.data(), sendRowOffs.data(), comm );
+
+    // Return the lengths of the requested rows
+    // ========================================
+    const Int firstLocalSourceB = B.FirstLocalSource();
+    const Int* offsetBufB = B.LockedOffsetBuffer();
+    vector<Int> sendLengths( numSendRows );
+    plan.sendSizes.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        plan.sendSizes[q] = 0;
+        for( Int r=sendRowOffs[q]; r<sendRowOffs[q]+sendRowSizes[q]; ++r )
+        {
+            const Int kLoc = plan.sendRows[r] - firstLocalSourceB;
+            plan.sendRows[r] = kLoc;
+            sendLengths[r] = offsetBufB[kLoc+1] - offsetBufB[kLoc];
+            plan.sendSizes[q] += sendLengths[r];
+        }
+    }
+    vector<Int> recvLengths( numFetched );
+    mpi::AllToAll
+    ( sendLengths.data(), sendRowSizes.data(), sendRowOffs.data(),
+      recvLengths.data(), recvRowSizes.data(), recvRowOffs.data(), comm );
+
+    plan.fetchedOffsets.resize( numFetched+1 );
+    plan.fetchedOffsets[0] = 0;
+    for( Int r=0; r<numFetched; ++r )
+        plan.fetchedOffsets[r+1] = plan.fetchedOffsets[r] + recvLengths[r];
+    plan.recvSizes.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+        plan.recvSizes[q] =
+          plan.fetchedOffsets[recvRowOffs[q]+recvRowSizes[q]] -
+          plan.fetchedOffsets[recvRowOffs[q]];
+    const Int totalSend = Scan( plan.sendSizes, plan.sendOffs );
+    const Int totalRecv = Scan( plan.recvSizes, plan.recvOffs );
+    for( int q=0; q<commSize; ++q )
+    {
+        if( plan.sendSizes[q] != 0 )
+            plan.sendNeighbors.push_back( q );
+        if( plan.recvSizes[q] != 0 )
+            plan.recvNeighbors.push_back( q );
+    }
+
+    // Fetch the column indices of the requested rows
+    // ==============================================
+    const Int* colBufB = B.LockedTargetBuffer();
+    vector<Int> sendCols( totalSend );
+    {
+        Int off = 0;
+        for( const Int kLoc : plan.sendRows )
+            for( Int e=offsetBufB[kLoc]; e<offsetBufB[kLoc+1]; ++e )
+                sendCols[off++] = colBufB[e];
+    }
+    plan.fetchedCols.resize( totalRecv );
+    vector<mpi::Request<Int>> requests;
+    StartRowExchange
+    ( sendCols.data(),
+      plan.sendNeighbors, plan.sendSizes, plan.sendOffs,
+      plan.fetchedCols.data(),
+      plan.recvNeighbors, plan.recvSizes, plan.recvOffs,
+      Int(1), comm, requests );
+    FinishRowExchange( requests );
+
+    // Form the sparsity pattern of our rows of C using Gustavson's algorithm
+    // ======================================================================
+    const Int localHeight = A.NumLocalSources();
+    const Int firstLocalSourceA = A.FirstLocalSource();
+    const Int* offsetBufA = A.LockedOffsetBuffer();
+
+    // The dense map over the columns need only span the fetched columns
+    // (and our diagonal) rather than the entire width of C
+    Int lastCol = -1;
+    plan.firstCol = plan.width;
+    for( const Int j : plan.fetchedCols )
+    {
+        plan.firstCol = Min( plan.firstCol, j );
+        lastCol = Max( lastCol, j );
+    }
+    if( diagonal && localHeight > 0 && firstLocalSourceA < plan.width )
+    {
+        plan.firstCol = Min( plan.firstCol, firstLocalSourceA );
+        lastCol =
+          Max( lastCol, Min(firstLocalSourceA+localHeight,plan.width)-1 );
+    }
+    plan.numCols = Max( lastCol-plan.firstCol+1, Int(0) );
+
+    vector<Int> marker( plan.numCols, -1 );
+    plan.offsets.resize( localHeight+1 );
+    plan.offsets[0] = 0;
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalSourceA + iLoc;
+        const Int rowStart = plan.cols.size();
+        if( diagonal && i < plan.width )
+        {
+            marker[i-plan.firstCol] = iLoc;
+            plan.cols.push_back( i );
+        }
+        for( Int e=offsetBufA[iLoc]; e<offsetBufA[iLoc+1]; ++e )
+        {
+            const Int r = plan.fetchInds[e];
+            for( Int f=plan.fetchedOffsets[r]; f<plan.fetchedOffsets[r+1]; ++f )
+            {
+                const Int j = plan.fetchedCols[f];
+                if( marker[j-plan.firstCol] != iLoc && (!onlyLower || j <= i) )
+                {
+                    marker[j-plan.firstCol] = iLoc;
+                    plan.cols.push_back( j );
+                }
+            }
+        }
+        std::sort( plan.cols.begin()+rowStart, plan.cols.end() );
+        plan.offsets[iLoc+1] = plan.cols.size();
+    }
+    plan.ready = true;
+}
+
+template<typename T>
+void MultiplyNumeric
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+  const DistSparseMultiplyPlan& plan,
+        DistSparseMatrix<T>& C )
+{
+    DEBUG_CSE
+    if( !plan.ready )
+        LogicError("The sparse-sparse multiply plan was not initialized");
+    if( A.Height() != plan.height || B.Width() != plan.width ||
+        A.NumLocalEntries() != plan.numLocalEntriesA ||
+        B.NumLocalEntries() != plan.numLocalEntriesB )
+        LogicError("The sparsity patterns of A and B do not match the plan");
+    mpi::Comm comm = A.Comm();
+
+    // Start fetching the values of the requested rows of B
+    // ====================================================
+    const Int* offsetBufB = B.LockedOffsetBuffer();
+    const T* valBufB = B.LockedValueBuffer();
+    const Int totalSend = plan.sendOffs.back() + plan.sendSizes.back();
+    const Int totalRecv = plan.recvOffs.back() + plan.recvSizes.back();
+    vector<T> sendVals( totalSend ), fetchedVals( totalRecv );
+    {
+        Int off = 0;
+        for( const Int kLoc : plan.sendRows )
+            for( Int e=offsetBufB[kLoc]; e<offsetBufB[kLoc+1]; ++e )
+                sendVals[off++] = valBufB[e];
+    }
+    vector<mpi::Request<T>> requests;
+    StartRowExchange
+    ( sendVals.data(),
+      plan.sendNeighbors, plan.sendSizes, plan.sendOffs,
+      fetchedVals.data(),
+      plan.recvNeighbors, plan.recvSizes, plan.recvOffs,
+      Int(1), comm, requests );
+
+    // Meanwhile, ensure that C has the sparsity pattern of the plan
+    // =============================================================
+    const Int localHeight = A.LocalHeight();
+    const Int numLocalEntriesC = plan.cols.size();
+    bool matches =
+      C.Height() == plan.height && C.Width() == plan.width &&
+      mpi::Congruent( C.Comm(), comm ) &&
+      C.LocallyConsistent() &&
+      C.NumLocalEntries() == numLocalEntriesC;
+    if( matches )
+    {
+        const Int* offsetBufC = C.LockedOffsetBuffer();
+        const Int* colBufC = C.LockedTargetBuffer();
+        for( Int iLoc=0; iLoc<=localHeight; ++iLoc )
+            if( offsetBufC[iLoc] != plan.offsets[iLoc] )
+                matches = false;
+        for( Int e=0; e<numLocalEntriesC; ++e )
+            if( colBufC[e] != plan.cols[e] )
+                matches = false;
+    }
+    if( !matches )
+    {
+        if( C.FrozenSparsity() )
+            LogicError("Cannot restructure C since its sparsity is frozen");
+        if( !mpi::Congruent( C.Comm(), comm ) )
+            C.SetComm( comm );
+        C.Resize( plan.height, plan.width );
+        C.Reserve( numLocalEntriesC );
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            for( Int e=plan.offsets[iLoc]; e<plan.offsets[iLoc+1]; ++e )
+                C.QueueLocalUpdate( iLoc, plan.cols[e], T(0) );
+        C.ProcessLocalQueues();
+    }
+
+    FinishRowExchange( requests );
+
+    // Accumulate each row of C using a dense map from its column indices to
+    // their positions in the value buffer
+    // =====================================================================
+    const Int* offsetBufA = A.LockedOffsetBuffer();
+    const T* valBufA = A.LockedValueBuffer();
+    T* valBufC = C.ValueBuffer();
+    vector<Int> positions( plan.numCols );
+    const Int firstLocalRow = A.FirstLocalRow();
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+    {
+        const Int i = firstLocalRow + iLoc;
+        for( Int s=plan.offsets[iLoc]; s<plan.offsets[iLoc+1]; ++s )
+        {
+            positions[plan.cols[s]-plan.firstCol] = s;
+            valBufC[s] = 0;
+        }
+        for( Int e=offsetBufA[iLoc]; e<offsetBufA[iLoc+1]; ++e )
+        {
+            const T alpha = valBufA[e];
+            const Int r = plan.fetchInds[e];
+            for( Int f=plan.fetchedOffsets[r]; f<plan.fetchedOffsets[r+1]; ++f )
+            {
+                const Int j = plan.fetchedCols[f];
+                if( !plan.onlyLower || j <= i )
+                    valBufC[positions[j-plan.firstCol]] +=
+                      alpha*fetchedVals[f];
+            }
+        }
+    }
+}
+
+template<typename T>
+void Multiply
+( const DistSparseMatrix<T>& A,
+  const DistSparseMatrix<T>& B,
+        DistSparseMatrix<T>& C )
+{
+    DEBUG_CSE
+    DistSparseMultiplyPlan plan;
+    MultiplySymbolic( A.LockedDistGraph(), B.LockedDistGraph(), plan );
+    MultiplyNumeric( A, B, plan, C );
+}
+
 #define PROTO(T) \
     template void Multiply \
     ( Orientation orientation, \
@@ -718,7 +1217,31 @@ void Multiply
       const DistSparseMatrix<T>& A, \
       const DistMultiVec<T>& X, \
             T beta, \
-            DistMultiVec<T>& Y );
+            DistMultiVec<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const SELLMatrix<T>& A, \
+      const Matrix<T>& X, \
+            T beta, \
+            Matrix<T>& Y ); \
+    template void Multiply \
+    ( Orientation orientation, \
+            T alpha, \
+      const DistSparseMatrix<T>& A, \
+      const DistSELLMatrix<T>& ASELL, \
+      const DistMultiVec<T>& X, \
+            T beta, \
+            DistMultiVec<T>& Y ); \
+    template void MultiplyNumeric \
+    ( const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+      const DistSparseMultiplyPlan& plan, \
+            DistSparseMatrix<T>& C ); \
+    template void Multiply \
+    ( const DistSparseMatrix<T>& A, \
+      const DistSparseMatrix<T>& B, \
+            DistSparseMatrix<T>& C );
 
 #define EL_ENABLE_DOUBLEDOUBLE
 #define EL_ENABLE_QUADDOUBLE
@@ -36,6 +36,7 @@ void LLNLarge
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceLoan<F> loan( L11_STAR_STAR, L21_MC_STAR, X1_STAR_MR, X1_STAR_VR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -90,6 +91,7 @@ void LLNMedium
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MC,  STAR> L21_MC_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceLoan<F> loan( L11_STAR_STAR, L21_MC_STAR, X1Trans_MR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -141,6 +143,7 @@ void LLNSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    WorkspaceLoan<F> loan( L11_STAR_STAR, X1_STAR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -43,6 +43,7 @@ void LLTLarge
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceLoan<F> loan( L10_STAR_MC, L11_STAR_STAR, X1_STAR_MR, X1_STAR_VR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -105,6 +106,7 @@ void LLTMedium
     DistMatrix<F,STAR,MC  > L10_STAR_MC(g);
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceLoan<F> loan( L10_STAR_MC, L11_STAR_STAR, X1Trans_MR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -168,6 +170,7 @@ void LLTSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), Z1_STAR_STAR(g);
+    WorkspaceLoan<F> loan( L11_STAR_STAR, Z1_STAR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -221,6 +224,7 @@ void LLTSmall
     const Grid& g = L.Grid();
 
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g), X1_STAR_STAR(g);
+    WorkspaceLoan<F> loan( L11_STAR_STAR, X1_STAR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -35,6 +35,7 @@ void LUNLarge
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceLoan<F> loan( U01_MC_STAR, U11_STAR_STAR, X1_STAR_MR, X1_STAR_VR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -89,6 +90,7 @@ void LUNMedium
     DistMatrix<F,MC,  STAR> U01_MC_STAR(g);
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceLoan<F> loan( U01_MC_STAR, U11_STAR_STAR, X1Trans_MR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -145,6 +147,7 @@ void LUNSmall
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g);
+    WorkspaceLoan<F> loan( U11_STAR_STAR, X1_STAR_STAR );
 
     const Int kLast = LastOffset( m, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -43,6 +43,7 @@ void LUTLarge
     DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
     DistMatrix<F,STAR,MR  > X1_STAR_MR(g);
     DistMatrix<F,STAR,VR  > X1_STAR_VR(g);
+    WorkspaceLoan<F> loan( U11_STAR_STAR, U12_STAR_MC, X1_STAR_MR, X1_STAR_VR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -104,6 +105,7 @@ void LUTMedium
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g); 
     DistMatrix<F,STAR,MC  > U12_STAR_MC(g);
     DistMatrix<F,MR,  STAR> X1Trans_MR_STAR(g);
+    WorkspaceLoan<F> loan( U11_STAR_STAR, U12_STAR_MC, X1Trans_MR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
@@ -166,6 +168,7 @@ void LUTSmall
     const Grid& g = U.Grid();
 
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g), X1_STAR_STAR(g); 
+    WorkspaceLoan<F> loan( U11_STAR_STAR, X1_STAR_STAR );
 
     for( Int k=0; k<m; k+=bsize )
     {
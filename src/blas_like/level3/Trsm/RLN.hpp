@@ -37,6 +37,8 @@ void RLN
     DistMatrix<F,STAR,STAR> L11_STAR_STAR(g);
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
+    WorkspaceLoan<F> loan
+    ( L10Trans_MR_STAR, L11_STAR_STAR, X1Trans_STAR_MC, X1_VC_STAR );
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
@@ -42,6 +42,9 @@ void RLT
     DistMatrix<F,STAR,MR  > L21Trans_STAR_MR(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceLoan<F> loan
+    ( L11_STAR_STAR, L21_VR_STAR, L21Trans_STAR_MR,
+      X1_VC_STAR, X1Trans_STAR_MC );
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -34,6 +34,8 @@ void RUN
     DistMatrix<F,STAR,MR  > U12_STAR_MR(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);    
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceLoan<F> loan
+    ( U11_STAR_STAR, U12_STAR_MR, X1_VC_STAR, X1Trans_STAR_MC );
 
     for( Int k=0; k<n; k+=bsize )
     {
@@ -42,6 +42,9 @@ void RUT
     DistMatrix<F,STAR,STAR> U11_STAR_STAR(g);
     DistMatrix<F,VC,  STAR> X1_VC_STAR(g);
     DistMatrix<F,STAR,MC  > X1Trans_STAR_MC(g);
+    WorkspaceLoan<F> loan
+    ( U01_VR_STAR, U01Trans_STAR_MR, U11_STAR_STAR,
+      X1_VC_STAR, X1Trans_STAR_MC );
 
     const Int kLast = LastOffset( n, bsize );
     for( Int k=kLast; k>=0; k-=bsize )
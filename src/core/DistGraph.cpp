@@ -748,6 +748,40 @@ DistGraphMultMeta DistGraph::InitializeMultMeta() const
       meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(),
       comm );
 
+    meta.sendNeighbors.clear();
+    meta.recvNeighbors.clear();
+    for( int q=0; q<commSize; ++q )
+    {
+        if( meta.sendSizes[q] != 0 )
+            meta.sendNeighbors.push_back( q );
+        if( meta.recvSizes[q] != 0 )
+            meta.recvNeighbors.push_back( q );
+    }
+
+    // Classify the local sources by whether all of their targets are owned
+    // by this process
+    const Int firstLocalTarget = commRank_*vecBlocksize;
+    const Int* offsetBuffer = LockedOffsetBuffer();
+    meta.interiorRows.clear();
+    meta.boundaryRows.clear();
+    for( Int iLoc=0; iLoc<NumLocalSources(); ++iLoc )
+    {
+        bool interior = true;
+        for( Int e=offsetBuffer[iLoc]; e<offsetBuffer[iLoc+1]; ++e )
+        {
+            const Int j = colBuffer[e];
+            if( j < firstLocalTarget || j >= firstLocalTarget+vecBlocksize )
+            {
+                interior = false;
+                break;
+            }
+        }
+        if( interior )
+            meta.interiorRows.push_back( iLoc );
+        else
+            meta.boundaryRows.push_back( iLoc );
+    }
+
     meta.numRecvInds = numRecvInds;
     meta.ready = true;
 
@@ -223,6 +223,9 @@ Grid::~Grid()
             mpi::Free( cartComm_ );
             mpi::Free( owningComm_ );
         }
+        if( InGrid() )
+            for( auto& layering : layerings_ )
+                mpi::Free( layering.depthComm );
         mpi::Free( viewingComm_ );
         if( HaveViewers() )
             mpi::Free( owningGroup_ );
@@ -410,6 +413,58 @@ int Grid::DiagRank( int vcRank ) const EL_NO_EXCEPT
         return mpi::UNDEFINED;
 }
 
+const Grid& Grid::Layer( int numLayers, int layer ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( layer < 0 || layer >= numLayers )
+          LogicError("Layer ",layer," is out of bounds of ",numLayers);
+    )
+    return *FormLayering( numLayers ).layers[layer];
+}
+
+mpi::Comm Grid::LayerDepthComm( int numLayers ) const
+{
+    DEBUG_CSE
+    return FormLayering( numLayers ).depthComm;
+}
+
+const Grid::Layering& Grid::FormLayering( int numLayers ) const
+{
+    DEBUG_CSE
+    for( const auto& layering : layerings_ )
+        if( layering.numLayers == numLayers )
+            return layering;
+    if( numLayers < 1 || size_ % numLayers != 0 )
+        LogicError
+        ("The number of layers, ",numLayers,", must divide the number of "
+         "processes, ",size_);
+
+    Layering layering;
+    layering.numLayers = numLayers;
+    const int layerSize = size_ / numLayers;
+    const int layerHeight = FindFactor( layerSize );
+    vector<int> layerRanks( layerSize );
+    for( int layer=0; layer<numLayers; ++layer )
+    {
+        for( int q=0; q<layerSize; ++q )
+            layerRanks[q] = layer*layerSize + q;
+        mpi::Group layerGroup;
+        mpi::Incl( owningGroup_, layerSize, layerRanks.data(), layerGroup );
+        layering.layers.emplace_back
+        ( new Grid( viewingComm_, layerGroup, layerHeight, order_ ) );
+        mpi::Free( layerGroup );
+    }
+    if( inGrid_ )
+        mpi::Split
+        ( owningComm_, owningRank_ % layerSize, owningRank_ / layerSize,
+          layering.depthComm );
+    else
+        layering.depthComm = mpi::COMM_NULL;
+    layerings_.push_back( std::move(layering) );
+    return layerings_.back();
+}
+
 // Comparison functions
 // ====================
 
@@ -0,0 +1,320 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <atomic>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#ifdef __linux__
+# include <sys/mman.h>
+#endif
+
+namespace El {
+
+namespace {
+
+// Every block handed out by the allocator is preceded by a header which
+// records how the block was allocated so that it can be consistently freed
+// even if the policy was changed in the mean time.
+struct BlockHeader
+{
+    void* raw;
+    size_t classBytes;
+    size_t offset;
+    bool pooled;
+};
+
+const size_t minOffset = 64;
+static_assert
+( sizeof(BlockHeader) <= minOffset, "BlockHeader is unexpectedly large" );
+
+const size_t hugePageSize = size_t(2) << 20;
+
+// Only the free lists (and the statistics which describe them) are guarded
+// by the mutex, so that the standard and aligned policies never lock. The
+// settings and the counters which every allocation touches are atomic.
+struct PoolState
+{
+    std::atomic<MemoryPolicy> policy{MEMORY_ALIGNED};
+    std::atomic<size_t> alignment{64};
+    std::atomic<size_t> limit{size_t(1) << 30};
+
+    std::atomic<size_t> numRequests{0};
+    std::atomic<size_t> numMisses{0};
+    std::atomic<size_t> liveBytes{0};
+    std::atomic<size_t> peakLiveBytes{0};
+
+    // Map from the (rounded) block size to the cached blocks of that size
+    std::map<size_t,vector<BlockHeader*>> freeLists;
+
+    // Only the hit, eviction, and cached-byte counts are maintained here
+    MemoryPoolStatistics stats;
+    std::mutex mutex;
+};
+
+// Memory<G> instances with static storage duration may be destroyed after
+// any function-local static, so the state is intentionally never freed
+PoolState& State()
+{
+    static PoolState* state = new PoolState;
+    return *state;
+}
+
+// Round up to one of { 2^k, 1.25 2^k, 1.5 2^k, 1.75 2^k } so that at most
+// 25% of each pooled block is wasted
+size_t SizeClass( size_t numBytes )
+{
+    if( numBytes <= minOffset )
+        return minOffset;
+    size_t power = 1;
+    while( 2*power < numBytes )
+        power *= 2;
+    const size_t quarter = power / 4;
+    size_t classBytes = power;
+    while( classBytes < numBytes )
+        classBytes += quarter;
+    return classBytes;
+}
+
+BlockHeader* HeaderOf( void* ptr )
+{ return reinterpret_cast<BlockHeader*>(static_cast<char*>(ptr)-minOffset); }
+
+void* BufferOf( BlockHeader* header )
+{ return static_cast<char*>(header->raw) + header->offset; }
+
+BlockHeader* SystemAllocate
+( size_t classBytes, size_t alignment, bool aligned )
+{
+    // The header always directly precedes the buffer, so the offset must be
+    // a multiple of the alignment which is at least the header size
+    const size_t offset =
+      ( aligned ? std::max(alignment,minOffset) : minOffset );
+    const size_t totalBytes = offset + classBytes;
+    void* raw = nullptr;
+    if( aligned )
+    {
+        const size_t align = std::max(alignment,sizeof(void*));
+        if( posix_memalign( &raw, align, totalBytes ) != 0 )
+            raw = nullptr;
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+        if( raw != nullptr && alignment >= hugePageSize )
+            madvise( raw, totalBytes, MADV_HUGEPAGE );
+#endif
+    }
+    else
+        raw = std::malloc( totalBytes );
+    if( raw == nullptr )
+        throw std::bad_alloc();
+
+    BlockHeader* header =
+      reinterpret_cast<BlockHeader*>
+      (static_cast<char*>(raw)+offset-minOffset);
+    header->raw = raw;
+    header->classBytes = classBytes;
+    header->offset = offset;
+    header->pooled = false;
+    return header;
+}
+
+void SystemFree( BlockHeader* header )
+{ std::free( header->raw ); }
+
+void UpdateLive( PoolState& state, size_t numBytes )
+{
+    const size_t liveBytes = state.liveBytes += numBytes;
+    size_t peakLiveBytes = state.peakLiveBytes;
+    while( liveBytes > peakLiveBytes &&
+           !state.peakLiveBytes.compare_exchange_weak
+            ( peakLiveBytes, liveBytes ) ) { }
+}
+
+} // anonymous namespace
+
+void SetMemoryPolicy( MemoryPolicy policy )
+{ State().policy = policy; }
+
+MemoryPolicy GetMemoryPolicy()
+{ return State().policy; }
+
+void SetMemoryAlignment( size_t alignment )
+{
+    if( alignment == 0 || (alignment & (alignment-1)) != 0 )
+        LogicError("Memory alignment must be a power of two");
+    PoolState& state = State();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    if( alignment != state.alignment )
+    {
+        // Cached blocks may no longer satisfy the requested alignment
+        for( auto& entry : state.freeLists )
+            for( BlockHeader* header : entry.second )
+            {
+                state.stats.cachedBytes -= header->classBytes;
+                SystemFree( header );
+            }
+        state.freeLists.clear();
+        state.alignment = alignment;
+    }
+}
+
+size_t GetMemoryAlignment()
+{ return State().alignment; }
+
+void SetMemoryPoolLimit( size_t numBytes )
+{
+    PoolState& state = State();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    state.limit = numBytes;
+    // Evict the largest blocks first until we are back under the limit
+    auto it = state.freeLists.end();
+    while( state.stats.cachedBytes > state.limit &&
+           it != state.freeLists.begin() )
+    {
+        --it;
+        auto& blocks = it->second;
+        while( !blocks.empty() && state.stats.cachedBytes > state.limit )
+        {
+            state.stats.cachedBytes -= blocks.back()->classBytes;
+            SystemFree( blocks.back() );
+            blocks.pop_back();
+            ++state.stats.numEvictions;
+        }
+    }
+}
+
+size_t GetMemoryPoolLimit()
+{ return State().limit; }
+
+void EmptyMemoryPool()
+{
+    PoolState& state = State();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    for( auto& entry : state.freeLists )
+        for( BlockHeader* header : entry.second )
+            SystemFree( header );
+    state.freeLists.clear();
+    state.stats.cachedBytes = 0;
+}
+
+MemoryPoolStatistics GetMemoryPoolStatistics()
+{
+    PoolState& state = State();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    MemoryPoolStatistics stats = state.stats;
+    stats.numRequests = state.numRequests;
+    stats.numMisses = state.numMisses;
+    stats.liveBytes = state.liveBytes;
+    stats.peakLiveBytes = state.peakLiveBytes;
+    return stats;
+}
+
+void ResetMemoryPoolStatistics()
+{
+    PoolState& state = State();
+    std::lock_guard<std::mutex> guard(state.mutex);
+    MemoryPoolStatistics stats;
+    stats.cachedBytes = state.stats.cachedBytes;
+    stats.peakCachedBytes = state.stats.cachedBytes;
+    state.stats = stats;
+    state.numRequests = 0;
+    state.numMisses = 0;
+    state.peakLiveBytes = size_t(state.liveBytes);
+}
+
+void PrintMemoryPoolStatistics( ostream& os )
+{
+    const MemoryPoolStatistics stats = GetMemoryPoolStatistics();
+    os << "Memory pool statistics:\n"
+       << "  Requests:          " << stats.numRequests << "\n"
+       << "  Hits:              " << stats.numHits << "\n"
+       << "  Misses:            " << stats.numMisses << "\n"
+       << "  Hit rate:          " << stats.HitRate() << "\n"
+       << "  Evictions:         " << stats.numEvictions << "\n"
+       << "  Cached bytes:      " << stats.cachedBytes << "\n"
+       << "  Peak cached bytes: " << stats.peakCachedBytes << "\n"
+       << "  Live bytes:        " << stats.liveBytes << "\n"
+       << "  Peak live bytes:   " << stats.peakLiveBytes << "\n"
+       << endl;
+}
+
+namespace memory {
+
+void* AllocateBytes( size_t numBytes )
+{
+    PoolState& state = State();
+    ++state.numRequests;
+
+    BlockHeader* header = nullptr;
+    const MemoryPolicy policy = state.policy;
+    if( policy == MEMORY_POOLED )
+    {
+        const size_t classBytes = SizeClass( numBytes );
+        size_t alignment;
+        {
+            std::lock_guard<std::mutex> guard(state.mutex);
+            alignment = state.alignment;
+            auto it = state.freeLists.find( classBytes );
+            if( it != state.freeLists.end() && !it->second.empty() )
+            {
+                header = it->second.back();
+                it->second.pop_back();
+                state.stats.cachedBytes -= classBytes;
+                ++state.stats.numHits;
+            }
+        }
+        if( header == nullptr )
+        {
+            header = SystemAllocate( classBytes, alignment, true );
+            ++state.numMisses;
+        }
+        header->pooled = true;
+    }
+    else
+    {
+        const bool aligned = ( policy == MEMORY_ALIGNED );
+        header = SystemAllocate( numBytes, state.alignment, aligned );
+        ++state.numMisses;
+    }
+    UpdateLive( state, header->classBytes );
+    return BufferOf( header );
+}
+
+void FreeBytes( void* ptr ) EL_NO_EXCEPT
+{
+    if( ptr == nullptr )
+        return;
+    BlockHeader* header = HeaderOf( ptr );
+
+    PoolState& state = State();
+    state.liveBytes -= header->classBytes;
+    if( header->pooled && state.policy == MEMORY_POOLED )
+    {
+        std::lock_guard<std::mutex> guard(state.mutex);
+        if( header->offset == std::max(size_t(state.alignment),minOffset) &&
+            state.stats.cachedBytes+header->classBytes <= state.limit )
+        {
+            try
+            {
+                state.freeLists[header->classBytes].push_back( header );
+                state.stats.cachedBytes += header->classBytes;
+                state.stats.peakCachedBytes =
+                  std::max
+                  ( state.stats.peakCachedBytes, state.stats.cachedBytes );
+                return;
+            }
+            catch( std::bad_alloc& e ) { }
+        }
+        ++state.stats.numEvictions;
+    }
+    SystemFree( header );
+}
+
+} // namespace memory
+
+} // namespace El
@@ -0,0 +1,290 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+namespace El {
+
+// SELLMatrix
+// ==========
+
+template<typename T>
+SELLMatrix<T>::SELLMatrix() { }
+
+template<typename T>
+SELLMatrix<T>::SELLMatrix
+( const SparseMatrix<T>& A, Int chunkSize, Int sortScope )
+{ Build( A, chunkSize, sortScope ); }
+
+template<typename T>
+void SELLMatrix<T>::Empty()
+{
+    height_ = 0;
+    width_ = 0;
+    numEntries_ = 0;
+    SwapClear( rows_ );
+    SwapClear( lengths_ );
+    SwapClear( chunkOffsets_ );
+    SwapClear( cols_ );
+    SwapClear( sources_ );
+    SwapClear( vals_ );
+}
+
+template<typename T>
+void SELLMatrix<T>::Build
+( const SparseMatrix<T>& A, Int chunkSize, Int sortScope )
+{
+    DEBUG_CSE
+    A.AssertConsistent();
+    const Int height = A.Height();
+    vector<Int> rows(height);
+    for( Int i=0; i<height; ++i )
+        rows[i] = i;
+    Build
+    ( height, A.Width(), rows,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), 0,
+      A.LockedValueBuffer(), chunkSize, sortScope );
+}
+
+template<typename T>
+void SELLMatrix<T>::UpdateValues( const SparseMatrix<T>& A )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.NumEntries() != numEntries_ )
+          LogicError("The sparsity pattern has changed; rebuild instead");
+    )
+    UpdateValues( A.LockedValueBuffer() );
+}
+
+template<typename T>
+void SELLMatrix<T>::Build
+( Int height, Int width,
+  const vector<Int>& rows,
+  const Int* rowOffsets,
+  const Int* inds, Int shift,
+  const T* values,
+  Int chunkSize, Int sortScope )
+{
+    DEBUG_CSE
+    if( chunkSize < 1 || chunkSize > SELL_MAX_CHUNK_SIZE )
+        LogicError
+        ("Chunk size must be in [1,",SELL_MAX_CHUNK_SIZE,"], not ",chunkSize);
+    if( sortScope < 1 )
+        LogicError("Sorting scope must be positive");
+    height_ = height;
+    width_ = width;
+    chunkSize_ = chunkSize;
+    sortScope_ = sortScope;
+
+    // Sort the rows by decreasing length within each window so that the
+    // rows of a chunk have similar lengths
+    const Int numRows = rows.size();
+    auto rowLength =
+      [&]( Int i ) { return rowOffsets[i+1] - rowOffsets[i]; };
+    vector<Int> sortedRows( rows );
+    for( Int off=0; off<numRows; off+=sortScope )
+    {
+        const Int windowEnd = Min( off+sortScope, numRows );
+        std::stable_sort
+        ( sortedRows.begin()+off, sortedRows.begin()+windowEnd,
+          [&]( Int i, Int j ) { return rowLength(i) > rowLength(j); } );
+    }
+
+    const Int numChunks = (numRows+chunkSize-1) / chunkSize;
+    rows_.resize( numChunks*chunkSize );
+    lengths_.resize( numChunks*chunkSize );
+    chunkOffsets_.resize( numChunks+1 );
+    chunkOffsets_[0] = 0;
+    numEntries_ = 0;
+    for( Int c=0; c<numChunks; ++c )
+    {
+        Int chunkWidth = 0;
+        for( Int r=0; r<chunkSize; ++r )
+        {
+            const Int k = c*chunkSize + r;
+            if( k < numRows )
+            {
+                rows_[k] = sortedRows[k];
+                lengths_[k] = rowLength(sortedRows[k]);
+                chunkWidth = Max( chunkWidth, lengths_[k] );
+                numEntries_ += lengths_[k];
+            }
+            else
+            {
+                rows_[k] = -1;
+                lengths_[k] = 0;
+            }
+        }
+        chunkOffsets_[c+1] = chunkOffsets_[c] + chunkWidth*chunkSize;
+    }
+
+    // Padding is stored as explicit zeros in the last column of its row (or
+    // the first column for empty rows) so that reading the padded entries
+    // stays within the row's footprint; the kernels mask them out, as an
+    // Inf or NaN in the padded column would otherwise pollute the row
+    const Int numStored = chunkOffsets_[numChunks];
+    cols_.resize( numStored );
+    sources_.resize( numStored );
+    for( Int c=0; c<numChunks; ++c )
+    {
+        const Int chunkOff = chunkOffsets_[c];
+        const Int chunkWidth = (chunkOffsets_[c+1]-chunkOff) / chunkSize;
+        for( Int r=0; r<chunkSize; ++r )
+        {
+            const Int i = rows_[c*chunkSize+r];
+            const Int length = lengths_[c*chunkSize+r];
+            const Int padCol =
+              ( length > 0 ? inds[rowOffsets[i]+length-1]-shift : 0 );
+            for( Int k=0; k<chunkWidth; ++k )
+            {
+                const Int s = chunkOff + k*chunkSize + r;
+                if( k < length )
+                {
+                    const Int e = rowOffsets[i] + k;
+                    cols_[s] = inds[e] - shift;
+                    sources_[s] = e;
+                }
+                else
+                {
+                    cols_[s] = padCol;
+                    sources_[s] = -1;
+                }
+            }
+        }
+    }
+    UpdateValues( values );
+}
+
+template<typename T>
+void SELLMatrix<T>::UpdateValues( const T* values )
+{
+    DEBUG_CSE
+    const Int numStored = sources_.size();
+    vals_.resize( numStored );
+    for( Int s=0; s<numStored; ++s )
+        vals_[s] = ( sources_[s] >= 0 ? values[sources_[s]] : T(0) );
+}
+
+template<typename T>
+Int SELLMatrix<T>::Height() const EL_NO_EXCEPT { return height_; }
+template<typename T>
+Int SELLMatrix<T>::Width() const EL_NO_EXCEPT { return width_; }
+template<typename T>
+Int SELLMatrix<T>::ChunkSize() const EL_NO_EXCEPT { return chunkSize_; }
+template<typename T>
+Int SELLMatrix<T>::SortScope() const EL_NO_EXCEPT { return sortScope_; }
+
+template<typename T>
+Int SELLMatrix<T>::NumChunks() const EL_NO_EXCEPT
+{ return Max( Int(chunkOffsets_.size())-1, Int(0) ); }
+
+template<typename T>
+Int SELLMatrix<T>::NumEntries() const EL_NO_EXCEPT { return numEntries_; }
+
+template<typename T>
+Int SELLMatrix<T>::NumStoredEntries() const EL_NO_EXCEPT
+{ return vals_.size(); }
+
+template<typename T>
+const Int* SELLMatrix<T>::LockedRowBuffer() const EL_NO_EXCEPT
+{ return rows_.data(); }
+template<typename T>
+const Int* SELLMatrix<T>::LockedLengthBuffer() const EL_NO_EXCEPT
+{ return lengths_.data(); }
+template<typename T>
+const Int* SELLMatrix<T>::LockedChunkOffsetBuffer() const EL_NO_EXCEPT
+{ return chunkOffsets_.data(); }
+template<typename T>
+const Int* SELLMatrix<T>::LockedColBuffer() const EL_NO_EXCEPT
+{ return cols_.data(); }
+template<typename T>
+const T* SELLMatrix<T>::LockedValueBuffer() const EL_NO_EXCEPT
+{ return vals_.data(); }
+
+// DistSELLMatrix
+// ==============
+
+template<typename T>
+DistSELLMatrix<T>::DistSELLMatrix() { }
+
+template<typename T>
+DistSELLMatrix<T>::DistSELLMatrix
+( const DistSparseMatrix<T>& A, Int chunkSize, Int sortScope )
+{ Build( A, chunkSize, sortScope ); }
+
+template<typename T>
+void DistSELLMatrix<T>::Empty()
+{
+    interior_.Empty();
+    boundary_.Empty();
+}
+
+template<typename T>
+void DistSELLMatrix<T>::Build
+( const DistSparseMatrix<T>& A, Int chunkSize, Int sortScope )
+{
+    DEBUG_CSE
+    A.InitializeMultMeta();
+    const auto& meta = A.LockedDistGraph().multMeta;
+
+    // The targets of the interior rows are owned by this process, so we
+    // can convert them into local indices of the multivector
+    const Int commSize = mpi::Size( A.Comm() );
+    const Int commRank = mpi::Rank( A.Comm() );
+    const Int width = A.Width();
+    Int vecBlocksize = width / commSize;
+    if( vecBlocksize*commSize < width || width == 0 )
+        ++vecBlocksize;
+    const Int firstLocalTarget = commRank*vecBlocksize;
+    const Int localWidth =
+      Max( Min(vecBlocksize,width-firstLocalTarget), Int(0) );
+
+    interior_.Build
+    ( A.LocalHeight(), localWidth, meta.interiorRows,
+      A.LockedOffsetBuffer(), A.LockedTargetBuffer(), firstLocalTarget,
+      A.LockedValueBuffer(), chunkSize, sortScope );
+    boundary_.Build
+    ( A.LocalHeight(), meta.numRecvInds, meta.boundaryRows,
+      A.LockedOffsetBuffer(), meta.colOffs.data(), 0,
+      A.LockedValueBuffer(), chunkSize, sortScope );
+}
+
+template<typename T>
+void DistSELLMatrix<T>::UpdateValues( const DistSparseMatrix<T>& A )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.NumLocalEntries() !=
+          interior_.NumEntries()+boundary_.NumEntries() )
+          LogicError("The sparsity pattern has changed; rebuild instead");
+    )
+    interior_.UpdateValues( A.LockedValueBuffer() );
+    boundary_.UpdateValues( A.LockedValueBuffer() );
+}
+
+template<typename T>
+const SELLMatrix<T>& DistSELLMatrix<T>::Interior() const EL_NO_EXCEPT
+{ return interior_; }
+
+template<typename T>
+const SELLMatrix<T>& DistSELLMatrix<T>::Boundary() const EL_NO_EXCEPT
+{ return boundary_; }
+
+#define PROTO(T) \
+  template class SELLMatrix<T>; \
+  template class DistSELLMatrix<T>;
+
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGINT
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,123 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El-lite.hpp>
+
+#include <algorithm>
+
+namespace {
+
+// The arena is per-thread (see Workspace.hpp)
+thread_local El::Int numWorkspaceScopes = 0;
+thread_local size_t workspaceMaxBytes = 0;
+thread_local El::WorkspaceStatistics workspaceStats;
+thread_local El::vector<void(*)()> workspaceClears;
+
+void UpdatePeak( El::WorkspaceStatistics& stats )
+{
+    stats.peakBytes =
+      std::max( stats.peakBytes, stats.cachedBytes+stats.loanedBytes );
+}
+
+}
+
+namespace El {
+
+WorkspaceScope::WorkspaceScope( size_t maxBytes )
+: oldMaxBytes_(::workspaceMaxBytes)
+{
+    if( ::numWorkspaceScopes == 0 )
+    {
+        ::workspaceStats = WorkspaceStatistics();
+        ::workspaceMaxBytes = maxBytes;
+    }
+    else
+        ::workspaceMaxBytes = std::min( ::workspaceMaxBytes, maxBytes );
+    ++::numWorkspaceScopes;
+}
+
+WorkspaceScope::~WorkspaceScope()
+{
+    --::numWorkspaceScopes;
+    ::workspaceMaxBytes = oldMaxBytes_;
+    if( ::numWorkspaceScopes == 0 )
+    {
+        for( auto clear : ::workspaceClears )
+            clear();
+        ::workspaceClears.clear();
+        ::workspaceStats.cachedBytes = 0;
+        ::workspaceStats.loanedBytes = 0;
+    }
+}
+
+bool WorkspaceActive()
+{ return ::numWorkspaceScopes > 0; }
+
+WorkspaceStatistics GetWorkspaceStatistics()
+{ return ::workspaceStats; }
+
+void PrintWorkspaceStatistics( ostream& os )
+{
+    const WorkspaceStatistics& stats = ::workspaceStats;
+    os << "Workspace statistics:\n"
+       << "  Borrows:      " << stats.numBorrows << "\n"
+       << "  Returns:      " << stats.numReturns << "\n"
+       << "  Evictions:    " << stats.numEvictions << "\n"
+       << "  Cached bytes: " << stats.cachedBytes << "\n"
+       << "  Loaned bytes: " << stats.loanedBytes << "\n"
+       << "  Peak bytes:   " << stats.peakBytes << "\n"
+       << "  Byte limit:   " << ::workspaceMaxBytes << "\n"
+       << endl;
+}
+
+namespace workspace {
+
+size_t MaxBytes()
+{ return ::workspaceMaxBytes; }
+
+void RegisterClear( void (*clear)() )
+{
+    auto& clears = ::workspaceClears;
+    if( std::find( clears.begin(), clears.end(), clear ) == clears.end() )
+        clears.push_back( clear );
+}
+
+void RecordBorrow( size_t bytes )
+{
+    auto& stats = ::workspaceStats;
+    ++stats.numBorrows;
+    stats.cachedBytes -= bytes;
+    stats.loanedBytes += bytes;
+    ::UpdatePeak( stats );
+}
+
+bool RecordReturn( size_t loanedBytes, size_t returnedBytes )
+{
+    auto& stats = ::workspaceStats;
+    stats.loanedBytes -= loanedBytes;
+    if( returnedBytes == 0 )
+        return false;
+    ++stats.numReturns;
+    const size_t totalBytes =
+      stats.cachedBytes + stats.loanedBytes + returnedBytes;
+    if( totalBytes > ::workspaceMaxBytes )
+    {
+        ++stats.numEvictions;
+        return false;
+    }
+    stats.cachedBytes += returnedBytes;
+    ::UpdatePeak( stats );
+    return true;
+}
+
+void RecordRelease( size_t bytes )
+{ ::workspaceStats.cachedBytes -= bytes; }
+
+} // namespace workspace
+
+} // namespace El
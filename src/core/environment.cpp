@@ -232,6 +232,9 @@ void Finalize()
 #endif
 
         FinalizeRandom();
+
+        // Return any cached blocks to the system
+        EmptyMemoryPool();
     }
 
     DEBUG_ONLY( CloseLog() )
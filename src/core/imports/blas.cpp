@@ -12,6 +12,8 @@ using El::BlasInt;
 using El::scomplex;
 using El::dcomplex;
 
+#include "./blas/Big.hpp"
+
 // Level 1
 #include "./blas/Axpy.hpp"
 #include "./blas/Copy.hpp"
@@ -32,6 +34,7 @@ using El::dcomplex;
 #include "./blas/Trsv.hpp"
 
 // Level 3
+#include "./blas/Blocked.hpp"
 #include "./blas/Gemm.hpp"
 #include "./blas/Symm.hpp"
 #include "./blas/Syrk.hpp"
@@ -130,5 +130,31 @@ void Axpy
         dcomplex* y, BlasInt incy )
 { EL_BLAS(zaxpy)( &n, &alpha, x, &incx, y, &incy ); }
 
+#ifdef EL_HAVE_MPC
+void Axpy
+( BlasInt n,
+  const BigInt& alpha,
+  const BigInt* x, BlasInt incx,
+        BigInt* y, BlasInt incy )
+{
+    for( BlasInt i=0; i<n; ++i )
+        mpz_addmul
+        ( y[i*incy].Pointer(), alpha.LockedPointer(),
+          x[i*incx].LockedPointer() );
+}
+void Axpy
+( BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* x, BlasInt incx,
+        BigFloat* y, BlasInt incy )
+{
+    const mpfr_rnd_t round = mpfr::RoundingMode();
+    for( BlasInt i=0; i<n; ++i )
+        mpfr_fma
+        ( y[i*incy].Pointer(), alpha.LockedPointer(),
+          x[i*incx].LockedPointer(), y[i*incy].LockedPointer(), round );
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -0,0 +1,256 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Support for the BigInt and BigFloat overloads of the BLAS. Each of their
+// inner loops is a single fused GMP/MPFR call (e.g., mpz_addmul or mpfr_fma)
+// acting directly on the operands, and any scratch values come from a
+// thread-local pool which persists between calls, so that, once the pool is
+// warm (and the precision fixed), no memory is allocated at all.
+
+#ifdef EL_HAVE_MPC
+namespace El {
+namespace blas {
+namespace big {
+
+// Return (a pointer to) at least 'size' thread-local scratch values with the
+// given precision (which is ignored for BigInt). The values are only valid
+// until the next request.
+template<typename T>
+T* Scratch( BlasInt size, mpfr_prec_t prec );
+
+template<>
+inline BigInt* Scratch( BlasInt size, mpfr_prec_t )
+{
+    static thread_local vector<BigInt> pool;
+    if( BlasInt(pool.size()) < size )
+        pool.resize( size );
+    return pool.data();
+}
+
+template<>
+inline BigFloat* Scratch( BlasInt size, mpfr_prec_t prec )
+{
+    static thread_local vector<BigFloat> pool;
+    if( BlasInt(pool.size()) < size )
+        pool.resize( size );
+    for( BlasInt i=0; i<size; ++i )
+        if( pool[i].Precision() != prec )
+            pool[i].SetPrecision( prec );
+    return pool.data();
+}
+
+// The precision of a scratch product of the two operands, so that it is not
+// silently rounded to the default precision when they carry more
+inline mpfr_prec_t ProductPrecision( const BigInt&, const BigInt& )
+{ return mpfr::Precision(); }
+inline mpfr_prec_t
+ProductPrecision( const BigFloat& alpha, const BigFloat& beta )
+{ return Max( alpha.Precision(), beta.Precision() ); }
+
+// gamma := alpha beta
+inline void Mul( BigInt& gamma, const BigInt& alpha, const BigInt& beta )
+{ mpz_mul( gamma.Pointer(), alpha.LockedPointer(), beta.LockedPointer() ); }
+inline void Mul( BigFloat& gamma, const BigFloat& alpha, const BigFloat& beta )
+{
+    mpfr_mul
+    ( gamma.Pointer(), alpha.LockedPointer(), beta.LockedPointer(),
+      mpfr::RoundingMode() );
+}
+
+// gamma += alpha beta (with a single rounding in the case of BigFloat)
+inline void MultiplyAdd
+( BigInt& gamma, const BigInt& alpha, const BigInt& beta )
+{ mpz_addmul( gamma.Pointer(), alpha.LockedPointer(), beta.LockedPointer() ); }
+inline void MultiplyAdd
+( BigFloat& gamma, const BigFloat& alpha, const BigFloat& beta )
+{
+    mpfr_fma
+    ( gamma.Pointer(), alpha.LockedPointer(), beta.LockedPointer(),
+      gamma.LockedPointer(), mpfr::RoundingMode() );
+}
+
+// Comparisons which avoid constructing the constants
+inline bool IsZero( const BigInt& alpha )
+{ return mpz_sgn( alpha.LockedPointer() ) == 0; }
+inline bool IsZero( const BigFloat& alpha )
+{ return mpfr_zero_p( alpha.LockedPointer() ) != 0; }
+inline bool IsOne( const BigInt& alpha )
+{ return mpz_cmp_ui( alpha.LockedPointer(), 1 ) == 0; }
+inline bool IsOne( const BigFloat& alpha )
+{ return mpfr_cmp_ui( alpha.LockedPointer(), 1 ) == 0; }
+
+// y := beta y
+template<typename T>
+void Scale( BlasInt n, const T& beta, T* y, BlasInt incy )
+{
+    if( IsZero(beta) )
+    {
+        for( BlasInt i=0; i<n; ++i )
+            y[i*incy] = 0;
+    }
+    else if( !IsOne(beta) )
+    {
+        for( BlasInt i=0; i<n; ++i )
+            y[i*incy] *= beta;
+    }
+}
+
+// The number of entries, each with the given number of limbs, which fit
+// within (a conservative estimate of) the L2 cache. Since the limbs of a
+// BigInt or BigFloat are stored apart from the object itself, both are
+// accounted for, so that higher precisions lead to smaller blocks.
+template<typename T>
+BlasInt CacheCapacity( size_t numLimbs )
+{
+    const size_t entrySize = sizeof(T) + numLimbs*sizeof(mp_limb_t);
+    return Max( BlasInt(1), BlasInt(262144/entrySize) );
+}
+
+// Choose the dimensions of a block which fits within the L2 cache and is as
+// square as the maximum dimensions allow
+template<typename T>
+void CacheBlocksizes
+( size_t numLimbs, BlasInt maxHeight, BlasInt maxWidth,
+  BlasInt& height, BlasInt& width )
+{
+    const BlasInt capacity = CacheCapacity<T>( numLimbs );
+    const BlasInt squareDim = BlasInt(std::sqrt(double(capacity)));
+    width = Max( BlasInt(1), Min( maxWidth, squareDim ) );
+    height = Max( BlasInt(1), Min( maxHeight, capacity/width ) );
+}
+
+// y := alpha op(A) x + beta y, where op(A) is either A or A^T (since the
+// conjugate of a real number is trivial)
+template<typename T>
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* x, BlasInt incx,
+  const T& beta,
+        T* y, BlasInt incy )
+{
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const BlasInt xLength = ( normal ? n : m );
+    const BlasInt yLength = ( normal ? m : n );
+    Scale( yLength, beta, y, incy );
+    if( m == 0 || n == 0 )
+        return;
+
+    // Prescale x so that alpha is only applied once per entry
+    T* xAlpha = Scratch<T>( xLength, ProductPrecision(x[0],alpha) );
+    for( BlasInt j=0; j<xLength; ++j )
+        Mul( xAlpha[j], x[j*incx], alpha );
+
+    // Traverse A in tiles so that the corresponding portions of x and y
+    // remain in cache
+    BlasInt blockHeight, blockWidth;
+    CacheBlocksizes<T>( A[0].NumLimbs(), m, n, blockHeight, blockWidth );
+    for( BlasInt j0=0; j0<n; j0+=blockWidth )
+    {
+        const BlasInt j1 = Min(j0+blockWidth,n);
+        for( BlasInt i0=0; i0<m; i0+=blockHeight )
+        {
+            const BlasInt i1 = Min(i0+blockHeight,m);
+            for( BlasInt j=j0; j<j1; ++j )
+            {
+                if( normal )
+                {
+                    for( BlasInt i=i0; i<i1; ++i )
+                        MultiplyAdd( y[i*incy], A[i+j*ALDim], xAlpha[j] );
+                }
+                else
+                {
+                    for( BlasInt i=i0; i<i1; ++i )
+                        MultiplyAdd( y[j*incy], A[i+j*ALDim], xAlpha[i] );
+                }
+            }
+        }
+    }
+}
+
+// C := alpha op(A) op(B) + beta C, where op(A) and op(B) are either the
+// matrices or their transposes
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+  const T& beta,
+        T* C, BlasInt CLDim )
+{
+    const bool normalA = ( std::toupper(transA) == 'N' );
+    const bool normalB = ( std::toupper(transB) == 'N' );
+    for( BlasInt j=0; j<n; ++j )
+        Scale( m, beta, &C[j*CLDim], 1 );
+    if( m == 0 || n == 0 || k == 0 )
+        return;
+
+    // A block of op(A) is reused for every column of C, and a block of
+    // alpha op(B) (with the same capacity) is formed in scratch space and
+    // reused for every block of rows of C
+    BlasInt blockHeight, blockDepth;
+    CacheBlocksizes<T>( A[0].NumLimbs(), m, k, blockHeight, blockDepth );
+    const BlasInt blockWidth =
+      Max( BlasInt(1),
+           Min( n, CacheCapacity<T>(B[0].NumLimbs())/blockDepth ) );
+    T* BAlpha =
+      Scratch<T>( blockDepth*blockWidth, ProductPrecision(B[0],alpha) );
+
+    for( BlasInt l0=0; l0<k; l0+=blockDepth )
+    {
+        const BlasInt kb = Min(blockDepth,k-l0);
+        for( BlasInt j0=0; j0<n; j0+=blockWidth )
+        {
+            const BlasInt nb = Min(blockWidth,n-j0);
+            for( BlasInt j=0; j<nb; ++j )
+                for( BlasInt l=0; l<kb; ++l )
+                    Mul
+                    ( BAlpha[l+j*kb],
+                      normalB ? B[(l0+l)+(j0+j)*BLDim]
+                              : B[(j0+j)+(l0+l)*BLDim],
+                      alpha );
+
+            for( BlasInt i0=0; i0<m; i0+=blockHeight )
+            {
+                const BlasInt mb = Min(blockHeight,m-i0);
+                for( BlasInt j=0; j<nb; ++j )
+                {
+                    T* c = &C[i0+(j0+j)*CLDim];
+                    const T* b = &BAlpha[j*kb];
+                    if( normalA )
+                    {
+                        for( BlasInt l=0; l<kb; ++l )
+                        {
+                            const T* a = &A[i0+(l0+l)*ALDim];
+                            for( BlasInt i=0; i<mb; ++i )
+                                MultiplyAdd( c[i], a[i], b[l] );
+                        }
+                    }
+                    else
+                    {
+                        for( BlasInt i=0; i<mb; ++i )
+                        {
+                            const T* a = &A[l0+(i0+i)*ALDim];
+                            for( BlasInt l=0; l<kb; ++l )
+                                MultiplyAdd( c[i], a[l], b[l] );
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
+
+} // namespace big
+} // namespace blas
+} // namespace El
+#endif // ifdef EL_HAVE_MPC
@@ -0,0 +1,441 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+
+// Cache-blocked implementations of the level 3 BLAS for the fixed-size
+// extended-precision types (DoubleDouble, QuadDouble, and Quad, as well as
+// their complex counterparts), for which no vendor BLAS exists.
+//
+// The Gemm kernel follows the usual Goto/BLIS structure: a KC x NC block of
+// op(B) is packed into NR-column micro-panels (with alpha applied), an
+// MC x KC block of op(A) is packed into MR-row micro-panels, and each MR x NR
+// block of C is updated by a micro-kernel which keeps its accumulators in
+// local storage. The micro-panels of B are distributed over OpenMP threads
+// (when Elemental is configured with EL_HYBRID).
+//
+// Trsm and Herk recursively cast the bulk of their work into this Gemm.
+//
+// The arbitrary-precision types (BigInt and BigFloat) are excluded since each
+// of their temporaries involves a memory allocation.
+
+namespace El {
+namespace blas {
+namespace blocked {
+
+template<typename T> struct IsBlocked
+{ static const bool value=false; };
+#ifdef EL_HAVE_QD
+template<> struct IsBlocked<DoubleDouble>
+{ static const bool value=true; };
+template<> struct IsBlocked<QuadDouble>
+{ static const bool value=true; };
+template<> struct IsBlocked<Complex<DoubleDouble>>
+{ static const bool value=true; };
+template<> struct IsBlocked<Complex<QuadDouble>>
+{ static const bool value=true; };
+#endif
+#ifdef EL_HAVE_QUAD
+template<> struct IsBlocked<Quad>
+{ static const bool value=true; };
+template<> struct IsBlocked<Complex<Quad>>
+{ static const bool value=true; };
+#endif
+
+// The dimensions of the register block of C
+const BlasInt MR = 4;
+const BlasInt NR = 4;
+
+// Trsm and Herk fall back to their unblocked algorithms below this size
+const BlasInt TriangularBlocksize = 64;
+
+// Gemm falls back to a naive loop when any of its dimensions is below this
+// size, as the packing would then cost as much as the update itself
+const BlasInt GemmCutoff = 16;
+
+// An MR x KC micro-panel of op(A) should fit within the L1 cache, an
+// MC x KC block within the L2 cache, and a KC x NC block of op(B) within
+// the L3 cache
+template<typename T>
+BlasInt PanelDepth()
+{ return Max( BlasInt(16), BlasInt(16384/(MR*sizeof(T))) ); }
+template<typename T>
+BlasInt PanelHeight()
+{ return Max( MR, BlasInt(262144/(PanelDepth<T>()*sizeof(T)))/MR*MR ); }
+template<typename T>
+BlasInt PanelWidth()
+{ return Max( NR, BlasInt(4194304/(PanelDepth<T>()*sizeof(T)))/NR*NR ); }
+
+// Set value := op(A)(i,j), where trans is one of 'N', 'T', or 'C'
+template<typename T>
+inline void OpEntry
+( char trans, const T* A, BlasInt ALDim, BlasInt i, BlasInt j, T& value )
+{
+    if( trans == 'N' )
+        value = A[i+j*ALDim];
+    else if( trans == 'T' )
+        value = A[j+i*ALDim];
+    else
+        Conj( A[j+i*ALDim], value );
+}
+
+// Pack the mc x kc block of op(A) with top-left corner (i0,l0) into
+// zero-padded MR-row micro-panels, each stored one column at a time
+template<typename T>
+void PackA
+( char transA, BlasInt mc, BlasInt kc,
+  const T* A, BlasInt ALDim, BlasInt i0, BlasInt l0, T* APack )
+{
+    const BlasInt numPanels = (mc+MR-1)/MR;
+    EL_PARALLEL_FOR
+    for( BlasInt ir=0; ir<numPanels; ++ir )
+    {
+        const BlasInt mr = Min(MR,mc-ir*MR);
+        T* panel = &APack[ir*MR*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt i=0; i<mr; ++i )
+                OpEntry
+                ( transA, A, ALDim, i0+ir*MR+i, l0+l, panel[i+l*MR] );
+            for( BlasInt i=mr; i<MR; ++i )
+                panel[i+l*MR] = 0;
+        }
+    }
+}
+
+// Pack alpha times the kc x nc block of op(B) with top-left corner (l0,j0)
+// into zero-padded NR-column micro-panels, each stored one row at a time
+template<typename T>
+void PackB
+( char transB, BlasInt kc, BlasInt nc, const T& alpha,
+  const T* B, BlasInt BLDim, BlasInt l0, BlasInt j0, T* BPack )
+{
+    const BlasInt numPanels = (nc+NR-1)/NR;
+    EL_PARALLEL_FOR
+    for( BlasInt jr=0; jr<numPanels; ++jr )
+    {
+        const BlasInt nr = Min(NR,nc-jr*NR);
+        T* panel = &BPack[jr*NR*kc];
+        for( BlasInt l=0; l<kc; ++l )
+        {
+            for( BlasInt j=0; j<nr; ++j )
+            {
+                OpEntry
+                ( transB, B, BLDim, l0+l, j0+jr*NR+j, panel[j+l*NR] );
+                panel[j+l*NR] *= alpha;
+            }
+            for( BlasInt j=nr; j<NR; ++j )
+                panel[j+l*NR] = 0;
+        }
+    }
+}
+
+// C(0:mr,0:nr) += A B, where A and B are packed micro-panels of depth kc
+template<typename T>
+void MicroKernel
+( BlasInt kc, const T* APanel, const T* BPanel,
+  BlasInt mr, BlasInt nr, T* C, BlasInt CLDim )
+{
+    T acc[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+        acc[t] = 0;
+
+    T delta;
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        const T* a = &APanel[l*MR];
+        const T* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                delta = a[i];
+                delta *= b[j];
+                acc[i+j*MR] += delta;
+            }
+        }
+    }
+
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += acc[i+j*MR];
+}
+
+#ifdef EL_HAVE_QD
+// Since a DoubleDouble is a pair of doubles, the accumulators can be split
+// into arrays of their leading and trailing components, and the error-free
+// transformations (TwoProd via fused multiply-add and TwoSum) which implement
+// double-double arithmetic can be vectorized over the entire register block.
+// The accumulation uses the same IEEE-style addition as QD's operator+.
+inline void MicroKernel
+( BlasInt kc, const DoubleDouble* APanel, const DoubleDouble* BPanel,
+  BlasInt mr, BlasInt nr, DoubleDouble* C, BlasInt CLDim )
+{
+    double accHi[MR*NR], accLo[MR*NR];
+    double aHi[MR*NR], aLo[MR*NR], bHi[MR*NR], bLo[MR*NR];
+    for( BlasInt t=0; t<MR*NR; ++t )
+    {
+        accHi[t] = 0;
+        accLo[t] = 0;
+    }
+
+    for( BlasInt l=0; l<kc; ++l )
+    {
+        // Broadcast the micro-panel entries into the shape of the block
+        const DoubleDouble* a = &APanel[l*MR];
+        const DoubleDouble* b = &BPanel[l*NR];
+        for( BlasInt j=0; j<NR; ++j )
+        {
+            for( BlasInt i=0; i<MR; ++i )
+            {
+                aHi[i+j*MR] = a[i].x[0];
+                aLo[i+j*MR] = a[i].x[1];
+                bHi[i+j*MR] = b[j].x[0];
+                bLo[i+j*MR] = b[j].x[1];
+            }
+        }
+
+        EL_SIMD
+        for( BlasInt t=0; t<MR*NR; ++t )
+        {
+            // (pHi,pLo) := a b
+            double pHi = aHi[t]*bHi[t];
+            double pLo = std::fma( aHi[t], bHi[t], -pHi );
+            pLo += aHi[t]*bLo[t] + aLo[t]*bHi[t];
+            double s = pHi + pLo;
+            pLo = pLo - (s-pHi);
+            pHi = s;
+
+            // (accHi,accLo) += (pHi,pLo)
+            s = accHi[t] + pHi;
+            double v = s - accHi[t];
+            double sErr = (accHi[t]-(s-v)) + (pHi-v);
+            const double u = accLo[t] + pLo;
+            v = u - accLo[t];
+            const double uErr = (accLo[t]-(u-v)) + (pLo-v);
+            sErr += u;
+            double hi = s + sErr;
+            sErr = sErr - (hi-s);
+            sErr += uErr;
+            accHi[t] = hi + sErr;
+            accLo[t] = sErr - (accHi[t]-hi);
+        }
+    }
+
+    for( BlasInt j=0; j<nr; ++j )
+        for( BlasInt i=0; i<mr; ++i )
+            C[i+j*CLDim] += dd_real( accHi[i+j*MR], accLo[i+j*MR] );
+}
+#endif
+
+// C := alpha op(A) op(B) + C
+template<typename T>
+void Gemm
+( char transA, char transB,
+  BlasInt m, BlasInt n, BlasInt k,
+  const T& alpha,
+  const T* A, BlasInt ALDim,
+  const T* B, BlasInt BLDim,
+        T* C, BlasInt CLDim )
+{
+    transA = std::toupper(transA);
+    transB = std::toupper(transB);
+    if( Min(m,Min(n,k)) < GemmCutoff )
+    {
+        T gamma, delta;
+        for( BlasInt j=0; j<n; ++j )
+        {
+            for( BlasInt l=0; l<k; ++l )
+            {
+                OpEntry( transB, B, BLDim, l, j, gamma );
+                gamma *= alpha;
+                for( BlasInt i=0; i<m; ++i )
+                {
+                    OpEntry( transA, A, ALDim, i, l, delta );
+                    delta *= gamma;
+                    C[i+j*CLDim] += delta;
+                }
+            }
+        }
+        return;
+    }
+
+    const BlasInt KC = PanelDepth<T>();
+    const BlasInt MC = PanelHeight<T>();
+    const BlasInt NC = PanelWidth<T>();
+
+    std::vector<T> APack( Min(MC,(m+MR-1)/MR*MR)*Min(KC,k) ),
+                   BPack( Min(KC,k)*Min(NC,(n+NR-1)/NR*NR) );
+    for( BlasInt jc=0; jc<n; jc+=NC )
+    {
+        const BlasInt nc = Min(NC,n-jc);
+        const BlasInt numPanelsN = (nc+NR-1)/NR;
+        for( BlasInt pc=0; pc<k; pc+=KC )
+        {
+            const BlasInt kc = Min(KC,k-pc);
+            PackB( transB, kc, nc, alpha, B, BLDim, pc, jc, BPack.data() );
+            for( BlasInt ic=0; ic<m; ic+=MC )
+            {
+                const BlasInt mc = Min(MC,m-ic);
+                const BlasInt numPanelsM = (mc+MR-1)/MR;
+                PackA( transA, mc, kc, A, ALDim, ic, pc, APack.data() );
+
+                const T* APackBuf = APack.data();
+                const T* BPackBuf = BPack.data();
+                EL_PARALLEL_FOR
+                for( BlasInt jr=0; jr<numPanelsN; ++jr )
+                {
+                    const BlasInt nr = Min(NR,nc-jr*NR);
+                    for( BlasInt ir=0; ir<numPanelsM; ++ir )
+                    {
+                        const BlasInt mr = Min(MR,mc-ir*MR);
+                        MicroKernel
+                        ( kc, &APackBuf[ir*MR*kc], &BPackBuf[jr*NR*kc],
+                          mr, nr, &C[(ic+ir*MR)+(jc+jr*NR)*CLDim], CLDim );
+                    }
+                }
+            }
+        }
+    }
+}
+
+// Solve op(A) X = B or X op(A) = B, where op(A) is triangular, by splitting
+// the triangular matrix in half and updating with Gemm. The blocks which
+// are small enough are handled by the unblocked blas::Trsm.
+template<typename F>
+void Trsm
+( char side, char uplo, char trans, char unit,
+  BlasInt m, BlasInt n,
+  const F& alpha,
+  const F* A, BlasInt ALDim,
+        F* B, BlasInt BLDim )
+{
+    const bool onLeft = ( std::toupper(side) == 'L' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    // Whether op(A) is lower triangular
+    const bool opLower = ( lower == normal );
+
+    if( alpha != F(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+    }
+
+    const BlasInt triDim = ( onLeft ? m : n );
+    const BlasInt n1 = triDim/2;
+    const BlasInt n2 = triDim - n1;
+    const F* A11 = A;
+    const F* A22 = &A[n1+n1*ALDim];
+    // The stored block whose image under op lies below the diagonal of op(A)
+    // (or above it)
+    const F* AOffLower = ( normal ? &A[n1] : &A[n1*ALDim] );
+    const F* AOffUpper = ( normal ? &A[n1*ALDim] : &A[n1] );
+    if( onLeft )
+    {
+        F* B1 = B;
+        F* B2 = &B[n1];
+        if( opLower )
+        {
+            blas::Trsm( side, uplo, trans, unit, n1, n, F(1), A11, ALDim,
+                        B1, BLDim );
+            Gemm( trans, 'N', n2, n, n1, F(-1), AOffLower, ALDim, B1, BLDim,
+                  B2, BLDim );
+            blas::Trsm( side, uplo, trans, unit, n2, n, F(1), A22, ALDim,
+                        B2, BLDim );
+        }
+        else
+        {
+            blas::Trsm( side, uplo, trans, unit, n2, n, F(1), A22, ALDim,
+                        B2, BLDim );
+            Gemm( trans, 'N', n1, n, n2, F(-1), AOffUpper, ALDim, B2, BLDim,
+                  B1, BLDim );
+            blas::Trsm( side, uplo, trans, unit, n1, n, F(1), A11, ALDim,
+                        B1, BLDim );
+        }
+    }
+    else
+    {
+        F* B1 = B;
+        F* B2 = &B[n1*BLDim];
+        if( opLower )
+        {
+            blas::Trsm( side, uplo, trans, unit, m, n2, F(1), A22, ALDim,
+                        B2, BLDim );
+            Gemm( 'N', trans, m, n1, n2, F(-1), B2, BLDim, AOffLower, ALDim,
+                  B1, BLDim );
+            blas::Trsm( side, uplo, trans, unit, m, n1, F(1), A11, ALDim,
+                        B1, BLDim );
+        }
+        else
+        {
+            blas::Trsm( side, uplo, trans, unit, m, n1, F(1), A11, ALDim,
+                        B1, BLDim );
+            Gemm( 'N', trans, m, n2, n1, F(-1), B1, BLDim, AOffUpper, ALDim,
+                  B2, BLDim );
+            blas::Trsm( side, uplo, trans, unit, m, n2, F(1), A22, ALDim,
+                        B2, BLDim );
+        }
+    }
+}
+
+// Update the given triangle of C := alpha op(A) op(A)^H + beta C one block
+// column at a time, where the diagonal blocks are handled by the unblocked
+// blas::Herk and the off-diagonal blocks by Gemm
+template<typename T>
+void Herk
+( char uplo, char trans,
+  BlasInt n, BlasInt k,
+  const Base<T>& alpha,
+  const T* A, BlasInt ALDim,
+  const Base<T>& beta,
+        T* C, BlasInt CLDim )
+{
+    const bool lower = ( std::toupper(uplo) == 'L' );
+    const bool normal = ( std::toupper(trans) == 'N' );
+    // Only the 'uplo' triangle of C is referenced
+    if( beta == Base<T>(0) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
+                C[i+j*CLDim] = 0;
+    }
+    else if( beta != Base<T>(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
+                C[i+j*CLDim] *= beta;
+    }
+
+    // op(A)(i0:i0+b,:) is stored in A starting at the following entry
+    auto rows = [&]( BlasInt i0 ) { return normal ? &A[i0] : &A[i0*ALDim]; };
+    const char transLeft = ( normal ? 'N' : 'C' );
+    const char transRight = ( normal ? 'C' : 'N' );
+    const T alphaT( alpha );
+    for( BlasInt j=0; j<n; j+=TriangularBlocksize )
+    {
+        const BlasInt nb = Min(TriangularBlocksize,n-j);
+        blas::Herk
+        ( uplo, trans, nb, k, alpha, rows(j), ALDim,
+          Base<T>(1), &C[j+j*CLDim], CLDim );
+        if( lower )
+            Gemm
+            ( transLeft, transRight, n-(j+nb), nb, k,
+              alphaT, rows(j+nb), ALDim, rows(j), ALDim,
+              &C[(j+nb)+j*CLDim], CLDim );
+        else
+            Gemm
+            ( transLeft, transRight, j, nb, k,
+              alphaT, rows(0), ALDim, rows(j), ALDim,
+              &C[j*CLDim], CLDim );
+    }
+}
+
+} // namespace blocked
+} // namespace blas
+} // namespace El
@@ -108,6 +108,36 @@ double Dot
   const double* y, BlasInt incy )
 { return EL_BLAS(ddot)( &n, x, &incx, y, &incy ); }
 
+#ifdef EL_HAVE_MPC
+BigInt Dot
+( BlasInt n,
+  const BigInt* x, BlasInt incx,
+  const BigInt* y, BlasInt incy )
+{
+    BigInt alpha = 0;
+    for( BlasInt i=0; i<n; ++i )
+        mpz_addmul
+        ( alpha.Pointer(),
+          x[i*incx].LockedPointer(), y[i*incy].LockedPointer() );
+    return alpha;
+}
+
+BigFloat Dot
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy )
+{
+    const mpfr_rnd_t round = mpfr::RoundingMode();
+    BigFloat alpha = 0;
+    for( BlasInt i=0; i<n; ++i )
+        mpfr_fma
+        ( alpha.Pointer(),
+          x[i*incx].LockedPointer(), y[i*incy].LockedPointer(),
+          alpha.LockedPointer(), round );
+    return alpha;
+}
+#endif
+
 template<typename T>
 T Dotu
 ( BlasInt n,
@@ -191,5 +221,19 @@ double Dotu
   const double* y, BlasInt incy )
 { return EL_BLAS(ddot)( &n, x, &incx, y, &incy ); }
 
+#ifdef EL_HAVE_MPC
+BigInt Dotu
+( BlasInt n,
+  const BigInt* x, BlasInt incx,
+  const BigInt* y, BlasInt incy )
+{ return Dot( n, x, incx, y, incy ); }
+
+BigFloat Dotu
+( BlasInt n,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat* y, BlasInt incy )
+{ return Dot( n, x, incx, y, incy ); }
+#endif
+
 } // namespace blas
 } // namespace El
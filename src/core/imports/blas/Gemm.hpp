@@ -78,6 +78,13 @@ void Gemm
                 C[i+j*CLDim] *= beta;
     }
 
+    if( blocked::IsBlocked<T>::value )
+    {
+        blocked::Gemm
+        ( transA, transB, m, n, k, alpha, A, ALDim, B, BLDim, C, CLDim );
+        return;
+    }
+
     // Naive implementation
     T gamma, delta;
     if( std::toupper(transA) == 'N' && std::toupper(transB) == 'N' )
@@ -513,5 +520,33 @@ void Gemm
       &alpha, A, &ALDim, B, &BLDim, &beta, C, &CLDim );
 }
 
+#ifdef EL_HAVE_MPC
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* B, BlasInt BLDim,
+  const BigInt& beta,
+        BigInt* C, BlasInt CLDim )
+{
+    big::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+
+void Gemm
+( char transA, char transB, BlasInt m, BlasInt n, BlasInt k,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* B, BlasInt BLDim,
+  const BigFloat& beta,
+        BigFloat* C, BlasInt CLDim )
+{
+    big::Gemm
+    ( transA, transB, m, n, k,
+      alpha, A, ALDim, B, BLDim, beta, C, CLDim );
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -257,5 +257,25 @@ void Gemv
 { EL_BLAS(zgemv)
   ( &trans, &m, &n, &alpha, A, &ALDim, x, &incx, &beta, y, &incy ); }
 
+#ifdef EL_HAVE_MPC
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigInt& alpha,
+  const BigInt* A, BlasInt ALDim,
+  const BigInt* x, BlasInt incx,
+  const BigInt& beta,
+        BigInt* y, BlasInt incy )
+{ big::Gemv( trans, m, n, alpha, A, ALDim, x, incx, beta, y, incy ); }
+
+void Gemv
+( char trans, BlasInt m, BlasInt n,
+  const BigFloat& alpha,
+  const BigFloat* A, BlasInt ALDim,
+  const BigFloat* x, BlasInt incx,
+  const BigFloat& beta,
+        BigFloat* y, BlasInt incy )
+{ big::Gemv( trans, m, n, alpha, A, ALDim, x, incx, beta, y, incy ); }
+#endif
+
 } // namespace blas
 } // namespace El
@@ -63,24 +63,31 @@ void Herk
   const Base<T>& beta,
         T* C, BlasInt CLDim )
 {
+    if( blocked::IsBlocked<T>::value && n > blocked::TriangularBlocksize )
+    {
+        blocked::Herk( uplo, trans, n, k, alpha, A, ALDim, beta, C, CLDim );
+        return;
+    }
+
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool lower = ( std::toupper(uplo) == 'L' );
+
     // NOTE: Temporaries are avoided since constructing a BigInt/BigFloat
     //       involves a memory allocation
+    // Only the 'uplo' triangle of C is referenced
     if( beta == Base<T>(0) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] = 0;
     }
     else if( beta != Base<T>(1) )
     {
         for( BlasInt j=0; j<n; ++j )
-            for( BlasInt i=0; i<n; ++i )
+            for( BlasInt i=(lower?j:0); i<(lower?n:j+1); ++i )
                 C[i+j*CLDim] *= beta;
     }
 
-    const bool normal = ( std::toupper(trans) == 'N' );
-    const bool lower = ( std::toupper(uplo) == 'L' );
-
     T gamma, delta;
     if( normal )
     {
@@ -51,11 +51,21 @@ void Trsm
     const bool lower = ( std::toupper(uplo) == 'L' );
     const bool conjugate = ( std::toupper(trans) == 'C' );
     const bool unitDiag = ( std::toupper(unit) == 'U' );
+    if( blocked::IsBlocked<F>::value &&
+        ( onLeft ? m : n ) > blocked::TriangularBlocksize )
+    {
+        blocked::Trsm
+        ( side, uplo, trans, unit, m, n, alpha, A, ALDim, B, BLDim );
+        return;
+    }
 
     // Scale B
-    for( BlasInt j=0; j<n; ++j )
-        for( BlasInt i=0; i<m; ++i )
-            B[i+j*BLDim] *= alpha;
+    if( alpha != F(1) )
+    {
+        for( BlasInt j=0; j<n; ++j )
+            for( BlasInt i=0; i<m; ++i )
+                B[i+j*BLDim] *= alpha;
+    }
 
     F alpha11, alpha11Conj;
     if( onLeft )
@@ -208,5 +208,45 @@ void Trsv
         dcomplex* x, BlasInt incx )
 { EL_BLAS(ztrsv)( &uplo, &trans, &diag, &m, A, &ALDim, x, &incx ); }
 
+#ifdef EL_HAVE_MPC
+void Trsv
+( char uplo, char trans, char diag, BlasInt m,
+  const BigFloat* A, BlasInt ALDim,
+        BigFloat* x, BlasInt incx )
+{
+    // Since conjugation is trivial, op(A) is lower triangular if and only if
+    // A is lower triangular and not transposed (or upper and transposed)
+    const bool normal = ( std::toupper(trans) == 'N' );
+    const bool opLower = ( (std::toupper(uplo) == 'L') == normal );
+    const bool unitDiag = ( std::toupper(diag) == 'U' );
+    const mpfr_rnd_t round = mpfr::RoundingMode();
+
+    if( m == 0 )
+        return;
+
+    // x(i) -= op(A)(i,j) x(j) is performed as x(i) += op(A)(i,j) (-x(j))
+    // (at the precision of x rather than the default)
+    BigFloat& negChi = *big::Scratch<BigFloat>( 1, x[0].Precision() );
+    for( BlasInt t=0; t<m; ++t )
+    {
+        const BlasInt j = ( opLower ? t : m-1-t );
+        if( !unitDiag )
+            x[j*incx] /= A[j+j*ALDim];
+        mpfr_neg( negChi.Pointer(), x[j*incx].LockedPointer(), round );
+
+        const BlasInt iBeg = ( opLower ? j+1 : 0 );
+        const BlasInt iEnd = ( opLower ? m : j );
+        for( BlasInt i=iBeg; i<iEnd; ++i )
+        {
+            const BigFloat& alpha =
+              ( normal ? A[i+j*ALDim] : A[j+i*ALDim] );
+            mpfr_fma
+            ( x[i*incx].Pointer(), alpha.LockedPointer(),
+              negChi.LockedPointer(), x[i*incx].LockedPointer(), round );
+        }
+    }
+}
+#endif
+
 } // namespace blas
 } // namespace El
@@ -174,6 +174,19 @@ void Split( Comm comm, int color, int key, Comm& newComm ) EL_NO_RELEASE_EXCEPT
     SafeMpi( MPI_Comm_split( comm.comm, color, key, &newComm.comm ) );
 }
 
+void SplitShared( Comm comm, Comm& nodeComm ) EL_NO_RELEASE_EXCEPT
+{
+    DEBUG_CSE
+#if MPI_VERSION >= 3
+    SafeMpi
+    ( MPI_Comm_split_type
+      ( comm.comm, MPI_COMM_TYPE_SHARED, Rank(comm), MPI_INFO_NULL,
+        &nodeComm.comm ) );
+#else
+    Split( comm, Rank(comm), 0, nodeComm );
+#endif
+}
+
 void Free( Comm& comm ) EL_NO_RELEASE_EXCEPT
 {
     DEBUG_CSE
@@ -476,6 +489,7 @@ void Wait( Request<T>& request, Status& status ) EL_NO_RELEASE_EXCEPT
         request.receivingPacked = false;
     }
     request.buffer.clear();
+    request.sendBuffer.clear();
 }
 
 template<typename T,typename,typename>
@@ -514,6 +528,7 @@ EL_NO_RELEASE_EXCEPT
             requests[j].receivingPacked = false;
         }
         requests[j].buffer.clear();
+        requests[j].sendBuffer.clear();
     }
 }
 
@@ -1067,7 +1082,7 @@ void IBroadcast
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1083,11 +1098,11 @@ void IBroadcast
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, 2*count, TypeMap<Real>(), root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Ibcast
+    ( EL_NONBLOCKING_COLL(Ibcast)
       ( buf, count, TypeMap<Complex<Real>>(), root, comm.comm,
         &request.backend ) );
 #endif
@@ -1105,10 +1120,12 @@ void IBroadcast
     request.receivingPacked = true;
     request.recvCount = count;
     request.unpackedRecvBuf = buf;
-    ReserveSerialized( count, buf, request.buffer );
+    // Only the root's data is meaningful, but every process must provide
+    // a buffer of the serialized size
+    Serialize( count, buf, request.buffer );
     SafeMpi
-    ( MPI_Ibcast
-      ( request.buffer.data(), count, TypeMap<Real>(), root, comm.comm,
+    ( EL_NONBLOCKING_COLL(Ibcast)
+      ( request.buffer.data(), count, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1188,7 +1205,7 @@ void IGather
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
         rbuf,                    rc, TypeMap<Real>(), root, comm.comm,
         &request.backend ) );
@@ -1208,13 +1225,13 @@ void IGather
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
         rbuf,                             2*rc, TypeMap<Real>(), 
         root, comm.comm, &request.backend ) );
 #else
     SafeMpi
-    ( MPI_Igather
+    ( EL_NONBLOCKING_COLL(Igather)
       ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
         rbuf,                             rc, TypeMap<Complex<Real>>(), 
         root, comm.comm, &request.backend ) );
@@ -1233,6 +1250,7 @@ void IGather
 {
     DEBUG_CSE
 #ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    Serialize( sc, sbuf, request.sendBuffer );
     if( mpi::Rank(comm) == root )
     {
         const int commSize = mpi::Size(comm);
@@ -1242,9 +1260,9 @@ void IGather
         ReserveSerialized( rc*commSize, rbuf, request.buffer );
     }
     SafeMpi
-    ( MPI_Igather
-      ( request.buffer.data(), sc, TypeMap<Real>(),
-        rbuf,                  rc, TypeMap<Real>(), root, comm.comm,
+    ( EL_NONBLOCKING_COLL(Igather)
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), root, comm.comm,
         &request.backend ) );
 #else
     LogicError("Elemental was not configured with non-blocking support");
@@ -1422,6 +1440,73 @@ EL_NO_RELEASE_EXCEPT
     Deserialize( totalRecv, packedRecv, rbuf );
 }
 
+template<typename Real,typename>
+void IAllGather
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllGather
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllGather
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int totalRecv = rc*mpi::Size(comm);
+    Serialize( sc, sbuf, request.sendBuffer );
+
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallgather)
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,typename>
 void AllGather
 ( const Real* sbuf, int sc,
@@ -1833,6 +1918,150 @@ EL_NO_RELEASE_EXCEPT
     return recvBuf;
 }
 
+template<typename Real,typename>
+void IAllToAll
+( const Real* sbuf, int sc,
+        Real* rbuf, int rc, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Real*>(sbuf), sc, TypeMap<Real>(),
+        rbuf,                    rc, TypeMap<Real>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Complex<Real>* sbuf, int sc,
+        Complex<Real>* rbuf, int rc, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<Real>*>(sbuf), 2*sc, TypeMap<Real>(),
+        rbuf,                             2*rc, TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( const_cast<Complex<Real>*>(sbuf), sc, TypeMap<Complex<Real>>(),
+        rbuf,                             rc, TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllToAll
+( const T* sbuf, int sc,
+        T* rbuf, int rc, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int commSize = mpi::Size( comm );
+    const int totalSend = sc*commSize;
+    const int totalRecv = rc*commSize;
+    Serialize( totalSend, sbuf, request.sendBuffer );
+
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoall)
+      ( request.sendBuffer.data(), sc, TypeMap<T>(),
+        request.buffer.data(),     rc, TypeMap<T>(), comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Real* sbuf, const int* scs, const int* sds,
+        Real* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoallv)
+      ( const_cast<Real*>(sbuf),
+        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<Real>(),
+        rbuf,
+        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<Real>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllToAll
+( const Complex<Real>* sbuf, const int* scs, const int* sds,
+        Complex<Real>* rbuf, const int* rcs, const int* rds,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    // Unlike the blocking variant, we cannot double the counts and 
+    // displacements into temporary arrays, as they must outlive the call
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoallv)
+      ( const_cast<Complex<Real>*>(sbuf),
+        const_cast<int*>(scs),
+        const_cast<int*>(sds),
+        TypeMap<Complex<Real>>(),
+        rbuf,
+        const_cast<int*>(rcs),
+        const_cast<int*>(rds),
+        TypeMap<Complex<Real>>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllToAll
+( const T* sbuf, const int* scs, const int* sds,
+        T* rbuf, const int* rcs, const int* rds, Comm comm,
+  Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    const int commSize = mpi::Size( comm );
+    const int totalSend = scs[commSize-1]+sds[commSize-1];
+    const int totalRecv = rcs[commSize-1]+rds[commSize-1];
+    Serialize( totalSend, sbuf, request.sendBuffer );
+
+    request.receivingPacked = true;
+    request.recvCount = totalRecv;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( totalRecv, rbuf, request.buffer );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ialltoallv)
+      ( request.sendBuffer.data(),
+        const_cast<int*>(scs), const_cast<int*>(sds), TypeMap<T>(),
+        request.buffer.data(),
+        const_cast<int*>(rcs), const_cast<int*>(rds), TypeMap<T>(),
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
 template<typename Real,typename>
 void Reduce
 ( const Real* sbuf, Real* rbuf, int count, Op op, int root, Comm comm )
@@ -2207,6 +2436,153 @@ void AllReduce( T* buf, int count, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { AllReduce( buf, count, SUM, comm ); }
 
+template<typename Real,typename>
+void IAllReduce
+( const Real* sbuf, Real* rbuf, int count, Op op, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Real*>(sbuf), rbuf, count, TypeMap<Real>(), opC,
+        comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllReduce
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int count, Op op,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( const_cast<Complex<Real>*>(sbuf),
+            rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+            &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( const_cast<Complex<Real>*>(sbuf),
+        rbuf, count, TypeMap<Complex<Real>>(), opC, comm.comm,
+        &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Op op, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<T>( op );
+    Serialize( count, sbuf, request.sendBuffer );
+
+    request.receivingPacked = true;
+    request.recvCount = count;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( count, rbuf, request.buffer );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( request.sendBuffer.data(), request.buffer.data(), count, TypeMap<T>(),
+        opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IAllReduce
+( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( sbuf, rbuf, count, SUM, comm, request ); }
+
+template<typename Real,typename>
+void IAllReduce
+( Real* buf, int count, Op op, Comm comm, Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IAllReduce
+( Complex<Real>* buf, int count, Op op, Comm comm,
+  Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( MPI_IN_PLACE, buf, 2*count, TypeMap<Real>(), opC, comm.comm,
+            &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Iallreduce)
+          ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+            comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Iallreduce)
+      ( MPI_IN_PLACE, buf, count, TypeMap<Complex<Real>>(), opC,
+        comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IAllReduce
+( T* buf, int count, Op op, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+    IAllReduce( const_cast<const T*>(buf), buf, count, op, comm, request );
+}
+
+template<typename T>
+void IAllReduce( T* buf, int count, Comm comm, Request<T>& request )
+{ IAllReduce( buf, count, SUM, comm, request ); }
+
 template<typename Real,typename>
 void ReduceScatter( Real* sbuf, Real* rbuf, int rc, Op op, Comm comm )
 EL_NO_RELEASE_EXCEPT
@@ -2404,6 +2780,87 @@ void ReduceScatter( T* buf, int rc, Comm comm )
 EL_NO_RELEASE_EXCEPT
 { ReduceScatter( buf, rc, SUM, comm ); }
 
+template<typename Real,typename>
+void IReduceScatter
+( const Real* sbuf, Real* rbuf, int rc, Op op, Comm comm,
+  Request<Real>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<Real>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( const_cast<Real*>(sbuf), rbuf, rc, TypeMap<Real>(), opC, comm.comm,
+        &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename Real,typename>
+void IReduceScatter
+( const Complex<Real>* sbuf, Complex<Real>* rbuf, int rc, Op op,
+  Comm comm, Request<Complex<Real>>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+#ifdef EL_AVOID_COMPLEX_MPI
+    if( op == SUM )
+    {
+        MPI_Op opC = NativeOp<Real>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, 2*rc, TypeMap<Real>(),
+            opC, comm.comm, &request.backend ) );
+    }
+    else
+    {
+        MPI_Op opC = NativeOp<Complex<Real>>( op );
+        SafeMpi
+        ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+          ( const_cast<Complex<Real>*>(sbuf), rbuf, rc,
+            TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+    }
+#else
+    MPI_Op opC = NativeOp<Complex<Real>>( op );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( const_cast<Complex<Real>*>(sbuf), rbuf, rc,
+        TypeMap<Complex<Real>>(), opC, comm.comm, &request.backend ) );
+#endif
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T,typename,typename>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, Request<T>& request )
+{
+    DEBUG_CSE
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+    MPI_Op opC = NativeOp<T>( op );
+    const int totalSend = rc*mpi::Size(comm);
+    Serialize( totalSend, sbuf, request.sendBuffer );
+
+    request.receivingPacked = true;
+    request.recvCount = rc;
+    request.unpackedRecvBuf = rbuf;
+    ReserveSerialized( rc, rbuf, request.buffer );
+    SafeMpi
+    ( EL_NONBLOCKING_COLL(Ireduce_scatter_block)
+      ( request.sendBuffer.data(), request.buffer.data(), rc, TypeMap<T>(),
+        opC, comm.comm, &request.backend ) );
+#else
+    LogicError("Elemental was not configured with non-blocking support");
+#endif
+}
+
+template<typename T>
+void IReduceScatter
+( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request )
+{ IReduceScatter( sbuf, rbuf, rc, SUM, comm, request ); }
+
 template<typename Real,typename>
 void ReduceScatter
 ( const Real* sbuf, Real* rbuf, const int* rcs, Op op, Comm comm )
@@ -2720,6 +3177,247 @@ EL_NO_RELEASE_EXCEPT
 #endif
 }
 
+namespace {
+
+Int maxMessageCount = std::numeric_limits<int>::max() / 2;
+
+// The number of messages used to transmit 'count' entries. Even an empty
+// transfer is sent as a single message so that it pairs with the standard
+// point-to-point routines
+Int NumMessages( Int count, Int maxCount )
+{ return Max( (count+maxCount-1)/maxCount, Int(1) ); }
+
+} // anonymous namespace
+
+Int MaxMessageCount() { return maxMessageCount; }
+
+void SetMaxMessageCount( Int maxCount )
+{
+    if( maxCount < 1 || maxCount > Int(std::numeric_limits<int>::max()) )
+        LogicError("Invalid maximum message count of ",maxCount);
+    maxMessageCount = maxCount;
+}
+
+template<typename T>
+void LargeBroadcast( T* buf, Int count, int root, Comm comm )
+{
+    DEBUG_CSE
+    const Int maxCount = MaxMessageCount();
+    for( Int off=0; off<count; off+=maxCount )
+    {
+        const int thisCount = Min( maxCount, count-off );
+        Broadcast( &buf[off], thisCount, root, comm );
+    }
+}
+
+template<typename T>
+void LargeSendRecv
+( const T* sbuf, Int sc, int to,
+        T* rbuf, Int rc, int from, Comm comm )
+{
+    DEBUG_CSE
+    const Int maxCount = MaxMessageCount();
+    if( sc <= maxCount && rc <= maxCount )
+    {
+        SendRecv( sbuf, int(sc), to, rbuf, int(rc), from, comm );
+        return;
+    }
+
+    // Messages between a pair of processes are non-overtaking, so the
+    // pieces are received in the order in which they were sent
+    const Int numRecvs = NumMessages( rc, maxCount );
+    const Int numSends = NumMessages( sc, maxCount );
+    vector<Request<T>> requests( numRecvs+numSends );
+    for( Int k=0; k<numRecvs; ++k )
+    {
+        const Int off = k*maxCount;
+        const int thisCount = Min( maxCount, rc-off );
+        IRecv( &rbuf[off], thisCount, from, comm, requests[k] );
+    }
+    for( Int k=0; k<numSends; ++k )
+    {
+        const Int off = k*maxCount;
+        const int thisCount = Min( maxCount, sc-off );
+        ISend( &sbuf[off], thisCount, to, comm, requests[numRecvs+k] );
+    }
+    WaitAll( int(numRecvs+numSends), requests.data() );
+}
+
+template<typename T>
+void LargeAllGather( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( sc != rc )
+          LogicError("Send and receive counts must match");
+    )
+    const int commSize = Size( comm );
+    const Int maxCount = MaxMessageCount();
+    if( rc*commSize <= maxCount )
+    {
+        AllGather( sbuf, int(sc), rbuf, int(rc), comm );
+        return;
+    }
+
+    // Gather pieces of each contribution into a contiguous buffer whose
+    // total size fits within a single message and then scatter them into
+    // their final positions
+    const Int chunk = Max( maxCount/commSize, Int(1) );
+    vector<T> recvBuf;
+    FastResize( recvBuf, Min(chunk,rc)*commSize );
+    for( Int off=0; off<rc; off+=chunk )
+    {
+        const Int thisCount = Min( chunk, rc-off );
+        AllGather
+        ( &sbuf[off], int(thisCount), recvBuf.data(), int(thisCount), comm );
+        for( int q=0; q<commSize; ++q )
+            std::copy
+            ( &recvBuf[q*thisCount], &recvBuf[(q+1)*thisCount],
+              &rbuf[q*rc+off] );
+    }
+}
+
+namespace {
+
+// Each round of a large AllToAll moves at most 'chunk' entries between each
+// pair of processes so that the packed buffers of a round fit in a message
+Int AllToAllChunk( int commSize )
+{ return Max( MaxMessageCount()/commSize, Int(1) ); }
+
+// The number of rounds required by this process's sends. Since every
+// receive count is some process's send count, the maximum over all
+// processes is the number of rounds required by the exchange.
+Int NumLocalRounds( const Int* scs, int commSize, Int chunk )
+{
+    Int maxSendCount = 0;
+    for( int q=0; q<commSize; ++q )
+        maxSendCount = Max( maxSendCount, scs[q] );
+    return (maxSendCount+chunk-1)/chunk;
+}
+
+template<typename T>
+void LargeAllToAllRounds
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Int numRounds, Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = Size( comm );
+    const Int chunk = AllToAllChunk( commSize );
+    vector<int> sendCounts(commSize), sendOffs(commSize),
+                recvCounts(commSize), recvOffs(commSize);
+    if( numRounds == 1 )
+    {
+        // Whether or not the offsets fit within an int is a purely local
+        // decision, as it only affects how this process's buffers are passed
+        Int totalSend=0, totalRecv=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            totalSend = Max( totalSend, sds[q]+scs[q] );
+            totalRecv = Max( totalRecv, rds[q]+rcs[q] );
+        }
+        const Int maxCount = MaxMessageCount();
+        if( totalSend <= maxCount && totalRecv <= maxCount )
+        {
+            for( int q=0; q<commSize; ++q )
+            {
+                sendCounts[q] = scs[q];
+                sendOffs[q] = sds[q];
+                recvCounts[q] = rcs[q];
+                recvOffs[q] = rds[q];
+            }
+            AllToAll
+            ( sbuf, sendCounts.data(), sendOffs.data(),
+              rbuf, recvCounts.data(), recvOffs.data(), comm );
+            return;
+        }
+    }
+
+    vector<T> sendBuf, recvBuf;
+    for( Int round=0; round<numRounds; ++round )
+    {
+        const Int roundOff = round*chunk;
+        for( int q=0; q<commSize; ++q )
+        {
+            sendCounts[q] = Max( Min( chunk, scs[q]-roundOff ), Int(0) );
+            recvCounts[q] = Max( Min( chunk, rcs[q]-roundOff ), Int(0) );
+        }
+        const int roundSend = El::Scan( sendCounts, sendOffs );
+        const int roundRecv = El::Scan( recvCounts, recvOffs );
+
+        FastResize( sendBuf, roundSend );
+        FastResize( recvBuf, roundRecv );
+        for( int q=0; q<commSize; ++q )
+            std::copy
+            ( &sbuf[sds[q]+roundOff],
+              &sbuf[sds[q]+roundOff+sendCounts[q]],
+              &sendBuf[sendOffs[q]] );
+        AllToAll
+        ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+          recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+        for( int q=0; q<commSize; ++q )
+            std::copy
+            ( &recvBuf[recvOffs[q]],
+              &recvBuf[recvOffs[q]+recvCounts[q]],
+              &rbuf[rds[q]+roundOff] );
+    }
+}
+
+} // anonymous namespace
+
+template<typename T>
+void LargeAllToAll
+( const T* sbuf, const Int* scs, const Int* sds,
+        T* rbuf, const Int* rcs, const Int* rds, Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = Size( comm );
+    const Int chunk = AllToAllChunk( commSize );
+    const Int numRounds =
+      AllReduce( NumLocalRounds(scs,commSize,chunk), MAX, comm );
+    LargeAllToAllRounds( sbuf, scs, sds, rbuf, rcs, rds, numRounds, comm );
+}
+
+template<typename T>
+vector<T> LargeAllToAll
+( const vector<T>& sendBuf,
+  const vector<Int>& sendCounts,
+  const vector<Int>& sendOffs,
+  Comm comm )
+{
+    DEBUG_CSE
+    const int commSize = Size( comm );
+    const Int chunk = AllToAllChunk( commSize );
+
+    // Piggyback the number of rounds required by each process's sends on
+    // the exchange of the counts so that agreeing upon the number of rounds
+    // does not require an additional collective
+    const Int numLocalRounds =
+      NumLocalRounds( sendCounts.data(), commSize, chunk );
+    vector<Int> sendMeta(2*commSize), recvMeta(2*commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        sendMeta[2*q] = sendCounts[q];
+        sendMeta[2*q+1] = numLocalRounds;
+    }
+    AllToAll( sendMeta.data(), 2, recvMeta.data(), 2, comm );
+    vector<Int> recvCounts(commSize);
+    Int numRounds = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        recvCounts[q] = recvMeta[2*q];
+        numRounds = Max( numRounds, recvMeta[2*q+1] );
+    }
+
+    vector<Int> recvOffs;
+    const Int totalRecv = El::Scan( recvCounts, recvOffs );
+    vector<T> recvBuf;
+    FastResize( recvBuf, totalRecv );
+    LargeAllToAllRounds
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), numRounds, comm );
+    return recvBuf;
+}
+
 #define MPI_PROTO(T) \
   template bool Test( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
   template void Wait( Request<T>& request ) EL_NO_RELEASE_EXCEPT; \
@@ -2815,6 +3513,8 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllGather( const T* sbuf, int sc, T* rbuf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllGather \
+  ( const T* sbuf, int sc, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void AllGather \
   ( const T* sbuf, int sc, \
           T* rbuf, const int* rcs, const int* rds, Comm comm ) \
@@ -2839,6 +3539,13 @@ EL_NO_RELEASE_EXCEPT
     const vector<int>& sendOffs, \
     Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllToAll \
+  ( const T* sbuf, int sc, \
+          T* rbuf, int rc, Comm comm, Request<T>& request ); \
+  template void IAllToAll \
+  ( const T* sbuf, const int* scs, const int* sds, \
+          T* rbuf, const int* rcs, const int* rds, Comm comm, \
+    Request<T>& request ); \
   template void Reduce \
   ( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
@@ -2866,6 +3573,15 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void AllReduce( T* buf, int count, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IAllReduce \
+  ( const T* sbuf, T* rbuf, int count, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Op op, Comm comm, Request<T>& request ); \
+  template void IAllReduce \
+  ( T* buf, int count, Comm comm, Request<T>& request ); \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* sbuf, T* rbuf, int rc, Comm comm ) \
@@ -2878,6 +3594,11 @@ EL_NO_RELEASE_EXCEPT
   EL_NO_RELEASE_EXCEPT; \
   template void ReduceScatter( T* buf, int rc, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Op op, Comm comm, \
+    Request<T>& request ); \
+  template void IReduceScatter \
+  ( const T* sbuf, T* rbuf, int rc, Comm comm, Request<T>& request ); \
   template void ReduceScatter \
   ( const T* sbuf, T* rbuf, const int* rcs, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
@@ -2895,7 +3616,21 @@ EL_NO_RELEASE_EXCEPT
   template void Scan( T* buf, int count, Op op, Comm comm ) \
   EL_NO_RELEASE_EXCEPT; \
   template void Scan( T* buf, int count, Comm comm ) \
-  EL_NO_RELEASE_EXCEPT;
+  EL_NO_RELEASE_EXCEPT; \
+  template void LargeBroadcast( T* buf, Int count, int root, Comm comm ); \
+  template void LargeSendRecv \
+  ( const T* sbuf, Int sc, int to, \
+          T* rbuf, Int rc, int from, Comm comm ); \
+  template void LargeAllGather \
+  ( const T* sbuf, Int sc, T* rbuf, Int rc, Comm comm ); \
+  template void LargeAllToAll \
+  ( const T* sbuf, const Int* scs, const Int* sds, \
+          T* rbuf, const Int* rcs, const Int* rds, Comm comm ); \
+  template vector<T> LargeAllToAll \
+  ( const vector<T>& sendBuf, \
+    const vector<Int>& sendCounts, \
+    const vector<Int>& sendOffs, \
+    Comm comm );
 
 MPI_PROTO(byte)
 MPI_PROTO(int)
@@ -0,0 +1,407 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "../../blas_like/level3/Batched/Util.hpp"
+
+namespace El {
+
+// Since exceptions may not escape an OpenMP parallel region, the batched
+// factorizations record which members broke down and throw once every
+// member has been processed
+
+template<typename F>
+void BatchedLU( Int m, Int n, Matrix<F>& A, Matrix<Int>& p )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int batchSize = A.Width();
+    const Int minDim = Min(m,n);
+    batched::CheckBatch( A, m*n, batchSize );
+    p.Resize( minDim, batchSize );
+
+    F* ABuf = A.Buffer();
+    Int* pBuf = p.Buffer();
+    const Int ALDim = A.LDim();
+    const Int pLDim = p.LDim();
+    vector<byte> singular( batchSize, false );
+
+    auto groupKernel =
+      [&]( Int first, Int groupSize )
+      {
+          F* AGroup = batched::ThreadBuffer<F,0>( m*n*groupSize );
+          F* inv = batched::ThreadBuffer<F,1>( groupSize );
+          batched::Interleave
+          ( m*n, groupSize, &ABuf[first*ALDim], ALDim, AGroup );
+          auto alpha =
+            [&]( Int i, Int j ) -> F*
+            { return &AGroup[(i+j*m)*groupSize]; };
+
+          for( Int k=0; k<minDim; ++k )
+          {
+              // Find and swap the pivot of each member (0-based, LAPACK-style)
+              for( Int w=0; w<groupSize; ++w )
+              {
+                  Int iPiv = k;
+                  Real pivAbs = Abs(alpha(k,k)[w]);
+                  for( Int i=k+1; i<m; ++i )
+                  {
+                      const Real absVal = Abs(alpha(i,k)[w]);
+                      if( absVal > pivAbs )
+                      {
+                          iPiv = i;
+                          pivAbs = absVal;
+                      }
+                  }
+                  pBuf[k+(first+w)*pLDim] = iPiv;
+                  if( iPiv != k )
+                      for( Int j=0; j<n; ++j )
+                          std::swap( alpha(k,j)[w], alpha(iPiv,j)[w] );
+                  if( pivAbs == Real(0) )
+                      singular[first+w] = true;
+              }
+
+              const F* delta = alpha(k,k);
+              for( Int w=0; w<groupSize; ++w )
+                  inv[w] = ( delta[w] == F(0) ? F(0) : F(1)/delta[w] );
+
+              // a21 := a21 / alpha11
+              for( Int i=k+1; i<m; ++i )
+              {
+                  F* lambda = alpha(i,k);
+                  EL_SIMD
+                  for( Int w=0; w<groupSize; ++w )
+                      lambda[w] *= inv[w];
+              }
+
+              // A22 := A22 - a21 a12
+              for( Int j=k+1; j<n; ++j )
+              {
+                  const F* upsilon = alpha(k,j);
+                  for( Int i=k+1; i<m; ++i )
+                  {
+                      const F* lambda = alpha(i,k);
+                      F* beta = alpha(i,j);
+                      EL_SIMD
+                      for( Int w=0; w<groupSize; ++w )
+                          beta[w] -= lambda[w]*upsilon[w];
+                  }
+              }
+          }
+
+          batched::Deinterleave
+          ( m*n, groupSize, AGroup, &ABuf[first*ALDim], ALDim );
+      };
+    batched::ForEachGroup( batchSize, batched::GroupSize<F>(), groupKernel );
+
+    for( Int j=0; j<batchSize; ++j )
+        if( singular[j] )
+            throw SingularMatrixException();
+}
+
+template<typename F>
+void BatchedLU
+( Int m, Int n, AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, pPre ))
+    DistMatrixReadWriteProxy<F,F,STAR,VR> AProx( APre );
+    auto& A = AProx.Get();
+
+    ElementalProxyCtrl ctrl;
+    ctrl.rowConstrain = true;
+    ctrl.rowAlign = A.RowAlign();
+
+    DistMatrixWriteProxy<Int,Int,STAR,VR> pProx( pPre, ctrl );
+    auto& p = pProx.Get();
+    p.Resize( Min(m,n), A.Width() );
+
+    // Ensure that every process either returns or throws
+    byte singular = false;
+    try { BatchedLU( m, n, A.Matrix(), p.Matrix() ); }
+    catch( SingularMatrixException& ) { singular = true; }
+    singular = mpi::AllReduce( singular, mpi::LOGICAL_OR, A.Grid().Comm() );
+    if( singular )
+        throw SingularMatrixException();
+}
+
+template<typename F>
+void BatchedCholesky( UpperOrLower uplo, Int n, Matrix<F>& A )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int batchSize = A.Width();
+    batched::CheckBatch( A, n*n, batchSize );
+
+    F* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    vector<byte> nonHPD( batchSize, false );
+
+    auto groupKernel =
+      [&]( Int first, Int groupSize )
+      {
+          F* AGroup = batched::ThreadBuffer<F,0>( n*n*groupSize );
+          Real* inv = batched::ThreadBuffer<Real,1>( groupSize );
+          batched::Interleave
+          ( n*n, groupSize, &ABuf[first*ALDim], ALDim, AGroup );
+          auto alpha =
+            [&]( Int i, Int j ) -> F*
+            { return &AGroup[(i+j*n)*groupSize]; };
+
+          for( Int k=0; k<n; ++k )
+          {
+              F* delta = alpha(k,k);
+              for( Int w=0; w<groupSize; ++w )
+              {
+                  const Real deltaReal = RealPart(delta[w]);
+                  if( deltaReal <= Real(0) )
+                  {
+                      nonHPD[first+w] = true;
+                      inv[w] = 0;
+                  }
+                  else
+                  {
+                      delta[w] = Sqrt(deltaReal);
+                      inv[w] = Real(1)/RealPart(delta[w]);
+                  }
+              }
+
+              if( uplo == LOWER )
+              {
+                  // a21 := a21 / alpha11
+                  for( Int i=k+1; i<n; ++i )
+                  {
+                      F* lambda = alpha(i,k);
+                      EL_SIMD
+                      for( Int w=0; w<groupSize; ++w )
+                          lambda[w] *= inv[w];
+                  }
+                  // A22 := A22 - a21 a21^H (lower triangle only)
+                  for( Int j=k+1; j<n; ++j )
+                  {
+                      const F* lambdaj = alpha(j,k);
+                      for( Int i=j; i<n; ++i )
+                      {
+                          const F* lambdai = alpha(i,k);
+                          F* beta = alpha(i,j);
+                          EL_SIMD
+                          for( Int w=0; w<groupSize; ++w )
+                              beta[w] -= lambdai[w]*Conj(lambdaj[w]);
+                      }
+                  }
+              }
+              else
+              {
+                  // a12 := a12 / alpha11
+                  for( Int j=k+1; j<n; ++j )
+                  {
+                      F* upsilon = alpha(k,j);
+                      EL_SIMD
+                      for( Int w=0; w<groupSize; ++w )
+                          upsilon[w] *= inv[w];
+                  }
+                  // A22 := A22 - a12^H a12 (upper triangle only)
+                  for( Int j=k+1; j<n; ++j )
+                  {
+                      const F* upsilonj = alpha(k,j);
+                      for( Int i=k+1; i<=j; ++i )
+                      {
+                          const F* upsiloni = alpha(k,i);
+                          F* beta = alpha(i,j);
+                          EL_SIMD
+                          for( Int w=0; w<groupSize; ++w )
+                              beta[w] -= Conj(upsiloni[w])*upsilonj[w];
+                      }
+                  }
+              }
+          }
+
+          batched::Deinterleave
+          ( n*n, groupSize, AGroup, &ABuf[first*ALDim], ALDim );
+      };
+    batched::ForEachGroup( batchSize, batched::GroupSize<F>(), groupKernel );
+
+    for( Int j=0; j<batchSize; ++j )
+        if( nonHPD[j] )
+            throw NonHPDMatrixException();
+}
+
+template<typename F>
+void BatchedCholesky( UpperOrLower uplo, Int n, AbstractDistMatrix<F>& APre )
+{
+    DEBUG_CSE
+    DistMatrixReadWriteProxy<F,F,STAR,VR> AProx( APre );
+    auto& A = AProx.Get();
+
+    // Ensure that every process either returns or throws
+    byte nonHPD = false;
+    try { BatchedCholesky( uplo, n, A.Matrix() ); }
+    catch( NonHPDMatrixException& ) { nonHPD = true; }
+    nonHPD = mpi::AllReduce( nonHPD, mpi::LOGICAL_OR, A.Grid().Comm() );
+    if( nonHPD )
+        throw NonHPDMatrixException();
+}
+
+template<typename F>
+void BatchedQR
+( Int m, Int n,
+  Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int batchSize = A.Width();
+    const Int minDim = Min(m,n);
+    batched::CheckBatch( A, m*n, batchSize );
+    householderScalars.Resize( minDim, batchSize );
+    signature.Resize( minDim, batchSize );
+
+    F* ABuf = A.Buffer();
+    F* tBuf = householderScalars.Buffer();
+    Real* dBuf = signature.Buffer();
+    const Int ALDim = A.LDim();
+    const Int tLDim = householderScalars.LDim();
+    const Int dLDim = signature.LDim();
+
+    auto groupKernel =
+      [&]( Int first, Int groupSize )
+      {
+          F* AGroup = batched::ThreadBuffer<F,0>( m*n*groupSize );
+          F* tau = batched::ThreadBuffer<F,1>( groupSize );
+          F* zeta = batched::ThreadBuffer<F,2>( groupSize );
+          batched::Interleave
+          ( m*n, groupSize, &ABuf[first*ALDim], ALDim, AGroup );
+          auto alpha =
+            [&]( Int i, Int j ) -> F*
+            { return &AGroup[(i+j*m)*groupSize]; };
+
+          for( Int k=0; k<minDim; ++k )
+          {
+              // Form the reflector of each member (the reflector routine
+              // accepts the strided storage of the interleaved column)
+              for( Int w=0; w<groupSize; ++w )
+              {
+                  F* chi = &alpha(k,k)[w];
+                  F* x = ( k+1 < m ? &alpha(k+1,k)[w] : nullptr );
+                  tau[w] = lapack::Reflector( m-k, *chi, x, groupSize );
+                  tBuf[k+(first+w)*tLDim] = tau[w];
+              }
+
+              // A(k:m,j) := (I - tau [1; v] [1; v]^H) A(k:m,j) for j > k
+              for( Int j=k+1; j<n; ++j )
+              {
+                  // zeta := [1; v]^H A(k:m,j)
+                  const F* alphakj = alpha(k,j);
+                  EL_SIMD
+                  for( Int w=0; w<groupSize; ++w )
+                      zeta[w] = alphakj[w];
+                  for( Int i=k+1; i<m; ++i )
+                  {
+                      const F* nu = alpha(i,k);
+                      const F* beta = alpha(i,j);
+                      EL_SIMD
+                      for( Int w=0; w<groupSize; ++w )
+                          zeta[w] += Conj(nu[w])*beta[w];
+                  }
+                  EL_SIMD
+                  for( Int w=0; w<groupSize; ++w )
+                      zeta[w] *= tau[w];
+
+                  F* alphakjMod = alpha(k,j);
+                  EL_SIMD
+                  for( Int w=0; w<groupSize; ++w )
+                      alphakjMod[w] -= zeta[w];
+                  for( Int i=k+1; i<m; ++i )
+                  {
+                      const F* nu = alpha(i,k);
+                      F* beta = alpha(i,j);
+                      EL_SIMD
+                      for( Int w=0; w<groupSize; ++w )
+                          beta[w] -= nu[w]*zeta[w];
+                  }
+              }
+          }
+
+          // Force the diagonal of R to be non-negative (as in QR)
+          for( Int k=0; k<minDim; ++k )
+          {
+              for( Int w=0; w<groupSize; ++w )
+              {
+                  const Real sgn =
+                    ( RealPart(alpha(k,k)[w]) >= Real(0) ? Real(1) : Real(-1) );
+                  dBuf[k+(first+w)*dLDim] = sgn;
+                  if( sgn < Real(0) )
+                      for( Int j=k; j<n; ++j )
+                          alpha(k,j)[w] = -alpha(k,j)[w];
+              }
+          }
+
+          batched::Deinterleave
+          ( m*n, groupSize, AGroup, &ABuf[first*ALDim], ALDim );
+      };
+    batched::ForEachGroup( batchSize, batched::GroupSize<F>(), groupKernel );
+}
+
+template<typename F>
+void BatchedQR
+( Int m, Int n,
+  AbstractDistMatrix<F>& APre,
+  AbstractDistMatrix<F>& householderScalarsPre,
+  AbstractDistMatrix<Base<F>>& signaturePre )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    typedef Base<F> Real;
+    DistMatrixReadWriteProxy<F,F,STAR,VR> AProx( APre );
+    auto& A = AProx.Get();
+
+    ElementalProxyCtrl ctrl;
+    ctrl.rowConstrain = true;
+    ctrl.rowAlign = A.RowAlign();
+
+    DistMatrixWriteProxy<F,F,STAR,VR>
+      householderScalarsProx( householderScalarsPre, ctrl );
+    DistMatrixWriteProxy<Real,Real,STAR,VR> signatureProx( signaturePre, ctrl );
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+    householderScalars.Resize( Min(m,n), A.Width() );
+    signature.Resize( Min(m,n), A.Width() );
+
+    BatchedQR
+    ( m, n, A.Matrix(), householderScalars.Matrix(), signature.Matrix() );
+}
+
+#define PROTO(F) \
+  template void BatchedLU \
+  ( Int m, Int n, Matrix<F>& A, Matrix<Int>& p ); \
+  template void BatchedLU \
+  ( Int m, Int n, AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p ); \
+  template void BatchedCholesky \
+  ( UpperOrLower uplo, Int n, Matrix<F>& A ); \
+  template void BatchedCholesky \
+  ( UpperOrLower uplo, Int n, AbstractDistMatrix<F>& A ); \
+  template void BatchedQR \
+  ( Int m, Int n, \
+    Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature ); \
+  template void BatchedQR \
+  ( Int m, Int n, \
+    AbstractDistMatrix<F>& A, \
+    AbstractDistMatrix<F>& householderScalars, \
+    AbstractDistMatrix<Base<F>>& signature );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#include <El/macros/Instantiate.h>
+
+} // namespace El
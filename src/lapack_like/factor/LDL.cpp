@@ -87,7 +87,8 @@ template<typename F>
 void LDL
 ( const ldl::NodeInfo& info,
         ldl::Front<F>& front,
-  LDLFrontType newType )
+  LDLFrontType newType,
+  const ldl::MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
     if( !Unfactored(front.type) )
@@ -97,7 +98,7 @@ void LDL
     ChangeFrontType( front, SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( info, front, InitialFactorType(newType) );
+    ldl::Process( info, front, InitialFactorType(newType), ctrl );
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( front, newType );
@@ -107,7 +108,8 @@ template<typename F>
 void LDL
 ( const ldl::DistNodeInfo& info,
         ldl::DistFront<F>& front, 
-  LDLFrontType newType )
+  LDLFrontType newType,
+  const ldl::MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
     if( !Unfactored(front.type) )
@@ -117,7 +119,7 @@ void LDL
     ChangeFrontType( front, SYMM_2D );
 
     // Perform the initial factorization
-    ldl::Process( info, front, InitialFactorType(newType) );
+    ldl::Process( info, front, InitialFactorType(newType), ctrl );
 
     // Convert the fronts from the initial factorization to the requested form
     ChangeFrontType( front, newType );
@@ -191,11 +193,13 @@ void LDL
   template void LDL \
   ( const ldl::NodeInfo& info, \
           ldl::Front<F>& front, \
-    LDLFrontType newType ); \
+    LDLFrontType newType, \
+    const ldl::MultifrontalCtrl& ctrl ); \
   template void LDL \
   ( const ldl::DistNodeInfo& info, \
           ldl::DistFront<F>& front, \
-    LDLFrontType newType );
+    LDLFrontType newType, \
+    const ldl::MultifrontalCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
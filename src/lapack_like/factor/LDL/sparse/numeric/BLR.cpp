@@ -0,0 +1,298 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// Replace the tile S with a truncated SVD, U (Sigma V^H), if that requires
+// less storage than S itself
+template<typename F>
+void Compress( const Matrix<F>& S, BLRTile<F>& tile, double tol )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int m = S.Height();
+    const Int n = S.Width();
+
+    Matrix<F> U, V;
+    Matrix<Real> s;
+    SVDCtrl<Real> ctrl;
+    ctrl.bidiagSVDCtrl.approach = COMPACT_SVD;
+    ctrl.bidiagSVDCtrl.tolType = RELATIVE_TO_MAX_SING_VAL_TOL;
+    ctrl.bidiagSVDCtrl.tol = Real(tol);
+    SVD( S, U, s, V, ctrl );
+
+    const Int rank = s.Height();
+    if( rank*(m+n) < m*n )
+    {
+        tile.lowRank = true;
+        tile.U = std::move(U);
+        Adjoint( V, tile.V );
+        DiagonalScale( LEFT, NORMAL, s, tile.V );
+    }
+    else
+    {
+        tile.lowRank = false;
+        tile.U = S;
+        tile.V.Empty();
+    }
+}
+
+} // anonymous namespace
+
+template<typename F>
+void BLRMatrix<F>::Empty()
+{
+    height = 0;
+    width = 0;
+    SwapClear( offsets );
+    SwapClear( diag );
+    SwapClear( panels );
+}
+
+template<typename F>
+Int BLRMatrix<F>::NumTopLeftEntries() const
+{
+    Int numEntries = 0;
+    for( const auto& D : diag )
+        numEntries += D.Height()*D.Width();
+    return numEntries;
+}
+
+template<typename F>
+Int BLRMatrix<F>::NumBottomLeftEntries() const
+{
+    Int numEntries = 0;
+    for( const auto& panel : panels )
+        for( const auto& tile : panel )
+            numEntries += tile.NumEntries();
+    return numEntries;
+}
+
+template<typename F>
+Int BLRMatrix<F>::NumEntries() const
+{ return NumTopLeftEntries() + NumBottomLeftEntries(); }
+
+template<typename F>
+void BLRMatrix<F>::ForwardSolve( Matrix<F>& X ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( X.Height() != height )
+          LogicError("Nonconformal BLR solve");
+    )
+    const Int numColTiles = diag.size();
+    Matrix<F> Z;
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        auto X1 = X( IR(offsets[k],offsets[k+1]), ALL );
+        Trsm( LEFT, LOWER, NORMAL, UNIT, F(1), diag[k], X1 );
+
+        const Int numBelow = panels[k].size();
+        for( Int t=0; t<numBelow; ++t )
+        {
+            const Int i = k+1+t;
+            const auto& tile = panels[k][t];
+            auto X2 = X( IR(offsets[i],offsets[i+1]), ALL );
+            if( tile.lowRank )
+            {
+                Gemm( NORMAL, NORMAL, F(1), tile.V, X1, Z );
+                Gemm( NORMAL, NORMAL, F(-1), tile.U, Z, F(1), X2 );
+            }
+            else
+                Gemm( NORMAL, NORMAL, F(-1), tile.U, X1, F(1), X2 );
+        }
+    }
+}
+
+template<typename F>
+void BLRMatrix<F>::BackwardSolve( Matrix<F>& X, bool conjugate ) const
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( X.Height() != height )
+          LogicError("Nonconformal BLR solve");
+    )
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+    const Int numColTiles = diag.size();
+    Matrix<F> Z;
+    for( Int k=numColTiles-1; k>=0; --k )
+    {
+        auto X1 = X( IR(offsets[k],offsets[k+1]), ALL );
+
+        const Int numBelow = panels[k].size();
+        for( Int t=0; t<numBelow; ++t )
+        {
+            const Int i = k+1+t;
+            const auto& tile = panels[k][t];
+            auto X2 = X( IR(offsets[i],offsets[i+1]), ALL );
+            if( tile.lowRank )
+            {
+                Gemm( orientation, NORMAL, F(1), tile.U, X2, Z );
+                Gemm( orientation, NORMAL, F(-1), tile.V, Z, F(1), X1 );
+            }
+            else
+                Gemm( orientation, NORMAL, F(-1), tile.U, X2, F(1), X1 );
+        }
+
+        Trsm( LEFT, LOWER, orientation, UNIT, F(1), diag[k], X1, true );
+    }
+}
+
+template<typename F>
+void BLRFactor
+( Matrix<F>& AL,
+  Matrix<F>& ABR,
+  Matrix<F>& d,
+  BLRMatrix<F>& L,
+  bool conjugate,
+  const BLRCtrl& ctrl )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( ABR.Height() != ABR.Width() )
+          LogicError("ABR must be square");
+      if( AL.Height() != AL.Width() + ABR.Width() )
+          LogicError("AL and ABR don't have conformal dimensions");
+    )
+    const Int m = AL.Height();
+    const Int n = AL.Width();
+    const Int bsize = Max( ctrl.tileSize, Int(1) );
+    const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
+
+    L.Empty();
+    L.height = m;
+    L.width = n;
+    for( Int off=0; off<n; off+=bsize )
+        L.offsets.push_back( off );
+    const Int numColTiles = L.offsets.size();
+    for( Int off=n; off<m; off+=bsize )
+        L.offsets.push_back( off );
+    L.offsets.push_back( m );
+    const Int numRowTiles = L.offsets.size()-1;
+    L.diag.resize( numColTiles );
+    L.panels.resize( numColTiles );
+
+    // Tile (i,j), with i >= j, of the trailing matrix: the columns of the
+    // fully-summed tiles are stored in AL and the rest in ABR
+    auto trailingTile =
+      [&]( Int i, Int j, Matrix<F>& ATile )
+      {
+          const Int iBeg = L.offsets[i], iEnd = L.offsets[i+1];
+          const Int jBeg = L.offsets[j], jEnd = L.offsets[j+1];
+          if( j < numColTiles )
+              View( ATile, AL, IR(iBeg,iEnd), IR(jBeg,jEnd) );
+          else
+              View( ATile, ABR, IR(iBeg-n,iEnd-n), IR(jBeg-n,jEnd-n) );
+      };
+
+    Zeros( d, n, 1 );
+    Matrix<F> d1, ATile, M, T;
+    vector<Matrix<F>> SRight;
+    for( Int k=0; k<numColTiles; ++k )
+    {
+        const Range<Int> ind1( L.offsets[k], L.offsets[k+1] );
+        auto AL11 = AL( ind1, ind1 );
+
+        LDL( AL11, conjugate );
+        GetDiagonal( AL11, d1 );
+        auto dView = d( ind1, ALL );
+        dView = d1;
+        L.diag[k] = AL11;
+        MakeTrapezoidal( LOWER, L.diag[k] );
+
+        // Form and compress each tile of S21 = L21 D1, keeping the right
+        // factor of the compressed S21 tile so that L21 D1 need not be
+        // recomputed during the trailing update
+        const Int numBelow = numRowTiles - (k+1);
+        auto& panel = L.panels[k];
+        panel.resize( numBelow );
+        SRight.resize( numBelow );
+        for( Int t=0; t<numBelow; ++t )
+        {
+            const Int i = k+1+t;
+            auto AL21 = AL( IR(L.offsets[i],L.offsets[i+1]), ind1 );
+            Trsm( RIGHT, LOWER, orientation, UNIT, F(1), AL11, AL21 );
+
+            auto& tile = panel[t];
+            Compress( AL21, tile, ctrl.tol );
+            Matrix<F>& right = ( tile.lowRank ? tile.V : tile.U );
+            SRight[t] = right;
+            DiagonalSolve( RIGHT, NORMAL, d1, right );
+        }
+
+        // Update the lower triangle of the trailing matrix with
+        // S21 L21^{T/H}, where tile (i,j) of the update is the product
+        //   (U_i SRight_i) (U_j V_j)^{T/H},
+        // with U_i (or U_j) omitted for dense tiles
+        for( Int tj=0; tj<numBelow; ++tj )
+        {
+            const Int j = k+1+tj;
+            const auto& tileJ = panel[tj];
+            const Matrix<F>& rightJ = ( tileJ.lowRank ? tileJ.V : tileJ.U );
+            for( Int ti=tj; ti<numBelow; ++ti )
+            {
+                const Int i = k+1+ti;
+                const auto& tileI = panel[ti];
+                trailingTile( i, j, ATile );
+
+                Gemm( NORMAL, orientation, F(1), SRight[ti], rightJ, M );
+                const Matrix<F>* left = &M;
+                if( tileI.lowRank )
+                {
+                    Gemm( NORMAL, NORMAL, F(1), tileI.U, M, T );
+                    left = &T;
+                }
+
+                if( tileJ.lowRank )
+                {
+                    if( i == j )
+                        Trrk
+                        ( LOWER, NORMAL, orientation,
+                          F(-1), *left, tileJ.U, F(1), ATile );
+                    else
+                        Gemm
+                        ( NORMAL, orientation,
+                          F(-1), *left, tileJ.U, F(1), ATile );
+                }
+                else
+                {
+                    if( i == j )
+                        AxpyTrapezoid( LOWER, F(-1), *left, ATile );
+                    else
+                        Axpy( F(-1), *left, ATile );
+                }
+            }
+        }
+    }
+    AL.Empty();
+}
+
+#define PROTO(F) \
+  template struct BLRMatrix<F>; \
+  template void BLRFactor \
+  ( Matrix<F>& AL, \
+    Matrix<F>& ABR, \
+    Matrix<F>& d, \
+    BLRMatrix<F>& L, \
+    bool conjugate, \
+    const BLRCtrl& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+template<typename F>
+void DemoteFronts( const Front<F>& front, Front<Demote<F>>& frontLow )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    if( front.spillFile )
+        LogicError("Restore the fronts before demoting them");
+    if( front.LBLR.Compressed() )
+        LogicError("Cannot demote BLR-compressed fronts");
+
+    frontLow.isHermitian = front.isHermitian;
+    frontLow.sparseLeaf = front.sparseLeaf;
+    frontLow.type = front.type;
+    Copy( front.LDense, frontLow.LDense );
+    Copy( front.LSparse, frontLow.LSparse );
+    Copy( front.diag, frontLow.diag );
+    Copy( front.subdiag, frontLow.subdiag );
+    frontLow.p = front.p;
+
+    for( auto* child : frontLow.children )
+        delete child;
+    const Int numChildren = front.children.size();
+    frontLow.children.resize( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+    {
+        frontLow.children[c] = new Front<FLow>(&frontLow);
+        DemoteFronts( *front.children[c], *frontLow.children[c] );
+    }
+}
+
+template<typename F>
+void DemoteFronts( const DistFront<F>& front, DistFront<Demote<F>>& frontLow )
+{
+    DEBUG_CSE
+    typedef Demote<F> FLow;
+    if( front.spillFile )
+        LogicError("Restore the fronts before demoting them");
+
+    frontLow.isHermitian = front.isHermitian;
+    frontLow.type = front.type;
+    const Grid& grid =
+      ( FrontIs1D(front.type) ? front.L1D.Grid() : front.L2D.Grid() );
+    if( front.child == nullptr )
+    {
+        delete frontLow.child;
+        frontLow.child = nullptr;
+        delete frontLow.duplicate;
+        frontLow.duplicate = new Front<FLow>(&frontLow);
+        DemoteFronts( *front.duplicate, *frontLow.duplicate );
+
+        // Attach the views of the sequential factor
+        auto* dup = frontLow.duplicate;
+        if( FrontIs1D(front.type) )
+            frontLow.L1D.Attach( grid, dup->LDense );
+        else
+            frontLow.L2D.Attach( grid, dup->LDense );
+        frontLow.diag.Attach( grid, dup->diag );
+        frontLow.subdiag.Attach( grid, dup->subdiag );
+        frontLow.p.SetGrid( grid );
+        frontLow.p = front.p;
+    }
+    else
+    {
+        delete frontLow.duplicate;
+        frontLow.duplicate = nullptr;
+        delete frontLow.child;
+        frontLow.child = new DistFront<FLow>(&frontLow);
+        DemoteFronts( *front.child, *frontLow.child );
+
+        frontLow.L1D.SetGrid( grid );
+        frontLow.L2D.SetGrid( grid );
+        frontLow.diag.SetGrid( grid );
+        frontLow.subdiag.SetGrid( grid );
+        Copy( front.L1D, frontLow.L1D );
+        Copy( front.L2D, frontLow.L2D );
+        Copy( front.diag, frontLow.diag );
+        Copy( front.subdiag, frontLow.subdiag );
+        frontLow.p.SetGrid( grid );
+        frontLow.p = front.p;
+    }
+}
+
+#define PROTO(F) \
+  template void DemoteFronts \
+  ( const Front<F>& front, Front<Demote<F>>& frontLow ); \
+  template void DemoteFronts \
+  ( const DistFront<F>& front, DistFront<Demote<F>>& frontLow );
+
+// Only double-precision fronts currently have a lower-precision counterpart
+#define PROTO_FLOAT
+#define PROTO_COMPLEX_FLOAT
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -24,14 +24,34 @@ namespace ldl {
 
 template<typename F>
 void DiagonalSolve
-( const NodeInfo& info, const Front<F>& front, MatrixNode<F>& X )
+( const NodeInfo& info, const Front<F>& front, MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
+    if( NeedParallelRegion(ctrl) )
+    {
+        EL_PARALLEL_REGION
+        {
+            EL_SINGLE
+            DiagonalSolve( info, front, X, ctrl );
+        }
+        return;
+    }
 
     const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
-        DiagonalSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    {
+        const NodeInfo* childInfo = info.children[c];
+        const Front<F>* childFront = front.children[c];
+        MatrixNode<F>* childX = X.children[c];
+        if( SpawnTask( *childInfo, ctrl ) )
+        {
+            EL_TASK
+            DiagonalSolve( *childInfo, *childFront, *childX, ctrl );
+        }
+        else
+            DiagonalSolve( *childInfo, *childFront, *childX, ctrl );
+    }
 
     if( PivotedFactorization(front.type) )
         QuasiDiagonalSolve
@@ -39,20 +59,25 @@ void DiagonalSolve
           X.matrix, front.isHermitian );
     else
         DiagonalSolve( LEFT, NORMAL, front.diag, X.matrix, true );
+    EL_TASKWAIT
 }
 
 template<typename F>
 void DiagonalSolve
-( const DistNodeInfo& info, const DistFront<F>& front, DistMultiVecNode<F>& X )
+( const DistNodeInfo& info,
+  const DistFront<F>& front,
+        DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
     if( front.child == nullptr )
     {
-        DiagonalSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        DiagonalSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, ctrl );
         return;
     }
-    DiagonalSolve( *info.child, *front.child, *X.child );
+    DiagonalSolve( *info.child, *front.child, *X.child, ctrl );
 
     if( PivotedFactorization(front.type) )
         QuasiDiagonalSolve
@@ -63,16 +88,20 @@ void DiagonalSolve
 
 template<typename F>
 void DiagonalSolve
-( const DistNodeInfo& info, const DistFront<F>& front, DistMatrixNode<F>& X )
+( const DistNodeInfo& info,
+  const DistFront<F>& front,
+        DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
     if( front.child == nullptr )
     {
-        DiagonalSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        DiagonalSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, ctrl );
         return;
     }
-    DiagonalSolve( *info.child, *front.child, *X.child );
+    DiagonalSolve( *info.child, *front.child, *X.child, ctrl );
 
     if( PivotedFactorization(front.type) )
         QuasiDiagonalSolve
@@ -84,13 +113,13 @@ void DiagonalSolve
 #define PROTO(F) \
   template void DiagonalSolve \
   ( const NodeInfo& info, const Front<F>& front, \
-    MatrixNode<F>& X ); \
+    MatrixNode<F>& X, const MultifrontalCtrl& ctrl ); \
   template void DiagonalSolve \
   ( const DistNodeInfo& info, const DistFront<F>& front, \
-    DistMultiVecNode<F>& X ); \
+    DistMultiVecNode<F>& X, const MultifrontalCtrl& ctrl ); \
   template void DiagonalSolve \
   ( const DistNodeInfo& info, const DistFront<F>& front, \
-    DistMatrixNode<F>& X );
+    DistMatrixNode<F>& X, const MultifrontalCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
@@ -229,6 +229,7 @@ void UnpackEntries
     const Int size = node.size;
     const Int off = node.off;
     const Int lowerSize = node.lowerStruct.size();
+    front.spillFile.reset();
     front.L2D.SetGrid( grid );
     Zeros( front.L2D, size+lowerSize, size );
         
@@ -1077,10 +1078,63 @@ DistFront<F>::operator=( const DistFront<F>& front )
         subdiag = front.subdiag;
         p = front.p;
         work = front.work;
+        spillFile = front.spillFile;
+        spillOffset = front.spillOffset;
+        spillHeight = front.spillHeight;
+        spillWidth = front.spillWidth;
     }
     return *this;
 }
 
+namespace {
+
+// The portion of a front which is spilled to disk
+template<typename F>
+ElementalMatrix<F>& SpilledMatrix( const DistFront<F>& front )
+{
+    if( FrontIs1D(front.type) )
+        return front.L1D;
+    else
+        return front.L2D;
+}
+
+} // anonymous namespace
+
+template<typename F>
+void DistFront<F>::Load() const
+{
+    DEBUG_CSE
+    if( !spillFile )
+        return;
+    // The alignments were kept when the data was freed
+    auto& L = SpilledMatrix( *this );
+    if( L.Height() == spillHeight && L.Width() == spillWidth )
+        return;
+    L.Resize( spillHeight, spillWidth );
+    spillFile->Read( spillOffset, L.Matrix() );
+}
+
+template<typename F>
+void DistFront<F>::Release() const
+{
+    DEBUG_CSE
+    if( spillFile )
+        SpilledMatrix( *this ).EmptyData();
+}
+
+template<typename F>
+void DistFront<F>::Prefetch() const
+{
+    DEBUG_CSE
+    if( !spillFile )
+        return;
+    const auto& L = SpilledMatrix( *this );
+    const Int localHeight =
+      Length( spillHeight, L.ColShift(), L.ColStride() );
+    const Int localWidth = Length( spillWidth, L.RowShift(), L.RowStride() );
+    spillFile->Prefetch( spillOffset, localHeight*localWidth*sizeof(F) );
+}
+
 template<typename F>
 Int DistFront<F>::NumLocalEntries() const
 {
@@ -102,6 +102,8 @@ void Front<F>::Pull
         // Mark this node as a sparse leaf if it does not have any children
         if( numChildren == 0 )
             front.sparseLeaf = true;
+        front.spillFile.reset();
+        front.LBLR.Empty();
 
         const Int lowerSize = node.lowerStruct.size();
         const F* AValBuf = A.LockedValueBuffer();
@@ -309,6 +311,8 @@ void Front<F>::Push
       {
           for( const Front<F>* child : front.children )
               countLower( *child );
+          if( front.LBLR.Compressed() )
+              LogicError("Block low-rank fronts are not supported");
           const Int nodeSize = front.LDense.Width();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
@@ -422,6 +426,8 @@ void Front<F>::Unpack( SparseMatrix<F>& A, const NodeInfo& rootInfo ) const
       {
           for( const Front<F>* child : front.children )
               countLower( *child );
+          if( front.LBLR.Compressed() )
+              LogicError("Block low-rank fronts are not supported");
           const Int nodeSize = front.LDense.Width();
           const Int structSize = front.Height() - nodeSize;
           numLower += (nodeSize*(nodeSize+1))/2 + nodeSize*structSize;
@@ -530,11 +536,16 @@ const Front<F>& Front<F>::operator=( const Front<F>& front )
     type = front.type;
     LDense = front.LDense;
     LSparse = front.LSparse;
+    LBLR = front.LBLR;
     diag = front.diag;
     subdiag = front.subdiag;
     p = front.p;
     workDense = front.workDense;
     workSparse = front.workSparse;
+    spillFile = front.spillFile;
+    spillOffset = front.spillOffset;
+    spillHeight = front.spillHeight;
+    spillWidth = front.spillWidth;
     // Do not copy parent...
     // Delete any existing children
     for( auto* child : children )
@@ -549,9 +560,42 @@ const Front<F>& Front<F>::operator=( const Front<F>& front )
     return *this;
 }
 
+template<typename F>
+void Front<F>::Load() const
+{
+    DEBUG_CSE
+    if( !spillFile ||
+        (LDense.Height() == spillHeight && LDense.Width() == spillWidth) )
+        return;
+    LDense.Resize( spillHeight, spillWidth );
+    spillFile->Read( spillOffset, LDense );
+}
+
+template<typename F>
+void Front<F>::Release() const
+{
+    DEBUG_CSE
+    if( spillFile )
+        LDense.Empty();
+}
+
+template<typename F>
+void Front<F>::Prefetch() const
+{
+    DEBUG_CSE
+    if( spillFile )
+        spillFile->Prefetch( spillOffset, spillHeight*spillWidth*sizeof(F) );
+}
+
 template<typename F>
 Int Front<F>::Height() const
-{ return sparseLeaf ? LDense.Height()+LDense.Width() : LDense.Height(); }
+{
+    if( LBLR.Compressed() )
+        return LBLR.height;
+    const Int height = ( spillFile ? spillHeight : LDense.Height() );
+    const Int width = ( spillFile ? spillWidth : LDense.Width() );
+    return sparseLeaf ? height+width : height;
+}
 
 template<typename F>
 Int Front<F>::NumEntries() const
@@ -586,6 +630,7 @@ Int Front<F>::NumEntries() const
         {
             // Add in L
             numEntries += front.LDense.Height() * front.LDense.Width();
+            numEntries += front.LBLR.NumEntries();
         }
         // Add in the workspace for the Schur complement
         numEntries += front.workDense.Height()*front.workDense.Width(); 
@@ -619,6 +664,10 @@ Int Front<F>::NumTopLeftEntries() const
                 numEntries += numSparseEntries;
             }
         }
+        else if( front.LBLR.Compressed() )
+        {
+            numEntries += front.LBLR.NumTopLeftEntries();
+        }
         else
         {
             const Int n = front.LDense.Width();
@@ -645,6 +694,10 @@ Int Front<F>::NumBottomLeftEntries() const
         {
             numEntries += m*n;
         }
+        else if( front.LBLR.Compressed() )
+        {
+            numEntries += front.LBLR.NumBottomLeftEntries();
+        }
         else
         {
             numEntries += (m-n)*n;
@@ -664,8 +717,12 @@ double Front<F>::FactorGFlops() const
       {
         for( auto* child : front.children )
             count( *child );
-        const double m = front.LDense.Height();
-        const double n = front.LDense.Width();
+        // Compressed fronts are counted as though they were dense
+        const bool compressed = front.LBLR.Compressed();
+        const double m =
+          ( compressed ? front.LBLR.height : front.LDense.Height() );
+        const double n =
+          ( compressed ? front.LBLR.width : front.LDense.Width() );
         double realFrontFlops=0;
         if( front.sparseLeaf )
         {
@@ -716,6 +773,10 @@ double Front<F>::SolveGFlops( Int numRHS ) const
             const double numEntries = front.LSparse.NumEntries();
             realFrontFlops = (numEntries+m*n)*numRHS;
         }
+        else if( front.LBLR.Compressed() )
+        {
+            realFrontFlops = front.LBLR.NumEntries()*numRHS;
+        }
         else
         {
             realFrontFlops = m*n*numRHS;
@@ -32,7 +32,8 @@ bool FrontIs1D( LDLFrontType type )
            type == LDL_INTRAPIV_1D        ||
            type == LDL_INTRAPIV_SELINV_1D ||
            type == BLOCK_LDL_1D           ||
-           type == BLOCK_LDL_INTRAPIV_1D;
+           type == BLOCK_LDL_INTRAPIV_1D  ||
+           type == BLR_LDL_1D;
 }
 
 bool BlockFactorization( LDLFrontType type )
@@ -43,6 +44,9 @@ bool BlockFactorization( LDLFrontType type )
            type == BLOCK_LDL_INTRAPIV_2D;
 }
 
+bool BLRFactorization( LDLFrontType type )
+{ return type == BLR_LDL_1D || type == BLR_LDL_2D; }
+
 bool SelInvFactorization( LDLFrontType type )
 {
     return type == LDL_SELINV_1D ||
@@ -81,6 +85,8 @@ LDLFrontType ConvertTo2D( LDLFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_2D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_2D;  break;
+    case BLR_LDL_1D:
+    case BLR_LDL_2D:             newType = BLR_LDL_2D;             break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -106,6 +112,8 @@ LDLFrontType ConvertTo1D( LDLFrontType type )
     case BLOCK_LDL_2D:           newType = BLOCK_LDL_1D;           break;
     case BLOCK_LDL_INTRAPIV_1D:
     case BLOCK_LDL_INTRAPIV_2D:  newType = BLOCK_LDL_INTRAPIV_1D;  break;
+    case BLR_LDL_1D:
+    case BLR_LDL_2D:             newType = BLR_LDL_1D;             break;
     default: LogicError("Invalid front type");
     }
     return newType;
@@ -145,7 +153,7 @@ LDLFrontType InitialFactorType( LDLFrontType type )
 {
     if( Unfactored(type) )
         LogicError("Front type does not require factorization");
-    if( BlockFactorization(type) )
+    if( BlockFactorization(type) || BLRFactorization(type) )
         return ConvertTo2D(type);
     else if( PivotedFactorization(type) )
         return LDL_INTRAPIV_2D;
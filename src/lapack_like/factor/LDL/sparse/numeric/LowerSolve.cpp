@@ -19,13 +19,15 @@ void LowerSolve
 ( Orientation orientation,
   const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
     if( orientation == NORMAL )
-        LowerForwardSolve( info, front, X );
+        LowerForwardSolve( info, front, X, ctrl );
     else
-        LowerBackwardSolve( info, front, X, orientation==ADJOINT );
+        LowerBackwardSolve
+        ( info, front, X, orientation==ADJOINT, ctrl );
 }
 
 template<typename F>
@@ -33,13 +35,15 @@ void LowerSolve
 ( Orientation orientation,
   const DistNodeInfo& info, 
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
     if( orientation == NORMAL )
-        LowerForwardSolve( info, front, X );
+        LowerForwardSolve( info, front, X, ctrl );
     else
-        LowerBackwardSolve( info, front, X, orientation==ADJOINT );
+        LowerBackwardSolve
+        ( info, front, X, orientation==ADJOINT, ctrl );
 }
 
 template<typename F>
@@ -47,13 +51,15 @@ void LowerSolve
 ( Orientation orientation,
   const DistNodeInfo& info, 
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
     if( orientation == NORMAL )
-        LowerForwardSolve( info, front, X );
+        LowerForwardSolve( info, front, X, ctrl );
     else
-        LowerBackwardSolve( info, front, X, orientation==ADJOINT );
+        LowerBackwardSolve
+        ( info, front, X, orientation==ADJOINT, ctrl );
 }
 
 #define PROTO(F) \
@@ -61,17 +67,20 @@ void LowerSolve
   ( Orientation orientation, \
     const NodeInfo& info, \
     const Front<F>& front, \
-          MatrixNode<F>& X ); \
+          MatrixNode<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template void LowerSolve \
   ( Orientation orientation, \
     const DistNodeInfo& info, \
     const DistFront<F>& front, \
-          DistMultiVecNode<F>& X ); \
+          DistMultiVecNode<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template void LowerSolve \
   ( Orientation orientation, \
     const DistNodeInfo& info, \
     const DistFront<F>& front, \
-          DistMatrixNode<F>& X );
+          DistMatrixNode<F>& X, \
+    const MultifrontalCtrl& ctrl );
 
 #define EL_NO_INT_PROTO
 #define EL_ENABLE_DOUBLEDOUBLE
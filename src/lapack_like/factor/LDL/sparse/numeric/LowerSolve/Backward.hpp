@@ -29,9 +29,19 @@ template<typename F>
 inline void LowerBackwardSolve
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X, bool conjugate )
+        MatrixNode<F>& X, bool conjugate,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
+    if( NeedParallelRegion(ctrl) )
+    {
+        EL_PARALLEL_REGION
+        {
+            EL_SINGLE
+            LowerBackwardSolve( info, front, X, conjugate, ctrl );
+        }
+        return;
+    }
 
     auto* dupMV = X.duplicateMV;
     auto* dupMat = X.duplicateMat;
@@ -45,7 +55,11 @@ inline void LowerBackwardSolve
                                      : (haveDupMatParent ? dupMat->work.Matrix()
                                                          : X.matrix)));
 
+    front.Load();
+    if( front.spillFile )
+        PrefetchBackwardSuccessor( front );
     FrontLowerBackwardSolve( front, W, conjugate );
+    front.Release();
 
     const Int numRHS = X.matrix.Width();
     if( haveParent || haveDupMVParent || haveDupMatParent )
@@ -79,26 +93,44 @@ inline void LowerBackwardSolve
         dupMat->work.Empty();
 
     for( Int c=0; c<numChildren; ++c )
-        LowerBackwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c], conjugate );
+    {
+        const NodeInfo* childInfo = info.children[c];
+        const Front<F>* childFront = front.children[c];
+        MatrixNode<F>* childX = X.children[c];
+        if( SpawnTask( *childInfo, ctrl ) )
+        {
+            EL_TASK
+            LowerBackwardSolve
+            ( *childInfo, *childFront, *childX, conjugate, ctrl );
+        }
+        else
+            LowerBackwardSolve
+            ( *childInfo, *childFront, *childX, conjugate, ctrl );
+    }
+    EL_TASKWAIT
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
-  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate )
+  const DistFront<F>& front, DistMultiVecNode<F>& X, bool conjugate,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate,
+          conjugate, ctrl );
         return;
     }
 
     const bool haveParent = ( X.parent != nullptr );
     auto& W = ( haveParent ? X.work : X.matrix );
+    front.Load();
+    PrefetchBackwardSuccessor( front );
     FrontLowerBackwardSolve( front, W, conjugate );
+    front.Release();
 
     const Int numRHS = X.matrix.Width();
     if( haveParent )
@@ -117,7 +149,7 @@ inline void LowerBackwardSolve
     const Grid& childGrid =
       ( frontIs1D ? childFront.L1D.Grid() : childFront.L2D.Grid() );
     const Int childFrontHeight =
-      ( frontIs1D ? childFront.L1D.Height() : childFront.L2D.Height() );
+      info.child->size + info.child->lowerStruct.size();
     auto& childW = X.child->work;
     childW.SetGrid( childGrid );
     childW.Resize( childFrontHeight, numRHS );
@@ -183,26 +215,32 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, ctrl );
 }
 
 template<typename F>
 inline void LowerBackwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X, bool conjugate )
+        DistMatrixNode<F>& X, bool conjugate,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
     if( front.duplicate != nullptr )
     {
         LowerBackwardSolve
-        ( *info.duplicate, *front.duplicate, *X.duplicate, conjugate );
+        ( *info.duplicate, *front.duplicate, *X.duplicate,
+          conjugate, ctrl );
         return;
     }
 
     const bool haveParent = ( X.parent != nullptr );
     auto& W = ( haveParent ? X.work : X.matrix );
+    front.Load();
+    PrefetchBackwardSuccessor( front );
     FrontLowerBackwardSolve( front, W, conjugate );
+    front.Release();
 
     const Int numRHS = X.matrix.Width();
     if( haveParent )
@@ -218,7 +256,8 @@ inline void LowerBackwardSolve
           LogicError("Incompatible front type mixture");
     )
     const Grid& childGrid = childFront.L2D.Grid();
-    const Int childFrontHeight = childFront.L2D.Height();
+    const Int childFrontHeight =
+      info.child->size + info.child->lowerStruct.size();
     auto& childW = X.child->work;
     childW.SetGrid( childGrid );
     childW.Align( 0, 0 );
@@ -291,7 +330,8 @@ inline void LowerBackwardSolve
     SwapClear( recvSizes );
     SwapClear( recvOffs );
 
-    LowerBackwardSolve( *info.child, *front.child, *X.child, conjugate );
+    LowerBackwardSolve
+    ( *info.child, *front.child, *X.child, conjugate, ctrl );
 }
 
 } // namespace ldl
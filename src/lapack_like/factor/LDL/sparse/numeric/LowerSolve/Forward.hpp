@@ -29,14 +29,35 @@ template<typename F>
 void LowerForwardSolve
 ( const NodeInfo& info, 
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
+    if( NeedParallelRegion(ctrl) )
+    {
+        EL_PARALLEL_REGION
+        {
+            EL_SINGLE
+            LowerForwardSolve( info, front, X, ctrl );
+        }
+        return;
+    }
 
     const Int numChildren = info.children.size();
     for( Int c=0; c<numChildren; ++c )
-        LowerForwardSolve
-        ( *info.children[c], *front.children[c], *X.children[c] );
+    {
+        const NodeInfo* childInfo = info.children[c];
+        const Front<F>* childFront = front.children[c];
+        MatrixNode<F>* childX = X.children[c];
+        if( SpawnTask( *childInfo, ctrl ) )
+        {
+            EL_TASK
+            LowerForwardSolve( *childInfo, *childFront, *childX, ctrl );
+        }
+        else
+            LowerForwardSolve( *childInfo, *childFront, *childX, ctrl );
+    }
+    EL_TASKWAIT
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is not a parent 
@@ -68,7 +89,11 @@ void LowerForwardSolve
     }
 
     // Solve against this front
+    front.Load();
+    if( front.spillFile )
+        PrefetchForwardSuccessor( front );
     FrontLowerForwardSolve( front, W );
+    front.Release();
 
     // Store this node's portion of the result
     X.matrix = WT;
@@ -78,7 +103,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
 
@@ -86,7 +112,8 @@ void LowerForwardSolve
     const Grid& grid = ( frontIs1D ? front.L1D.Grid() : front.L2D.Grid() );
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, ctrl );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -98,7 +125,10 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, ctrl );
+    front.Load();
+    if( front.parent != nullptr )
+        front.parent->Prefetch();
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -174,6 +204,7 @@ void LowerForwardSolve
 
     // Now that the RHS is set up, perform this node's solve
     FrontLowerForwardSolve( front, W );
+    front.Release();
 
     // Unpack the workspace
     X.matrix = WT;
@@ -183,7 +214,8 @@ template<typename F>
 void LowerForwardSolve
 ( const DistNodeInfo& info,
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
     DEBUG_ONLY(
@@ -194,7 +226,8 @@ void LowerForwardSolve
     const Grid& grid = front.L2D.Grid();
     if( front.duplicate != nullptr )
     {
-        LowerForwardSolve( *info.duplicate, *front.duplicate, *X.duplicate );
+        LowerForwardSolve
+        ( *info.duplicate, *front.duplicate, *X.duplicate, ctrl );
         X.work.LockedAttach( grid, X.duplicate->work );
         return;
     }
@@ -206,7 +239,10 @@ void LowerForwardSolve
           LogicError("Incompatible front type mixture");
     )
 
-    LowerForwardSolve( childInfo, childFront, *X.child );
+    LowerForwardSolve( childInfo, childFront, *X.child, ctrl );
+    front.Load();
+    if( front.parent != nullptr )
+        front.parent->Prefetch();
 
     // Set up a workspace
     // TODO: Only set up a workspace if there is a parent
@@ -293,6 +329,7 @@ void LowerForwardSolve
 
     // Now that the RHS is set up, perform this node's solve
     FrontLowerForwardSolve( front, W );
+    front.Release();
 
     // Store this node's portion of the result
     X.matrix = WT;
@@ -686,7 +686,9 @@ void FrontLowerBackwardSolve
     }
     else
     {
-        if( BlockFactorization(type) )
+        if( front.LBLR.Compressed() )
+            front.LBLR.BackwardSolve( W, conjugate );
+        else if( BlockFactorization(type) )
             FrontBlockLowerBackwardSolve( front.LDense, W, conjugate );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerBackwardSolve
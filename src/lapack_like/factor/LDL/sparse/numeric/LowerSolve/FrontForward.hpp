@@ -115,7 +115,9 @@ void FrontLowerForwardSolve( const Front<F>& front, Matrix<F>& W )
     }
     else
     {
-        if( BlockFactorization(type) )
+        if( front.LBLR.Compressed() )
+            front.LBLR.ForwardSolve( W );
+        else if( BlockFactorization(type) )
             FrontBlockLowerForwardSolve( front.LDense, W );
         else if( PivotedFactorization(type) )
             FrontIntraPivLowerForwardSolve( front.LDense, front.p, W );
@@ -23,6 +23,71 @@
 namespace El {
 namespace ldl {
 
+// Begin reading the (spilled) front which follows the given one in the
+// postorder traversal of the forward solve
+template<typename F>
+void PrefetchForwardSuccessor( const Front<F>& front )
+{
+    const Front<F>* parent = front.parent;
+    if( parent == nullptr )
+    {
+        if( front.duplicate != nullptr && front.duplicate->parent != nullptr )
+            front.duplicate->parent->Prefetch();
+        return;
+    }
+    const Int numSiblings = parent->children.size();
+    Int c = 0;
+    while( parent->children[c] != &front )
+        ++c;
+    if( c+1 == numSiblings )
+    {
+        parent->Prefetch();
+        return;
+    }
+    const Front<F>* next = parent->children[c+1];
+    while( !next->children.empty() )
+        next = next->children[0];
+    next->Prefetch();
+}
+
+// Begin reading the (spilled) front which follows the given one in the
+// preorder traversal of the backward solve
+template<typename F>
+void PrefetchBackwardSuccessor( const Front<F>& front )
+{
+    if( !front.children.empty() )
+    {
+        front.children[0]->Prefetch();
+        return;
+    }
+    const Front<F>* node = &front;
+    while( node->parent != nullptr )
+    {
+        const auto& siblings = node->parent->children;
+        const Int numSiblings = siblings.size();
+        Int c = 0;
+        while( siblings[c] != node )
+            ++c;
+        if( c+1 < numSiblings )
+        {
+            siblings[c+1]->Prefetch();
+            return;
+        }
+        node = node->parent;
+    }
+}
+
+template<typename F>
+void PrefetchBackwardSuccessor( const DistFront<F>& front )
+{
+    if( front.child == nullptr )
+        return;
+    if( front.child->duplicate != nullptr )
+        front.child->duplicate->Prefetch();
+    else
+        front.child->Prefetch();
+}
+
 template<typename F>
 void FormDiagonalBlocks
 ( const DistMatrix<F,VC,STAR>& L, DistMatrix<F,STAR,STAR>& D, bool conjugate )
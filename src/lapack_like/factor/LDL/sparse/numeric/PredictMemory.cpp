@@ -0,0 +1,109 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+namespace ldl {
+
+namespace {
+
+// The entries of the fronts of a sequential subtree (the leaves hold sparse
+// factors of their diagonal blocks)
+double FactorEntries( const NodeInfo& node )
+{
+    double numEntries = 0;
+    for( const NodeInfo* child : node.children )
+        numEntries += FactorEntries( *child );
+
+    const double size = node.size;
+    const double lowerSize = node.lowerStruct.size();
+    if( node.children.empty() && !node.LOffsets.empty() )
+        numEntries += node.LOffsets.back() + size + size*lowerSize;
+    else
+        numEntries += size*(size+lowerSize);
+    return numEntries;
+}
+
+// When independent subtrees are processed concurrently, the update matrix of
+// a node is formed before its children are processed, and the children which
+// are traversed by separate tasks may all be active at once
+double PeakWorkEntries( const NodeInfo& node, const MultifrontalCtrl& ctrl )
+{
+    if( !ctrl.parallelTree || node.children.empty() )
+        return node.peakWorkEntries;
+
+    const double lowerSize = node.lowerStruct.size();
+    double peak = lowerSize*lowerSize;
+    for( const NodeInfo* child : node.children )
+        peak +=
+          ( SpawnTask(*child,ctrl) ? PeakWorkEntries(*child,ctrl)
+                                   : child->peakWorkEntries );
+    return Max( peak, lowerSize*(lowerSize+node.size) );
+}
+
+} // anonymous namespace
+
+MemoryPrediction PredictMemory
+( const NodeInfo& rootInfo, const MultifrontalCtrl& ctrl )
+{
+    DEBUG_CSE
+    MemoryPrediction prediction;
+    prediction.factorEntries = FactorEntries( rootInfo );
+    prediction.peakWorkEntries = PeakWorkEntries( rootInfo, ctrl );
+    return prediction;
+}
+
+MemoryPrediction PredictMemory
+( const DistNodeInfo& rootInfo, const MultifrontalCtrl& ctrl )
+{
+    DEBUG_CSE
+    // The distributed nodes are processed one at a time, from the bottom of
+    // the tree up, and each only holds onto the update of its child (along
+    // with the buffers for redistributing the updates of both children)
+    MemoryPrediction prediction;
+    const DistNodeInfo* node = &rootInfo;
+    while( node->duplicate == nullptr )
+    {
+        const double teamSize = mpi::Size( node->comm );
+        const double childTeamSize = mpi::Size( node->child->comm );
+        const double size = node->size;
+        const double lowerSize = node->lowerStruct.size();
+        prediction.factorEntries += size*(size+lowerSize) / teamSize;
+
+        const Int myChild = ( node->child->onLeft ? 0 : 1 );
+        double childUpdateSizes[2];
+        for( Int c=0; c<2; ++c )
+            childUpdateSizes[c] = node->childRelInds[c].size();
+        const double myChildUpdateSize = childUpdateSizes[myChild];
+        const double childEntries =
+          myChildUpdateSize*myChildUpdateSize / childTeamSize;
+        const double sendEntries =
+          myChildUpdateSize*(myChildUpdateSize+1) / (2*childTeamSize);
+        double recvEntries = 0;
+        for( Int c=0; c<2; ++c )
+            recvEntries +=
+              childUpdateSizes[c]*(childUpdateSizes[c]+1) / (2*teamSize);
+        const double updateEntries = lowerSize*lowerSize / teamSize;
+        const double frontPeak = updateEntries + lowerSize*size / teamSize;
+
+        const double peak =
+          Max( Max( childEntries+sendEntries, sendEntries+recvEntries ),
+               Max( recvEntries+updateEntries, frontPeak ) );
+        prediction.peakWorkEntries = Max( prediction.peakWorkEntries, peak );
+        node = node->child;
+    }
+    const auto localPrediction = PredictMemory( *node->duplicate, ctrl );
+    prediction.factorEntries += localPrediction.factorEntries;
+    prediction.peakWorkEntries =
+      Max( prediction.peakWorkEntries, localPrediction.peakWorkEntries );
+    return prediction;
+}
+
+} // namespace ldl
+} // namespace El
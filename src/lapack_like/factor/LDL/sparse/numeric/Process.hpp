@@ -25,128 +25,217 @@
 namespace El {
 namespace ldl {
 
+template<typename F>
+inline void ProcessLeaf
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+{
+    DEBUG_CSE
+    front.type = factorType;
+    const Int m = front.LDense.Height();
+    const Int n = front.LDense.Width();
+    const Int numEntries = info.LOffsets.back();
+    const Int numSources = info.LOffsets.size()-1;
+
+    // TODO: Add support for pivoting here
+    if( PivotedFactorization(factorType) )
+        Zeros( front.subdiag, n-1, 1 );
+
+    Zeros( front.LSparse, numSources, numSources );
+    front.LSparse.ForceNumEntries( numEntries );
+    F* LValBuf = front.LSparse.ValueBuffer();
+    Int* LRowBuf = front.LSparse.SourceBuffer();
+    Int* LColBuf = front.LSparse.TargetBuffer();
+    Int* LOffsetBuf = front.LSparse.OffsetBuffer();
+
+    for( Int i=0; i<numSources; ++i )
+    {
+        const Int iStart = info.LOffsets[i];
+        const Int iEnd = info.LOffsets[i+1];
+        LOffsetBuf[i] = iStart;
+        for( Int e=iStart; e<iEnd; ++e )
+            LRowBuf[e] = i;
+    }
+    LOffsetBuf[numSources] = info.LOffsets[numSources];
+    front.diag.Resize( numSources, 1 );
+
+    // Factor the transpose of L
+    // TODO: Reuse these workspaces
+    vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
+    vector<F> y(numSources);
+    suite_sparse::ldl::Numeric
+    ( numSources,
+      front.workSparse.LockedOffsetBuffer(),
+      front.workSparse.LockedTargetBuffer(),
+      front.workSparse.LockedValueBuffer(),
+      LOffsetBuf,
+      info.LParents.data(),
+      LNnz.data(),
+      LColBuf,
+      LValBuf,
+      front.diag.Buffer(),
+      y.data(),
+      pattern.data(),
+      flag.data(),
+      (const Int*)nullptr,
+      (const Int*)nullptr,
+      front.isHermitian );
+    front.LSparse.ForceConsistency();
+
+    // Solve against L_{TL}^T from the right
+    bool onLeft = false;
+    suite_sparse::ldl::LTSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
+
+    // Save a copy of ABL
+    auto ABLCopy = front.LDense;
+
+    // Solve against the diagonal
+    suite_sparse::ldl::DSolveMulti
+    ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
+      front.diag.Buffer() );
+
+    // Form the Schur complement
+    Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
+    Trrk
+    ( LOWER, NORMAL, orientation,
+      F(-1), front.LDense, ABLCopy, F(0), front.workDense );
+}
+
+// Add the update matrix of child c into the front
+template<typename F>
+inline void ExtendAdd
+( const NodeInfo& info, Front<F>& front, Int c, bool threaded )
+{
+    DEBUG_CSE
+    const Matrix<F>& childU = front.children[c]->workDense;
+    const Int childUSize = childU.Height();
+    const vector<Int>& relInds = info.childRelInds[c];
+    auto& FL = front.LDense;
+    auto& FBR = front.workDense;
+    auto addColumn =
+      [&]( Int jChild )
+      {
+          const Int j = relInds[jChild];
+          for( Int iChild=jChild; iChild<childUSize; ++iChild )
+          {
+              const Int i = relInds[iChild];
+              const F value = childU(iChild,jChild);
+              if( j < info.size )
+                  FL(i,j) += value;
+              else
+                  FBR(i-info.size,j-info.size) += value;
+          }
+      };
+    if( threaded )
+    {
+        // Each column of the child update is added into a distinct column
+        EL_TASKLOOP
+        for( Int jChild=0; jChild<childUSize; ++jChild )
+            addColumn( jChild );
+    }
+    else
+    {
+        for( Int jChild=0; jChild<childUSize; ++jChild )
+            addColumn( jChild );
+    }
+    front.children[c]->workDense.Empty();
+}
+
+// When ctrl.parallelTree is true, a task is spawned for each child subtree
+// which contains at least ctrl.minTaskSize variables
 template<typename F> 
 inline void 
-Process( const NodeInfo& info, Front<F>& front, LDLFrontType factorType )
+Process
+( const NodeInfo& info, Front<F>& front, LDLFrontType factorType,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
+    if( NeedParallelRegion(ctrl) )
+    {
+        EL_PARALLEL_REGION
+        {
+            EL_SINGLE
+            Process( info, front, factorType, ctrl );
+        }
+        return;
+    }
+
     const int updateSize = info.lowerStruct.size();
     auto& FBR = front.workDense;
     FBR.Empty();
-    Zeros( FBR, updateSize, updateSize );
 
     if( front.sparseLeaf )
     {
-        front.type = factorType;
-        const Int m = front.LDense.Height();
-        const Int n = front.LDense.Width();
-        const Int numEntries = info.LOffsets.back();
-        const Int numSources = info.LOffsets.size()-1;
-
-        // TODO: Add support for pivoting here
-        if( PivotedFactorization(factorType) )
-            Zeros( front.subdiag, n-1, 1 );
-
-        Zeros( front.LSparse, numSources, numSources );
-        front.LSparse.ForceNumEntries( numEntries );
-        F* LValBuf = front.LSparse.ValueBuffer();
-        Int* LRowBuf = front.LSparse.SourceBuffer();
-        Int* LColBuf = front.LSparse.TargetBuffer();
-        Int* LOffsetBuf = front.LSparse.OffsetBuffer();
-
-        for( Int i=0; i<numSources; ++i )
+        Zeros( FBR, updateSize, updateSize );
+        ProcessLeaf( info, front, factorType );
+        return;
+    }
+
+    DEBUG_ONLY(
+      auto& FL = front.LDense;
+      if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
+          LogicError("Front was not the proper size");
+    )
+    const int numChildren = info.children.size();
+    if( ctrl.parallelTree )
+    {
+        // The children are independent, but their updates can only be added
+        // in after they have all been processed
+        MultifrontalCtrl seqCtrl( ctrl );
+        seqCtrl.parallelTree = false;
+        Zeros( FBR, updateSize, updateSize );
+        for( Int c=0; c<numChildren; ++c )
+        {
+            const NodeInfo* childInfo = info.children[c];
+            Front<F>* childFront = front.children[c];
+            if( SpawnTask( *childInfo, ctrl ) )
+            {
+                EL_TASK
+                Process( *childInfo, *childFront, factorType, ctrl );
+            }
+            else
+                Process( *childInfo, *childFront, factorType, seqCtrl );
+        }
+        EL_TASKWAIT
+        for( Int c=0; c<numChildren; ++c )
         {
-            const Int iStart = info.LOffsets[i];
-            const Int iEnd = info.LOffsets[i+1];
-            LOffsetBuf[i] = iStart;
-            for( Int e=iStart; e<iEnd; ++e )
-                LRowBuf[e] = i;
+            const Int childUSize = front.children[c]->workDense.Height();
+            ExtendAdd
+            ( info, front, c, childUSize >= ctrl.minThreadedUpdateSize );
         }
-        LOffsetBuf[numSources] = info.LOffsets[numSources];
-        front.diag.Resize( numSources, 1 );
-
-        // Factor the transpose of L
-        // TODO: Reuse these workspaces
-        vector<Int> LNnz(numSources), pattern(numSources), flag(numSources);
-        vector<F> y(numSources);
-        suite_sparse::ldl::Numeric
-        ( numSources,
-          front.workSparse.LockedOffsetBuffer(),
-          front.workSparse.LockedTargetBuffer(),
-          front.workSparse.LockedValueBuffer(),
-          LOffsetBuf,
-          info.LParents.data(),
-          LNnz.data(),
-          LColBuf,
-          LValBuf,
-          front.diag.Buffer(),
-          y.data(),
-          pattern.data(),
-          flag.data(),
-          (const Int*)nullptr,
-          (const Int*)nullptr,
-          front.isHermitian );
-        front.LSparse.ForceConsistency();
-
-        // Solve against L_{TL}^T from the right
-        bool onLeft = false;
-        suite_sparse::ldl::LTSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          LOffsetBuf, LColBuf, LValBuf, front.isHermitian );
-
-        // Save a copy of ABL
-        auto ABLCopy = front.LDense;
-
-        // Solve against the diagonal
-        suite_sparse::ldl::DSolveMulti
-        ( onLeft, m, n, front.LDense.Buffer(), front.LDense.LDim(),
-          front.diag.Buffer() );
-
-        // Form the Schur complement
-        Orientation orientation = ( front.isHermitian ? ADJOINT : TRANSPOSE );
-        Trrk
-        ( LOWER, NORMAL, orientation,
-          F(-1), front.LDense, ABLCopy, F(0), front.workDense );
     }
     else
     {
-        auto& FL = front.LDense;
-        DEBUG_ONLY(
-          if( FL.Height() != info.size+updateSize || FL.Width() != info.size )
-              LogicError("Front was not the proper size");
-        )
-
-        // Process children and add in their updates
-        const int numChildren = info.children.size();
-        for( Int c=0; c<numChildren; ++c )
+        // Process the children in the order chosen by the analysis. The
+        // updates of the first info.numStackedChildren of them are held until
+        // our update matrix is formed, and each of the remaining updates is
+        // added in as soon as it is formed.
+        const Int numStacked = info.numStackedChildren;
+        if( numStacked == 0 )
+            Zeros( FBR, updateSize, updateSize );
+        for( Int t=0; t<numChildren; ++t )
         {
-            Process( *info.children[c], *front.children[c], factorType );
-
-            auto& childU = front.children[c]->workDense;
-            const int childUSize = childU.Height();
-            for( int jChild=0; jChild<childUSize; ++jChild )
+            const Int c = info.childOrder[t];
+            Process( *info.children[c], *front.children[c], factorType, ctrl );
+            if( t+1 == numStacked )
             {
-                const int j = info.childRelInds[c][jChild];
-                for( int iChild=jChild; iChild<childUSize; ++iChild )
-                {
-                    const int i = info.childRelInds[c][iChild];
-                    const F value = childU(iChild,jChild);
-                    if( j < info.size )
-                        FL(i,j) += value;
-                    else
-                        FBR(i-info.size,j-info.size) += value;
-                }
+                Zeros( FBR, updateSize, updateSize );
+                for( Int s=0; s<=t; ++s )
+                    ExtendAdd( info, front, info.childOrder[s], false );
             }
-            childU.Empty();
+            else if( t >= numStacked )
+                ExtendAdd( info, front, c, false );
         }
-        ProcessFront( front, factorType );
     }
+    ProcessFront( front, factorType, ctrl.blr );
 }
 
 template<typename F>
 inline void
 Process
-( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType )
+( const DistNodeInfo& info, DistFront<F>& front, LDLFrontType factorType,
+  const MultifrontalCtrl& ctrl=MultifrontalCtrl() )
 {
     DEBUG_CSE
 
@@ -156,7 +245,7 @@ Process
         const Grid& grid = *info.grid;
         auto& frontDup = *front.duplicate;
 
-        Process( *info.duplicate, frontDup, factorType );
+        Process( *info.duplicate, frontDup, factorType, ctrl );
 
         // Pull the relevant information up from the duplicate
         front.type = frontDup.type;
@@ -177,7 +266,7 @@ Process
 
     const auto& childInfo = *info.child;
     auto& childFront = *front.child;
-    Process( childInfo, childFront, factorType );
+    Process( childInfo, childFront, factorType, ctrl );
 
     const Int updateSize = info.lowerStruct.size();
     front.work.Empty();
@@ -150,8 +150,14 @@ void ProcessFrontBlock
     }
 }
 
+// Fronts of a BLR factorization which are too small to be compressed, or
+// which are duplicated by a distributed front (which views LDense), are
+// factored densely
 template<typename F>
-void ProcessFront( Front<F>& front, LDLFrontType factorType )
+void ProcessFront
+( Front<F>& front,
+  LDLFrontType factorType,
+  const BLRCtrl& blrCtrl=BLRCtrl() )
 {
     DEBUG_CSE
     front.type = factorType;
@@ -160,7 +166,18 @@ void ProcessFront( Front<F>& front, LDLFrontType factorType )
           LogicError("This should not be possible");
     )
     const bool pivoted = PivotedFactorization( factorType );
-    if( BlockFactorization(factorType) )
+    if( BLRFactorization(factorType) && front.duplicate == nullptr &&
+        front.LDense.Height() >= blrCtrl.minFrontSize )
+    {
+        BLRFactor
+        ( front.LDense,
+          front.workDense,
+          front.diag,
+          front.LBLR,
+          front.isHermitian,
+          blrCtrl );
+    }
+    else if( BlockFactorization(factorType) )
     {
         ProcessFrontBlock
         ( front.LDense,
@@ -354,6 +371,7 @@ void ProcessFrontBlock
     MakeSymmetric( LOWER, ATL, conjugate );
 }
 
+// Distributed fronts of a BLR factorization are factored densely
 template<typename F>
 void ProcessFront( DistFront<F>& front, LDLFrontType factorType )
 {
@@ -20,12 +20,13 @@ void SolveAfter
 ( const vector<Int>& invMap,
   const NodeInfo& info, 
   const Front<F>& front,
-        Matrix<F>& X )
+        Matrix<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
     MatrixNode<F> XNodal( invMap, info, X );
-    SolveAfter( info, front, XNodal );
+    SolveAfter( info, front, XNodal, ctrl );
     XNodal.Push( invMap, info, X );
 }
 
@@ -33,7 +34,8 @@ template<typename F>
 void SolveAfter
 ( const NodeInfo& info,
   const Front<F>& front,
-        MatrixNode<F>& X )
+        MatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
@@ -41,18 +43,18 @@ void SolveAfter
     if( BlockFactorization(front.type) )
     {
         // Solve against block diagonal factor, L D
-        LowerSolve( NORMAL, info, front, X );
+        LowerSolve( NORMAL, info, front, X, ctrl );
         // Solve against the (conjugate-)transpose of the block unit diagonal L
-        LowerSolve( orientation, info, front, X );
+        LowerSolve( orientation, info, front, X, ctrl );
     }
     else
     {
         // Solve against unit diagonal L
-        LowerSolve( NORMAL, info, front, X );
+        LowerSolve( NORMAL, info, front, X, ctrl );
         // Solve against diagonal
-        DiagonalSolve( info, front, X );
+        DiagonalSolve( info, front, X, ctrl );
         // Solve against the (conjugate-)transpose of the unit diagonal L
-        LowerSolve( orientation, info, front, X );
+        LowerSolve( orientation, info, front, X, ctrl );
     }
 }
 
@@ -61,20 +63,21 @@ void SolveAfter
 ( const DistMap& invMap,
   const DistNodeInfo& info, 
   const DistFront<F>& front,
-        DistMultiVec<F>& X )
+        DistMultiVec<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
     if( FrontIs1D(front.type) )
     {
         DistMultiVecNode<F> XNodal( invMap, info, X );
-        SolveAfter( info, front, XNodal );
+        SolveAfter( info, front, XNodal, ctrl );
         XNodal.Push( invMap, info, X );
     }
     else
     {
         DistMatrixNode<F> XNodal( invMap, info, X );
-        SolveAfter( info, front, XNodal );
+        SolveAfter( info, front, XNodal, ctrl );
         XNodal.Push( invMap, info, X );
     }
 }
@@ -83,7 +86,8 @@ template<typename F>
 void SolveAfter
 ( const DistNodeInfo& info, 
   const DistFront<F>& front,
-        DistMultiVecNode<F>& X )
+        DistMultiVecNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
@@ -104,18 +108,18 @@ void SolveAfter
     if( BlockFactorization(front.type) )
     {
         // Solve against block diagonal factor, L D
-        LowerSolve( NORMAL, info, front, X );
+        LowerSolve( NORMAL, info, front, X, ctrl );
         // Solve against the (conjugate-)transpose of the block unit diagonal L
-        LowerSolve( orientation, info, front, X );
+        LowerSolve( orientation, info, front, X, ctrl );
     }
     else
     {
         // Solve against unit diagonal L
-        LowerSolve( NORMAL, info, front, X );
+        LowerSolve( NORMAL, info, front, X, ctrl );
         // Solve against diagonal
-        DiagonalSolve( info, front, X );
+        DiagonalSolve( info, front, X, ctrl );
         // Solve against the (conjugate-)transpose of the unit diagonal L
-        LowerSolve( orientation, info, front, X );
+        LowerSolve( orientation, info, front, X, ctrl );
     }
 }
 
@@ -123,7 +127,8 @@ template<typename F>
 void SolveAfter
 ( const DistNodeInfo& info, 
   const DistFront<F>& front,
-        DistMatrixNode<F>& X )
+        DistMatrixNode<F>& X,
+  const MultifrontalCtrl& ctrl )
 {
     DEBUG_CSE
 
@@ -131,7 +136,7 @@ void SolveAfter
     {
         // TODO: Add warning?
         DistMultiVecNode<F> XMV( X );
-        SolveAfter( info, front, XMV );
+        SolveAfter( info, front, XMV, ctrl );
         X = XMV;
         return;
     }
@@ -140,18 +145,18 @@ void SolveAfter
     if( BlockFactorization(front.type) )
     {
         // Solve against block diagonal factor, L D
-        LowerSolve( NORMAL, info, front, X );
+        LowerSolve( NORMAL, info, front, X, ctrl );
         // Solve against the (conjugate-)transpose of the block unit diagonal L
-        LowerSolve( orientation, info, front, X );
+        LowerSolve( orientation, info, front, X, ctrl );
     }
     else
     {
         // Solve against unit diagonal L
-        LowerSolve( NORMAL, info, front, X );
+        LowerSolve( NORMAL, info, front, X, ctrl );
         // Solve against diagonal
-        DiagonalSolve( info, front, X );
+        DiagonalSolve( info, front, X, ctrl );
         // Solve against the (conjugate-)transpose of the unit diagonal L
-        LowerSolve( orientation, info, front, X );
+        LowerSolve( orientation, info, front, X, ctrl );
     }
 } 
 
@@ -290,24 +295,29 @@ Int SolveWithIterativeRefinement
   ( const vector<Int>& invMap, \
     const NodeInfo& info, \
     const Front<F>& front, \
-          Matrix<F>& X ); \
+          Matrix<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template void SolveAfter \
   ( const DistMap& invMap, \
     const DistNodeInfo& info, \
     const DistFront<F>& front, \
-          DistMultiVec<F>& X ); \
+          DistMultiVec<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template void SolveAfter \
   ( const NodeInfo& info, \
     const Front<F>& front, \
-          MatrixNode<F>& X ); \
+          MatrixNode<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template void SolveAfter \
   ( const DistNodeInfo& info, \
     const DistFront<F>& front, \
-          DistMultiVecNode<F>& X ); \
+          DistMultiVecNode<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template void SolveAfter \
   ( const DistNodeInfo& info, \
     const DistFront<F>& front, \
-          DistMatrixNode<F>& X ); \
+          DistMatrixNode<F>& X, \
+    const MultifrontalCtrl& ctrl ); \
   template Int SolveWithIterativeRefinement \
   ( const SparseMatrix<F>& A, \
     const vector<Int>& invMap, \
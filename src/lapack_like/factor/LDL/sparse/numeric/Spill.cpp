@@ -0,0 +1,194 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace El {
+namespace ldl {
+
+SpillFile::SpillFile( const string& filename )
+: filename_(filename), size_(0)
+{
+    DEBUG_CSE
+    fd_ = open( filename.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0600 );
+    if( fd_ < 0 )
+        RuntimeError("Could not open ",filename," for spilling fronts");
+}
+
+SpillFile::~SpillFile()
+{
+    close( fd_ );
+    unlink( filename_.c_str() );
+}
+
+size_t SpillFile::Write( const void* buffer, size_t numBytes )
+{
+    DEBUG_CSE
+    const size_t offset = size_;
+    const char* bytes = static_cast<const char*>(buffer);
+    size_t numWritten = 0;
+    while( numWritten < numBytes )
+    {
+        const ssize_t numNew =
+          pwrite
+          ( fd_, bytes+numWritten, numBytes-numWritten, offset+numWritten );
+        if( numNew < 0 )
+            RuntimeError("Could not write to ",filename_);
+        numWritten += numNew;
+    }
+    size_ += numBytes;
+    return offset;
+}
+
+void SpillFile::Read( size_t offset, void* buffer, size_t numBytes ) const
+{
+    DEBUG_CSE
+    char* bytes = static_cast<char*>(buffer);
+    size_t numRead = 0;
+    while( numRead < numBytes )
+    {
+        const ssize_t numNew =
+          pread( fd_, bytes+numRead, numBytes-numRead, offset+numRead );
+        if( numNew <= 0 )
+            RuntimeError("Could not read from ",filename_);
+        numRead += numNew;
+    }
+}
+
+void SpillFile::Prefetch( size_t offset, size_t numBytes ) const
+{
+    DEBUG_CSE
+#ifdef POSIX_FADV_WILLNEED
+    posix_fadvise( fd_, offset, numBytes, POSIX_FADV_WILLNEED );
+#endif
+}
+
+namespace {
+
+template<typename F>
+ElementalMatrix<F>& SpilledMatrix( DistFront<F>& front )
+{
+    if( FrontIs1D(front.type) )
+        return front.L1D;
+    else
+        return front.L2D;
+}
+
+// Write the fronts in the order in which the forward solve visits them
+// (block low-rank fronts are already compressed and stay in memory)
+template<typename F>
+void Spill( Front<F>& front, const shared_ptr<SpillFile>& file )
+{
+    for( auto* child : front.children )
+        Spill( *child, file );
+    if( front.LBLR.Compressed() )
+        return;
+    front.spillHeight = front.LDense.Height();
+    front.spillWidth = front.LDense.Width();
+    front.spillOffset = file->Write( front.LDense );
+    front.spillFile = file;
+    front.LDense.Empty();
+}
+
+} // anonymous namespace
+
+template<typename F>
+void SpillFronts( Front<F>& front, const string& filename )
+{
+    DEBUG_CSE
+    if( !IsPacked<F>::value )
+        LogicError("Only fronts of packed datatypes can be spilled");
+    RestoreFronts( front );
+    Spill( front, make_shared<SpillFile>(filename) );
+}
+
+template<typename F>
+void SpillFronts( DistFront<F>& rootFront, const string& filename )
+{
+    DEBUG_CSE
+    if( !IsPacked<F>::value )
+        LogicError("Only fronts of packed datatypes can be spilled");
+    RestoreFronts( rootFront );
+    auto file =
+      make_shared<SpillFile>
+      ( BuildString(filename,".",mpi::Rank(mpi::COMM_WORLD)) );
+
+    // The local subtree is visited first by the forward solve, and then the
+    // distributed fronts from the bottom up. The distributed front which
+    // duplicates the local root is a view of the local factor.
+    vector<DistFront<F>*> distFronts;
+    DistFront<F>* front = &rootFront;
+    while( front->duplicate == nullptr )
+    {
+        distFronts.push_back( front );
+        front = front->child;
+    }
+    Spill( *front->duplicate, file );
+    for( Int k=distFronts.size()-1; k>=0; --k )
+    {
+        auto& distFront = *distFronts[k];
+        auto& L = SpilledMatrix( distFront );
+        distFront.spillHeight = L.Height();
+        distFront.spillWidth = L.Width();
+        distFront.spillOffset = file->Write( L.LockedMatrix() );
+        distFront.spillFile = file;
+        // Keep the alignments so that the front can be reformed
+        L.EmptyData();
+    }
+}
+
+template<typename F>
+void RestoreFronts( Front<F>& front )
+{
+    DEBUG_CSE
+    for( auto* child : front.children )
+        RestoreFronts( *child );
+    front.Load();
+    front.spillFile.reset();
+}
+
+template<typename F>
+void RestoreFronts( DistFront<F>& front )
+{
+    DEBUG_CSE
+    if( front.duplicate != nullptr )
+    {
+        if( !front.duplicate->spillFile )
+            return;
+        RestoreFronts( *front.duplicate );
+
+        // Reattach the view of the local factor
+        if( FrontIs1D(front.type) )
+            front.L1D.Attach( front.L1D.Grid(), front.duplicate->LDense );
+        else
+            front.L2D.Attach( front.L2D.Grid(), front.duplicate->LDense );
+        return;
+    }
+    RestoreFronts( *front.child );
+    front.Load();
+    front.spillFile.reset();
+}
+
+#define PROTO(F) \
+  template void SpillFronts( Front<F>& front, const string& filename ); \
+  template void SpillFronts( DistFront<F>& front, const string& filename ); \
+  template void RestoreFronts( Front<F>& front ); \
+  template void RestoreFronts( DistFront<F>& front );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace ldl
+} // namespace El
@@ -0,0 +1,260 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+#include <map>
+
+namespace El {
+namespace ldl {
+
+// The number of entries in the lower-trapezoidal portion of a dense front
+inline double FrontEntries( Int size, Int lowerSize )
+{ return double(size)*(size+1)/2 + double(size)*lowerSize; }
+
+// Relaxed supernode amalgamation
+// ==============================
+// A (non-leaf) child C is merged into its parent P by ordering the variables
+// of C immediately before those of P. Since the structure of C lies within
+// the variables and the structure of P, the merged front has the lower
+// structure of P, and the columns of C gain
+//
+//     C.size*(P.size + |P.lowerStruct| - |C.lowerStruct|)
+//
+// explicit zeros. The children of C become children of the merged node, and,
+// since merging can move the variables of a child past those of its
+// siblings, the subtree is renumbered in postorder at the end.
+//
+// The leaves are never merged, as they are factored with a sparse LDL whose
+// symbolic factorization is only available when the leaf is formed.
+
+void Amalgamate( Separator& rootSep, NodeInfo& rootInfo, double relaxedFill )
+{
+    DEBUG_CSE
+    if( relaxedFill <= 0 )
+        return;
+
+    // Compute the lower structures of the original tree. Merging does not
+    // change the lower structure of a parent, so these remain valid.
+    Analysis( rootInfo );
+
+    // The original indices of the variables of each node, in their new order
+    const Int numSources = SubtreeSize( rootInfo );
+    const Int firstInd = rootInfo.off + rootInfo.size - numSources;
+    std::map<const NodeInfo*,vector<Int>> oldInds;
+
+    function<void(Separator&,NodeInfo&)> amalgamate =
+      [&]( Separator& sep, NodeInfo& node )
+      {
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            amalgamate( *sep.children[c], *node.children[c] );
+
+        auto& inds = oldInds[&node];
+        inds.resize( node.size );
+        for( Int t=0; t<node.size; ++t )
+            inds[t] = node.off + t;
+
+        // Consider the children (and the children of merged children) in
+        // turn, keeping those which would introduce too many zeros
+        vector<Separator*> sepCands( sep.children.rbegin(),
+                                     sep.children.rend() );
+        vector<NodeInfo*> nodeCands( node.children.rbegin(),
+                                     node.children.rend() );
+        SwapClear( sep.children );
+        SwapClear( node.children );
+        const Int lowerSize = node.lowerStruct.size();
+        while( !nodeCands.empty() )
+        {
+            Separator* childSep = sepCands.back();
+            NodeInfo* child = nodeCands.back();
+            sepCands.pop_back();
+            nodeCands.pop_back();
+
+            const Int childLowerSize = child->lowerStruct.size();
+            const double addedZeros =
+              double(child->size)*(node.size+lowerSize-childLowerSize);
+            const double numZeros =
+              node.relaxedZeros + child->relaxedZeros + addedZeros;
+            const double numEntries =
+              FrontEntries( child->size+node.size, lowerSize );
+            if( child->children.empty() || numZeros > relaxedFill*numEntries )
+            {
+                sep.children.push_back( childSep );
+                node.children.push_back( child );
+                continue;
+            }
+
+            // Remove our variables from the original structure of the child
+            // before merging it into ours
+            auto& childInds = oldInds[child];
+            auto sortedInds = inds;
+            std::sort( sortedInds.begin(), sortedInds.end() );
+            vector<Int> childStruct;
+            for( const Int i : child->origLowerStruct )
+                if( !std::binary_search
+                    ( sortedInds.begin(), sortedInds.end(), i ) )
+                    childStruct.push_back( i );
+            node.origLowerStruct = Union( node.origLowerStruct, childStruct );
+
+            childInds.insert( childInds.end(), inds.begin(), inds.end() );
+            SwapClear( inds );
+            inds.swap( childInds );
+            oldInds.erase( child );
+            childSep->inds.insert
+            ( childSep->inds.end(), sep.inds.begin(), sep.inds.end() );
+            sep.inds.swap( childSep->inds );
+            node.size += child->size;
+            node.relaxedZeros = numZeros;
+
+            // Adopt the grandchildren as candidates
+            for( Int g=child->children.size()-1; g>=0; --g )
+            {
+                childSep->children[g]->parent = &sep;
+                child->children[g]->parent = &node;
+                sepCands.push_back( childSep->children[g] );
+                nodeCands.push_back( child->children[g] );
+            }
+            SwapClear( childSep->children );
+            SwapClear( child->children );
+            delete childSep;
+            delete child;
+        }
+      };
+    amalgamate( rootSep, rootInfo );
+
+    // Renumber the subtree in postorder
+    vector<Int> newInds( numSources );
+    Int off = firstInd;
+    function<void(Separator&,NodeInfo&)> renumber =
+      [&]( Separator& sep, NodeInfo& node )
+      {
+        const Int numChildren = node.children.size();
+        for( Int c=0; c<numChildren; ++c )
+            renumber( *sep.children[c], *node.children[c] );
+        const auto& inds = oldInds[&node];
+        for( Int t=0; t<node.size; ++t )
+            newInds[inds[t]-firstInd] = off + t;
+        sep.off = off;
+        node.off = off;
+        off += node.size;
+      };
+    renumber( rootSep, rootInfo );
+
+    // The original structures refer to ancestors within the subtree (which
+    // were renumbered) and to nodes above the subtree (which were not)
+    function<void(NodeInfo&)> translate =
+      [&]( NodeInfo& node )
+      {
+        for( NodeInfo* child : node.children )
+            translate( *child );
+        for( Int& i : node.origLowerStruct )
+            if( i >= firstInd && i < firstInd+numSources )
+                i = newInds[i-firstInd];
+        std::sort( node.origLowerStruct.begin(), node.origLowerStruct.end() );
+      };
+    translate( rootInfo );
+}
+
+FrontStatistics GetFrontStatistics( const NodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    FrontStatistics stats;
+    function<void(const NodeInfo&)> accumulate =
+      [&]( const NodeInfo& node )
+      {
+        for( const NodeInfo* child : node.children )
+            accumulate( *child );
+
+        ++stats.numFronts;
+        const Int lowerSize = node.lowerStruct.size();
+        if( node.children.empty() && !node.LOffsets.empty() )
+            stats.numEntries += double(node.LOffsets.back()) + node.size +
+              double(node.size)*lowerSize;
+        else
+            stats.numEntries += FrontEntries(node.size,lowerSize);
+        stats.numRelaxedZeros += node.relaxedZeros;
+
+        Int bin = 0;
+        while( (Int(2)<<bin) <= node.size )
+            ++bin;
+        if( Int(stats.sizeHistogram.size()) <= bin )
+            stats.sizeHistogram.resize( bin+1, 0 );
+        ++stats.sizeHistogram[bin];
+      };
+    accumulate( rootInfo );
+    return stats;
+}
+
+FrontStatistics GetFrontStatistics( const DistNodeInfo& rootInfo )
+{
+    DEBUG_CSE
+    // Each distributed front is counted by the root of its team
+    FrontStatistics stats;
+    const DistNodeInfo* node = &rootInfo;
+    while( node->duplicate == nullptr )
+    {
+        if( mpi::Rank(node->comm) == 0 )
+        {
+            ++stats.numFronts;
+            stats.numEntries +=
+              FrontEntries(node->size,node->lowerStruct.size());
+            Int bin = 0;
+            while( (Int(2)<<bin) <= node->size )
+                ++bin;
+            if( Int(stats.sizeHistogram.size()) <= bin )
+                stats.sizeHistogram.resize( bin+1, 0 );
+            ++stats.sizeHistogram[bin];
+        }
+        node = node->child;
+    }
+    auto localStats = GetFrontStatistics( *node->duplicate );
+    stats.numFronts += localStats.numFronts;
+    stats.numEntries += localStats.numEntries;
+    stats.numRelaxedZeros += localStats.numRelaxedZeros;
+    const Int numLocalBins = localStats.sizeHistogram.size();
+    if( Int(stats.sizeHistogram.size()) < numLocalBins )
+        stats.sizeHistogram.resize( numLocalBins, 0 );
+    for( Int bin=0; bin<numLocalBins; ++bin )
+        stats.sizeHistogram[bin] += localStats.sizeHistogram[bin];
+
+    // Sum the contributions over the processes
+    mpi::Comm comm = rootInfo.comm;
+    const Int numBins =
+      mpi::AllReduce( Int(stats.sizeHistogram.size()), mpi::MAX, comm );
+    stats.sizeHistogram.resize( numBins, 0 );
+    stats.sizeHistogram.push_back( stats.numFronts );
+    mpi::AllReduce
+    ( stats.sizeHistogram.data(), numBins+1, mpi::SUM, comm );
+    stats.numFronts = stats.sizeHistogram.back();
+    stats.sizeHistogram.pop_back();
+    double counts[2] = { stats.numEntries, stats.numRelaxedZeros };
+    mpi::AllReduce( counts, 2, mpi::SUM, comm );
+    stats.numEntries = counts[0];
+    stats.numRelaxedZeros = counts[1];
+    return stats;
+}
+
+void PrintFrontStatistics( const FrontStatistics& stats, ostream& os )
+{
+    DEBUG_CSE
+    os << stats.numFronts << " fronts with "
+       << static_cast<long long>(stats.numEntries) << " entries ("
+       << static_cast<long long>(stats.numRelaxedZeros)
+       << " explicit zeros from amalgamation)\n";
+    const Int numBins = stats.sizeHistogram.size();
+    for( Int bin=0; bin<numBins; ++bin )
+    {
+        if( stats.sizeHistogram[bin] == 0 )
+            continue;
+        os << "  sizes in [" << (Int(1)<<bin) << "," << (Int(2)<<bin)
+           << "): " << stats.sizeHistogram[bin] << "\n";
+    }
+}
+
+} // namespace ldl
+} // namespace El
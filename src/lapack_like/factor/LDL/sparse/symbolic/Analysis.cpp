@@ -201,6 +201,94 @@ inline void ComputeStructAndRelInds
     )
 }
 
+// The peak number of work entries of a node whose children are processed in
+// the given order, where the updates of the first numStacked children are
+// held until our update matrix is formed (and numStacked is chosen to
+// minimize the peak)
+inline double StackedPeak
+( const NodeInfo& node, const vector<Int>& order, Int& numStacked )
+{
+    const Int numChildren = node.children.size();
+    const double lowerSize = node.lowerStruct.size();
+    const double updateEntries = lowerSize*lowerSize;
+    auto childUpdate =
+      [&]( Int c )
+      {
+          const double childLowerSize = node.children[c]->lowerStruct.size();
+          return childLowerSize*childLowerSize;
+      };
+    auto childPeak =
+      [&]( Int c ) { return node.children[c]->peakWorkEntries; };
+
+    vector<double> suffixPeak( numChildren+1, 0 );
+    for( Int t=numChildren-1; t>=0; --t )
+        suffixPeak[t] = Max( suffixPeak[t+1], childPeak(order[t]) );
+    numStacked = 0;
+    double bestPeak = updateEntries + suffixPeak[0];
+    double stackedPeak=0, stackedEntries=0;
+    for( Int k=1; k<=numChildren; ++k )
+    {
+        const Int c = order[k-1];
+        stackedPeak = Max( stackedPeak, stackedEntries+childPeak(c) );
+        stackedEntries += childUpdate(c);
+        const double peak =
+          Max( Max( stackedPeak, stackedEntries+updateEntries ),
+               updateEntries+suffixPeak[k] );
+        if( peak < bestPeak )
+        {
+            numStacked = k;
+            bestPeak = peak;
+        }
+    }
+    return bestPeak;
+}
+
+// Order the children of a (sequential) node so as to reduce the peak memory
+// of the factorization of its subtree, in the manner of Liu's ordering for
+// multifrontal stacks. The updates of the first k children are held until our
+// update matrix is formed, so that the peak over the first k is minimized by
+// processing the children in order of decreasing (peak - update size); each
+// of the remaining children is added in as soon as it has been processed.
+// The number k is chosen to minimize the peak over the whole node, and k=0
+// corresponds to forming our update matrix before processing any children.
+// Since Liu's ordering is only optimal when every child is held, the natural
+// order is kept whenever it leads to a smaller peak.
+inline void OrderChildren( NodeInfo& node )
+{
+    const Int numChildren = node.children.size();
+    const double lowerSize = node.lowerStruct.size();
+    // Factoring the front makes a copy of its bottom-left block
+    const double frontPeak = lowerSize*lowerSize + lowerSize*node.size;
+
+    vector<Int> naturalOrder( numChildren );
+    for( Int c=0; c<numChildren; ++c )
+        naturalOrder[c] = c;
+    auto childExcess =
+      [&]( Int c )
+      {
+          const NodeInfo& child = *node.children[c];
+          const double childLowerSize = child.lowerStruct.size();
+          return child.peakWorkEntries - childLowerSize*childLowerSize;
+      };
+    node.childOrder = naturalOrder;
+    std::stable_sort
+    ( node.childOrder.begin(), node.childOrder.end(),
+      [&]( Int c0, Int c1 ) { return childExcess(c0) > childExcess(c1); } );
+
+    Int numStacked, naturalNumStacked;
+    node.peakWorkEntries = StackedPeak( node, node.childOrder, numStacked );
+    const double naturalPeak =
+      StackedPeak( node, naturalOrder, naturalNumStacked );
+    if( naturalPeak < node.peakWorkEntries )
+    {
+        node.childOrder = naturalOrder;
+        numStacked = naturalNumStacked;
+        node.peakWorkEntries = naturalPeak;
+    }
+    node.numStackedChildren = numStacked;
+    node.peakWorkEntries = Max( node.peakWorkEntries, frontPeak );
+}
+
 Int Analysis( NodeInfo& node, Int myOff )
 {
     DEBUG_CSE
@@ -278,6 +366,7 @@ Int Analysis( NodeInfo& node, Int myOff )
         for( Int i=0; i<numOrigLowerInds; ++i )
             node.origLowerRelInds[i] = i + node.size;
     }
+    OrderChildren( node );
 
     return myOff + node.size;
 }
@@ -331,5 +420,13 @@ void Analysis( DistNodeInfo& node, bool computeFactRecvInds )
     ComputeStructAndRelInds( theirSize, theirLowerStruct, node );
 }
 
+Int SubtreeSize( const NodeInfo& node )
+{
+    Int size = node.size;
+    for( const NodeInfo* child : node.children )
+        size += SubtreeSize( *child );
+    return size;
+}
+
 } // namespace ldl
 } // namespace El
@@ -371,6 +371,7 @@ NestedDissectionRecursion
 
         NestedDissectionRecursion
         ( seqGraph, perm.Map(), *sep.duplicate, *node.duplicate, off, ctrl );
+        Amalgamate( *sep.duplicate, *node.duplicate, ctrl.relaxedFill );
 
         // Pull information up from the duplicates
         sep.off = sep.duplicate->off;
@@ -397,6 +398,7 @@ void NestedDissection
         perm[s] = s;
 
     NestedDissectionRecursion( graph, perm, sep, node, 0, ctrl );
+    Amalgamate( sep, node, ctrl.relaxedFill );
 
     // Construct the distributed reordering    
     BuildMap( sep, map );
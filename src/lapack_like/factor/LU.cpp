@@ -10,6 +10,7 @@
 
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -220,6 +221,40 @@ void LU( ElementalMatrix<F>& APre, DistPermutation& P )
     }
 }
 
+template<typename F> 
+void LU( Matrix<F>& A, Permutation& P, LUPivotType pivotType )
+{
+    DEBUG_CSE
+    if( pivotType == LU_PARTIAL || pivotType == LU_TOURNAMENT )
+        LU( A, P );
+    else
+        LogicError("Unsupported LU pivot type");
+}
+
+template<typename F> 
+void LU( ElementalMatrix<F>& A, DistPermutation& P, LUPivotType pivotType )
+{
+    DEBUG_CSE
+    if( pivotType == LU_PARTIAL )
+        LU( A, P );
+    else if( pivotType == LU_TOURNAMENT )
+        lu::Tournament( A, P );
+    else
+        LogicError("Unsupported LU pivot type");
+}
+
+template<typename F> 
+void LU( DistMatrix<F,VC,STAR>& A, DistPermutation& P, LUPivotType pivotType )
+{
+    DEBUG_CSE
+    if( pivotType == LU_PARTIAL )
+        LU( static_cast<ElementalMatrix<F>&>(A), P );
+    else if( pivotType == LU_TOURNAMENT )
+        lu::Tournament( A, P );
+    else
+        LogicError("Unsupported LU pivot type");
+}
+
 template<typename F> 
 void LU
 ( ElementalMatrix<F>& A, 
@@ -241,6 +276,18 @@ void LU
   ( ElementalMatrix<F>& A, \
     DistPermutation& P ); \
   template void LU \
+  ( Matrix<F>& A, \
+    Permutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
+  ( ElementalMatrix<F>& A, \
+    DistPermutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
+  ( DistMatrix<F,VC,STAR>& A, \
+    DistPermutation& P, \
+    LUPivotType pivotType ); \
+  template void LU \
   ( Matrix<F>& A, \
     Permutation& P, \
     Permutation& Q ); \
@@ -0,0 +1,313 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+// Communication-avoiding LU factorization (CALU) with tournament pivoting.
+// Rather than performing a reduction over the process column for each column
+// of a panel, the pivot rows of an entire panel are chosen by a binary tree
+// of local partially-pivoted LU factorizations of candidate rows. The chosen
+// rows are then moved to the top of the panel, which is factored without
+// further pivoting.
+//
+// See Grigori, Demmel, and Xiang, "CALU: A communication optimal LU
+// factorization algorithm", SIAM J. Matrix Anal. Appl., 32(4), 2011.
+
+namespace El {
+namespace lu {
+namespace tournament {
+
+// Keep the (at most n) rows of the m x n matrix C which partial pivoting
+// selects, in the order in which they were selected, along with their indices
+template<typename F>
+void Play( Matrix<F>& C, vector<Int>& inds )
+{
+    DEBUG_CSE
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numWinners = Min(m,n);
+
+    Matrix<F> W( C );
+    F* WBuf = W.Buffer();
+    const Int WLDim = W.LDim();
+    vector<Int> perm(m);
+    for( Int i=0; i<m; ++i )
+        perm[i] = i;
+    for( Int k=0; k<numWinners; ++k )
+    {
+        const Int iPiv = k + blas::MaxInd( m-k, &WBuf[k+k*WLDim], 1 );
+        if( iPiv != k )
+        {
+            blas::Swap( n, &WBuf[k], WLDim, &WBuf[iPiv], WLDim );
+            std::swap( perm[k], perm[iPiv] );
+        }
+
+        // A zero pivot means that the candidates are rank-deficient; any of
+        // the remaining rows is as good a choice as another
+        const F alpha = WBuf[k+k*WLDim];
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( m-(k+1), F(1)/alpha, &WBuf[(k+1)+k*WLDim], 1 );
+        blas::Geru
+        ( m-(k+1), n-(k+1),
+          F(-1), &WBuf[(k+1)+k*WLDim], 1, &WBuf[k+(k+1)*WLDim], WLDim,
+                 &WBuf[(k+1)+(k+1)*WLDim], WLDim );
+    }
+
+    Matrix<F> winners( numWinners, n );
+    vector<Int> winnerInds( numWinners );
+    for( Int k=0; k<numWinners; ++k )
+    {
+        auto winnerRow = winners( IR(k), ALL );
+        winnerRow = C( IR(perm[k]), ALL );
+        winnerInds[k] = inds[perm[k]];
+    }
+    C = winners;
+    inds = winnerInds;
+}
+
+// Choose the pivot rows of the panel A, whose rows are distributed over its
+// column communicator (and which is replicated over its row communicator),
+// using a binary reduction tree rooted at process zero. Every process receives
+// the (panel-relative) indices of the pivot rows, in pivot order.
+template<typename F>
+void Pivots( const ElementalMatrix<F>& A, vector<Int>& pivots )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(
+      if( A.RowDist() != STAR )
+          LogicError("Tournament pivoting requires a row distribution of STAR");
+    )
+    const Int n = A.Width();
+    const Int localHeight = A.LocalHeight();
+    mpi::Comm colComm = A.ColComm();
+    const int commSize = mpi::Size( colComm );
+    const int commRank = mpi::Rank( colComm );
+
+    // Play the first round among the local rows
+    Matrix<F> C( A.LockedMatrix() );
+    vector<Int> inds( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        inds[iLoc] = A.GlobalRow(iLoc);
+    Play( C, inds );
+
+    // Play the remaining rounds between the winners of pairs of processes
+    Matrix<F> CRecv, CPair;
+    for( int step=1; step<commSize; step*=2 )
+    {
+        if( commRank % (2*step) == 0 )
+        {
+            const int partner = commRank + step;
+            if( partner >= commSize )
+                continue;
+            const Int numRecv = mpi::Recv<Int>( partner, colComm );
+            if( numRecv == 0 )
+                continue;
+            CRecv.Resize( numRecv, n, numRecv );
+            const Int numOld = C.Height();
+            inds.resize( numOld+numRecv );
+            mpi::Recv( &inds[numOld], numRecv, partner, colComm );
+            mpi::Recv( CRecv.Buffer(), numRecv*n, partner, colComm );
+
+            CPair.Resize( numOld+numRecv, n );
+            auto CPairT = CPair( IR(0,numOld), ALL );
+            auto CPairB = CPair( IR(numOld,END), ALL );
+            CPairT = C;
+            CPairB = CRecv;
+            Play( CPair, inds );
+            C = CPair;
+        }
+        else
+        {
+            // The winners are freshly formed, so their buffer is contiguous
+            const int partner = commRank - step;
+            const Int numSend = C.Height();
+            mpi::Send( numSend, partner, colComm );
+            if( numSend > 0 )
+            {
+                mpi::Send( inds.data(), numSend, partner, colComm );
+                mpi::Send( C.LockedBuffer(), numSend*n, partner, colComm );
+            }
+            break;
+        }
+    }
+
+    Int numPivots = ( commRank == 0 ? C.Height() : 0 );
+    mpi::Broadcast( numPivots, 0, colComm );
+    if( commRank == 0 )
+        pivots = inds;
+    else
+        pivots.resize( numPivots );
+    mpi::Broadcast( pivots.data(), numPivots, 0, colComm );
+}
+
+// Express the movement of the pivot rows to the top of a panel of the given
+// height as a sequence of swaps
+template<typename PermType>
+void ApplyPivots
+( const vector<Int>& pivots,
+  Int panelHeight,
+  PermType& P,
+  PermType& PB,
+  Int offset )
+{
+    DEBUG_CSE
+    const Int numPivots = pivots.size();
+    PB.MakeIdentity( panelHeight );
+    PB.ReserveSwaps( numPivots );
+
+    // Track the original row stored in each position (and its inverse)
+    vector<Int> origRow(panelHeight), position(panelHeight);
+    for( Int i=0; i<panelHeight; ++i )
+    {
+        origRow[i] = i;
+        position[i] = i;
+    }
+    for( Int k=0; k<numPivots; ++k )
+    {
+        const Int iPiv = position[pivots[k]];
+        P.Swap( k+offset, iPiv+offset );
+        PB.Swap( k, iPiv );
+
+        const Int origK = origRow[k];
+        origRow[k] = pivots[k];
+        origRow[iPiv] = origK;
+        position[pivots[k]] = k;
+        position[origK] = iPiv;
+    }
+}
+
+} // namespace tournament
+
+template<typename F>
+void Tournament( ElementalMatrix<F>& APre, DistPermutation& P )
+{
+    DEBUG_CSE
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.Get();
+
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,MC,  STAR> AB1_MC_STAR(g), A21_MC_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    DistMatrix<F,STAR,MR  > A12_STAR_MR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    DistPermutation PB(g);
+
+    vector<Int> pivots;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind1( k, k+nb ), ind2( k+nb, END ), indB( k, END );
+
+        auto A11 = A( ind1, ind1 );
+        auto A12 = A( ind1, ind2 );
+        auto A21 = A( ind2, ind1 );
+        auto A22 = A( ind2, ind2 );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB  = A( indB, ALL  );
+
+        // Each process column redundantly plays the tournament for the panel
+        AB1_MC_STAR.AlignWith( AB1 );
+        AB1_MC_STAR = AB1;
+        tournament::Pivots( AB1_MC_STAR, pivots );
+        tournament::ApplyPivots( pivots, AB1.Height(), P, PB, k );
+        PB.PermuteRows( AB );
+
+        // The remainder of the step is that of LU without pivoting
+        A11_STAR_STAR = A11;
+        LU( A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        A21_MC_STAR.AlignWith( A22 );
+        A21_MC_STAR = A21;
+        LocalTrsm
+        ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21_MC_STAR );
+        A21 = A21_MC_STAR;
+
+        A12_STAR_VR.AlignWith( A22 );
+        A12_STAR_VR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+        A12_STAR_MR.AlignWith( A22 );
+        A12_STAR_MR = A12_STAR_VR;
+        LocalGemm( NORMAL, NORMAL, F(-1), A21_MC_STAR, A12_STAR_MR, F(1), A22 );
+        A12 = A12_STAR_MR;
+    }
+}
+
+// The tall-skinny variant keeps the rows distributed over all processes, so
+// that the only communication beyond the tournaments is the redundant
+// formation of each block row of U
+template<typename F>
+void Tournament( DistMatrix<F,VC,STAR>& A, DistPermutation& P )
+{
+    DEBUG_CSE
+    const Grid& g = A.Grid();
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g), A12_STAR_STAR(g);
+
+    const Int m = A.Height();
+    const Int n = A.Width();
+    const Int minDim = Min(m,n);
+    P.SetGrid( g );
+    P.MakeIdentity( m );
+    P.ReserveSwaps( minDim );
+
+    DistPermutation PB(g);
+
+    vector<Int> pivots;
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+        const IR ind1( k, k+nb ), ind2Vert( k+nb, END ), ind2Horz( k+nb, n ),
+                 indB( k, END );
+
+        auto A11 = A( ind1,     ind1     );
+        auto A12 = A( ind1,     ind2Horz );
+        auto A21 = A( ind2Vert, ind1     );
+        auto A22 = A( ind2Vert, ind2Horz );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB  = A( indB, ALL  );
+
+        tournament::Pivots( AB1, pivots );
+        tournament::ApplyPivots( pivots, AB1.Height(), P, PB, k );
+        PB.PermuteRows( AB );
+
+        A11_STAR_STAR = A11;
+        LU( A11_STAR_STAR );
+        A11 = A11_STAR_STAR;
+
+        LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A11_STAR_STAR, A21 );
+
+        A12_STAR_STAR = A12;
+        LocalTrsm
+        ( LEFT, LOWER, NORMAL, UNIT, F(1), A11_STAR_STAR, A12_STAR_STAR );
+        A12 = A12_STAR_STAR;
+
+        LocalGemm( NORMAL, NORMAL, F(-1), A21, A12_STAR_STAR, F(1), A22 );
+    }
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
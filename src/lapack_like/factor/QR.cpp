@@ -18,6 +18,7 @@
 #include "./QR/ColSwap.hpp"
 
 #include "./QR/TS.hpp"
+#include "./QR/CommunicationAvoiding.hpp"
 
 namespace El {
 
@@ -67,6 +68,32 @@ void QR
 #endif
 }
 
+template<typename F> 
+void QR
+( Matrix<F>& A,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    // There is no communication to avoid in the sequential case
+    qr::Householder( A, householderScalars, signature );
+}
+
+template<typename F> 
+void QR
+( ElementalMatrix<F>& A,
+  ElementalMatrix<F>& householderScalars, 
+  ElementalMatrix<Base<F>>& signature,
+  const QRCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    if( ctrl.communicationAvoiding )
+        qr::CommunicationAvoiding( A, householderScalars, signature );
+    else
+        qr::Householder( A, householderScalars, signature );
+}
+
 // Variants which perform (Businger-Golub) column-pivoting
 // =======================================================
 
@@ -104,6 +131,16 @@ void QR
     ElementalMatrix<F>& householderScalars, \
     ElementalMatrix<Base<F>>& signature ); \
   template void QR \
+  ( Matrix<F>& A, \
+    Matrix<F>& householderScalars, \
+    Matrix<Base<F>>& signature, \
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void QR \
+  ( ElementalMatrix<F>& A, \
+    ElementalMatrix<F>& householderScalars, \
+    ElementalMatrix<Base<F>>& signature, \
+    const QRCtrl<Base<F>>& ctrl ); \
+  template void QR \
   ( Matrix<F>& A, \
     Matrix<F>& householderScalars, \
     Matrix<Base<F>>& signature, \
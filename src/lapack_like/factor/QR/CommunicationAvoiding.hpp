@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_QR_COMMUNICATIONAVOIDING_HPP
+#define EL_QR_COMMUNICATIONAVOIDING_HPP
+
+// Communication-avoiding QR factorization (CAQR). Each panel is factored with
+// TSQR over the process column, which requires O(log p) rather than O(nb log p)
+// messages. The tree-structured Q of the panel is then converted back into
+// the standard representation of Q as a product of Householder reflectors
+// (followed by a diagonal signature matrix) via Householder reconstruction,
+// so that the result can be consumed by ApplyQ, SolveAfter, etc., and the
+// trailing matrix can be updated with the usual blocked ApplyQ.
+//
+// See Ballard, Demmel, Grigori, Jacquelin, Nguyen, and Solomonik,
+// "Reconstructing Householder vectors from Tall-Skinny QR", IPDPS, 2014.
+
+namespace El {
+namespace qr {
+namespace ca {
+
+// Overwrite the top square block, Q1, of a matrix with orthonormal columns,
+// with the unit-lower and upper triangular factors of Q1 - D, where the
+// diagonal signature matrix D is chosen on the fly to avoid cancellation.
+// The corresponding Householder scalars are also returned.
+template<typename F>
+void ReconstructionLU
+( Matrix<F>& Q1,
+  Matrix<F>& householderScalars,
+  Matrix<Base<F>>& signature )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = Q1.Height();
+    householderScalars.Resize( n, 1 );
+    signature.Resize( n, 1 );
+
+    F* QBuf = Q1.Buffer();
+    const Int QLDim = Q1.LDim();
+    for( Int k=0; k<n; ++k )
+    {
+        // Since |Q1(k,k)| <= 1, the pivot has magnitude of at least one
+        const F alpha = QBuf[k+k*QLDim];
+        const Real delta = ( RealPart(alpha) >= Real(0) ? Real(-1) : Real(1) );
+        const F pivot = alpha - delta;
+        QBuf[k+k*QLDim] = pivot;
+        signature(k) = delta;
+        householderScalars(k) = -delta*Conj(pivot);
+
+        blas::Scal( n-(k+1), F(1)/pivot, &QBuf[(k+1)+k*QLDim], 1 );
+        blas::Geru
+        ( n-(k+1), n-(k+1),
+          F(-1), &QBuf[(k+1)+k*QLDim], 1, &QBuf[k+(k+1)*QLDim], QLDim,
+                 &QBuf[(k+1)+(k+1)*QLDim], QLDim );
+    }
+}
+
+// Attempt to factor the panel AB1 using TSQR over the process column, and
+// then Householder reconstruction. False is returned (and the panel is left
+// untouched) if the panel does not meet TSQR's requirements.
+template<typename F>
+bool PanelTSQR
+( DistMatrix<F>& AB1,
+  ElementalMatrix<F>& householderScalars,
+  ElementalMatrix<Base<F>>& signature )
+{
+    DEBUG_CSE
+    const Grid& g = AB1.Grid();
+    const Int m = AB1.Height();
+    const Int n = AB1.Width();
+    const Int p = g.Height();
+    if( !PowerOfTwo(p) || m < p*n )
+        return false;
+
+    // Each process column redundantly runs TSQR on its copy of the panel
+    DistMatrix<F,MC,STAR> AB1_MC_STAR(g);
+    AB1_MC_STAR.AlignWith( AB1 );
+    AB1_MC_STAR = AB1;
+    auto treeData = TS( AB1_MC_STAR );
+
+    // Broadcast the triangular factor from the root of the process column
+    // (ts::FormR would assume that the root is unique within the grid)
+    Matrix<F> R;
+    if( AB1_MC_STAR.ColRank() == 0 )
+    {
+        R = ts::RootQR( AB1_MC_STAR, treeData )( IR(0,n), IR(0,n) );
+        MakeTrapezoidal( UPPER, R );
+    }
+    else
+        R.Resize( n, n );
+    mpi::Broadcast( R.Buffer(), n*n, 0, AB1_MC_STAR.ColComm() );
+
+    // Overwrite the panel with its explicit orthonormal factor
+    ts::FormQ( AB1_MC_STAR, treeData );
+
+    // Q - | D | = | L1 | U, so that the Householder vectors are the columns of
+    //     | 0 |   | L2 |
+    // the unit lower-trapezoidal matrix L, where L2 = Q2 inv(U)
+    DistMatrix<F,STAR,STAR> Y11_STAR_STAR(g);
+    auto Q1 = AB1_MC_STAR( IR(0,n), ALL );
+    auto Q2 = AB1_MC_STAR( IR(n,END), ALL );
+    Y11_STAR_STAR = Q1;
+    DistMatrix<F,STAR,STAR> householderScalars_STAR_STAR(g);
+    DistMatrix<Base<F>,STAR,STAR> signature_STAR_STAR(g);
+    householderScalars_STAR_STAR.Resize( n, 1 );
+    signature_STAR_STAR.Resize( n, 1 );
+    ReconstructionLU
+    ( Y11_STAR_STAR.Matrix(),
+      householderScalars_STAR_STAR.Matrix(),
+      signature_STAR_STAR.Matrix() );
+    LocalTrsm
+    ( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), Y11_STAR_STAR, Q2 );
+
+    // Store R in the upper triangle and the Householder vectors below it
+    MakeTrapezoidal( LOWER, Y11_STAR_STAR.Matrix(), -1 );
+    AxpyTrapezoid( UPPER, F(1), R, Y11_STAR_STAR.Matrix() );
+    auto A11 = AB1( IR(0,n), ALL );
+    auto A21 = AB1( IR(n,END), ALL );
+    A11 = Y11_STAR_STAR;
+    A21 = Q2;
+    Copy( householderScalars_STAR_STAR, householderScalars );
+    Copy( signature_STAR_STAR, signature );
+    return true;
+}
+
+} // namespace ca
+
+template<typename F>
+void
+CommunicationAvoiding
+( ElementalMatrix<F>& APre,
+  ElementalMatrix<F>& householderScalarsPre,
+  ElementalMatrix<Base<F>>& signaturePre )
+{
+    DEBUG_CSE
+    DEBUG_ONLY(AssertSameGrids( APre, householderScalarsPre, signaturePre ))
+    const Int m = APre.Height();
+    const Int n = APre.Width();
+    const Int minDim = Min(m,n);
+
+    DistMatrixReadWriteProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixWriteProxy<F,F,MD,STAR>
+      householderScalarsProx( householderScalarsPre );
+    DistMatrixWriteProxy<Base<F>,Base<F>,MD,STAR> signatureProx( signaturePre );
+    auto& A = AProx.Get();
+    auto& householderScalars = householderScalarsProx.Get();
+    auto& signature = signatureProx.Get();
+
+    householderScalars.Resize( minDim, 1 );
+    signature.Resize( minDim, 1 );
+
+    const Int bsize = Blocksize();
+    for( Int k=0; k<minDim; k+=bsize )
+    {
+        const Int nb = Min(bsize,minDim-k);
+
+        const Range<Int> ind1( k,    k+nb ),
+                         indB( k,    END  ),
+                         ind2( k+nb, END  );
+
+        auto AB1 = A( indB, ind1 );
+        auto AB2 = A( indB, ind2 );
+        auto householderScalars1 = householderScalars( ind1, ALL );
+        auto sig1 = signature( ind1, ALL );
+
+        // The last few panels are usually too short for TSQR
+        if( !ca::PanelTSQR( AB1, householderScalars1, sig1 ) )
+            PanelHouseholder( AB1, householderScalars1, sig1 );
+        ApplyQ( LEFT, ADJOINT, AB1, householderScalars1, sig1, AB2 );
+    }
+}
+
+} // namespace qr
+} // namespace El
+
+#endif // ifndef EL_QR_COMMUNICATIONAVOIDING_HPP
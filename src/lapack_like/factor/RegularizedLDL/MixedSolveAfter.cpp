@@ -0,0 +1,237 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./SolveAfter.hpp"
+
+// Solves with a regularized factorization whose fronts are stored in a lower
+// precision than A (see ldl::DemoteFronts)
+
+namespace El {
+
+namespace reg_ldl {
+
+template<typename F>
+Int RegularizedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    return RegularizedSolveAfterNoPromote
+           ( A, reg, invMap, info, front, B, relTol, maxRefineIts, progress );
+}
+
+template<typename F>
+Int RegularizedSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    return RegularizedSolveAfterNoPromote
+           ( A, reg, d, invMap, info, front, B,
+             relTol, maxRefineIts, progress );
+}
+
+template<typename F>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    return RegularizedSolveAfterNoPromote
+           ( A, reg, invMap, info, front, B, meta,
+             relTol, maxRefineIts, progress );
+}
+
+template<typename F>
+Int RegularizedSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    return RegularizedSolveAfterNoPromote
+           ( A, reg, d, invMap, info, front, B, meta,
+             relTol, maxRefineIts, progress );
+}
+
+template<typename F>
+Int SolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return KrylovSolveAfter( A, reg, invMap, info, front, B, ctrl );
+}
+
+template<typename F>
+Int SolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<Demote<F>>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return KrylovSolveAfter( A, reg, d, invMap, info, front, B, ctrl );
+}
+
+template<typename F>
+Int SolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return KrylovSolveAfter( A, reg, invMap, info, front, B, meta, ctrl );
+}
+
+template<typename F>
+Int SolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<Demote<F>>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    return KrylovSolveAfter( A, reg, d, invMap, info, front, B, meta, ctrl );
+}
+
+#define PROTO(F) \
+  template Int RegularizedSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    Base<F> relTol, Int maxRefineIts, bool progress ); \
+  template Int RegularizedSolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const Matrix<Base<F>>& d, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    Base<F> relTol, Int maxRefineIts, bool progress ); \
+  template Int RegularizedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
+    Base<F> relTol, Int maxRefineIts, bool progress ); \
+  template Int RegularizedSolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
+    Base<F> relTol, Int maxRefineIts, bool progress ); \
+  template Int SolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int SolveAfter \
+  ( const SparseMatrix<F>& A, \
+    const Matrix<Base<F>>& reg, \
+    const Matrix<Base<F>>& d, \
+    const vector<Int>& invMap, \
+    const ldl::NodeInfo& info, \
+    const ldl::Front<Demote<F>>& front, \
+          Matrix<F>& B, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int SolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
+    const RegSolveCtrl<Base<F>>& ctrl ); \
+  template Int SolveAfter \
+  ( const DistSparseMatrix<F>& A, \
+    const DistMultiVec<Base<F>>& reg, \
+    const DistMultiVec<Base<F>>& d, \
+    const DistMap& invMap, \
+    const ldl::DistNodeInfo& info, \
+    const ldl::DistFront<Demote<F>>& front, \
+          DistMultiVec<F>& B, \
+          ldl::DistMultiVecNodeMeta& meta, \
+    const RegSolveCtrl<Base<F>>& ctrl );
+
+// Only double-precision systems currently have a lower-precision counterpart
+#define PROTO_FLOAT
+#define PROTO_COMPLEX_FLOAT
+
+#define EL_NO_INT_PROTO
+#include <El/macros/Instantiate.h>
+
+} // namespace reg_ldl
+} // namespace El
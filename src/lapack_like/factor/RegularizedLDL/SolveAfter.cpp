@@ -8,81 +8,12 @@
 */
 #include <El.hpp>
 
+#include "./SolveAfter.hpp"
+
 namespace El {
 
 namespace reg_ldl {
 
-template<typename F>
-inline Int RegularizedSolveAfterNoPromote
-( const SparseMatrix<F>& A, 
-  const Matrix<Base<F>>& reg,
-  const vector<Int>& invMap, 
-  const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
-        Matrix<F>& B,
-        Base<F> relTol,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-
-    // TODO: Use time in these lambdas
-    auto applyA =
-      [&]( const Matrix<F>& X, Matrix<F>& Y )
-      {
-        Y = X;
-        DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, F(1), A, X, F(1), Y );
-      };
-    auto applyAInv = 
-      [&]( Matrix<F>& Y )
-      {
-        ldl::MatrixNode<F> YNodal( invMap, info, Y );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y );
-      };
-
-    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
-}
-
-template<typename F>
-inline Int RegularizedSolveAfterNoPromote
-( const SparseMatrix<F>& A,
-  const Matrix<Base<F>>& reg,
-  const Matrix<Base<F>>& d, 
-  const vector<Int>& invMap,
-  const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
-        Matrix<F>& B,
-  Base<F> relTol,
-  Int maxRefineIts, 
-  bool progress,
-  bool time )
-{
-    DEBUG_CSE
-
-    // TODO: Use time in these lambdas
-    auto applyA =
-      [&]( const Matrix<F>& X, Matrix<F>& Y )
-      {
-        Y = X;
-        DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, F(1), A, X, F(1), Y );
-      };
-    auto applyAInv = 
-      [&]( Matrix<F>& Y )
-      {
-        DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::MatrixNode<F> YNodal( invMap, info, Y );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y );
-        DiagonalSolve( LEFT, NORMAL, d, Y );
-      };
-
-    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
-}
-
 template<typename F>
 inline DisableIf<IsSame<F,Promote<F>>,Int>
 RegularizedSolveAfterPromote
@@ -120,9 +51,7 @@ RegularizedSolveAfterPromote
     auto applyAInv =  
       [&]( Matrix<F>& Y )
       {
-        ldl::MatrixNode<F> YNodal( invMap, info, Y );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y );
+        ApplyInverse( invMap, info, front, Y );
       };
 
     return PromotedRefinedSolve
@@ -145,7 +74,7 @@ RegularizedSolveAfterPromote
 {
     DEBUG_CSE
     return RegularizedSolveAfterNoPromote
-      ( A, reg, invMap, info, front, B, relTol, maxRefineIts, progress, time );
+      ( A, reg, invMap, info, front, B, relTol, maxRefineIts, progress );
 }
 
 template<typename F>
@@ -186,9 +115,7 @@ RegularizedSolveAfterPromote
       [&]( Matrix<F>& Y )
       {
         DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::MatrixNode<F> YNodal( invMap, info, Y );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y );
+        ApplyInverse( invMap, info, front, Y );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
 
@@ -212,9 +139,8 @@ RegularizedSolveAfterPromote
   bool time )
 {
     DEBUG_CSE
-    return RegularizedSolveAfter
-      ( A, reg, d, invMap, info, front, B,
-        relTol, maxRefineIts, progress, time );
+    return RegularizedSolveAfterNoPromote
+      ( A, reg, d, invMap, info, front, B, relTol, maxRefineIts, progress );
 }
 
 template<typename F>
@@ -256,124 +182,6 @@ Int RegularizedSolveAfter
              B, relTol, maxRefineIts, progress, time );
 }
 
-template<typename F>
-inline Int RegularizedSolveAfterNoPromote
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        ldl::DistMultiVecNodeMeta& meta,
-  Base<F> relTol,
-  Int maxRefineIts,
-  bool progress,
-  bool time )
-{
-    DEBUG_CSE
-
-    // TODO: Use time in these lambdas
-    auto applyA =
-      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
-      {
-        Y = X;
-        DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, F(1), A, X, F(1), Y );
-      };
-    auto applyAInv = 
-      [&]( DistMultiVec<F>& Y )
-      {
-        // TODO: Switch to DistMatrixNode with large numbers of RHS
-        ldl::DistMultiVecNode<F> YNodal;
-        YNodal.Pull( invMap, info, Y, meta );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y, meta );
-      };
-
-    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
-}
-
-template<typename F>
-inline Int RegularizedSolveAfterNoPromote
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-  Base<F> relTol,
-  Int maxRefineIts,
-  bool progress,
-  bool time )
-{
-    DEBUG_CSE
-    ldl::DistMultiVecNodeMeta meta;
-    return RegularizedSolveAfterNoPromote
-           ( A, reg, invMap, info, front, B, meta,
-             relTol, maxRefineIts, progress, time );
-}
-
-template<typename F>
-inline Int RegularizedSolveAfterNoPromote
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMultiVec<Base<F>>& d,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        ldl::DistMultiVecNodeMeta& meta,
-  Base<F> relTol,
-  Int maxRefineIts,
-  bool progress,
-  bool time )
-{
-    DEBUG_CSE
-
-    // TODO: Use time in these lambdas
-    auto applyA =
-      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
-      {
-        Y = X;
-        DiagonalScale( LEFT, NORMAL, reg, Y ); 
-        Multiply( NORMAL, F(1), A, X, F(1), Y );
-      };
-    auto applyAInv = 
-      [&]( DistMultiVec<F>& Y )
-      {
-        // TODO: Switch to DistMatrixNode with large numbers of RHS
-        DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::DistMultiVecNode<F> YNodal;
-        YNodal.Pull( invMap, info, Y, meta );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y, meta );
-        DiagonalSolve( LEFT, NORMAL, d, Y );
-      };
-
-    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
-}
-
-template<typename F>
-inline Int RegularizedSolveAfterNoPromote
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMultiVec<Base<F>>& d,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-  Base<F> relTol,
-  Int maxRefineIts,
-  bool progress,
-  bool time )
-{
-    DEBUG_CSE
-    ldl::DistMultiVecNodeMeta meta;
-    return RegularizedSolveAfterNoPromote
-           ( A, reg, d, invMap, info, front, B, meta,
-             relTol, maxRefineIts, progress, time );
-}
-
 template<typename F>
 inline DisableIf<IsSame<F,Promote<F>>,Int>
 RegularizedSolveAfterPromote
@@ -411,11 +219,7 @@ RegularizedSolveAfterPromote
     auto applyAInv = 
       [&]( DistMultiVec<F>& Y )
       {
-        // TODO: Switch to DistMatrixNode for large numbers of RHS
-        ldl::DistMultiVecNode<F> YNodal;
-        YNodal.Pull( invMap, info, Y, meta );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y, meta );
+        ApplyInverse( invMap, info, front, Y, meta );
       };
 
     return PromotedRefinedSolve
@@ -440,7 +244,7 @@ RegularizedSolveAfterPromote
     DEBUG_CSE
     return RegularizedSolveAfterNoPromote
       ( A, reg, invMap, info, front, B, meta,
-        relTol, maxRefineIts, progress, time );
+        relTol, maxRefineIts, progress );
 }
 
 template<typename F>
@@ -502,10 +306,7 @@ RegularizedSolveAfterPromote
       [&]( DistMultiVec<F>& Y )
       {
         DiagonalSolve( LEFT, NORMAL, d, Y );
-        ldl::DistMultiVecNode<F> YNodal;
-        YNodal.Pull( invMap, info, Y, meta );
-        ldl::SolveAfter( info, front, YNodal );
-        YNodal.Push( invMap, info, Y, meta );
+        ApplyInverse( invMap, info, front, Y, meta );
         DiagonalSolve( LEFT, NORMAL, d, Y );
       };
 
@@ -532,7 +333,7 @@ RegularizedSolveAfterPromote
     DEBUG_CSE
     return RegularizedSolveAfterNoPromote
       ( A, reg, d, invMap, info, front, B, meta,
-        relTol, maxRefineIts, progress, time );
+        relTol, maxRefineIts, progress );
 }
 
 template<typename F>
@@ -638,378 +439,6 @@ Int RegularizedSolveAfter
       relTol, maxRefineIts, progress, time );
 }
 
-template<typename F>
-Int LGMRESSolveAfter
-( const SparseMatrix<F>& A, 
-  const Matrix<Base<F>>& reg,
-  const vector<Int>& invMap, 
-  const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
-        Matrix<F>& B,
-  Base<F> relTol,
-  Int restart,
-  Int maxIts,
-  Base<F> relTolRefine,
-  Int maxRefineIts,
-  bool progress )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( Matrix<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, invMap, info, front, W, 
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int LGMRESSolveAfter
-( const SparseMatrix<F>& A,
-  const Matrix<Base<F>>& reg,
-  const Matrix<Base<F>>& d,
-  const vector<Int>& invMap,
-  const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
-        Matrix<F>& B,
-  Base<F> relTol,
-  Int restart,
-  Int maxIts,
-  Base<F> relTolRefine,
-  Int maxRefineIts,
-  bool progress )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( Matrix<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, d, invMap, info, front, W, 
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int LGMRESSolveAfter
-( const DistSparseMatrix<F>& A,
-  const DistMultiVec<Base<F>>& reg,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        ldl::DistMultiVecNodeMeta& meta,
-  Base<F> relTol,
-  Int restart,
-  Int maxIts,
-  Base<F> relTolRefine,
-  Int maxRefineIts,
-  bool progress )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( DistMultiVec<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, invMap, info, front, W, meta,
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int LGMRESSolveAfter
-( const DistSparseMatrix<F>& A,
-  const DistMultiVec<Base<F>>& reg,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-  Base<F> relTol,
-  Int restart,
-  Int maxIts,
-  Base<F> relTolRefine,
-  Int maxRefineIts,
-  bool progress )
-{
-    DEBUG_CSE
-    ldl::DistMultiVecNodeMeta meta;
-    return LGMRESSolveAfter
-           ( A, reg, invMap, info, front, B, meta,
-             relTol, restart, maxIts, relTolRefine, maxRefineIts, progress );
-}
-
-template<typename F>
-Int LGMRESSolveAfter
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMultiVec<Base<F>>& d,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        ldl::DistMultiVecNodeMeta& meta,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts,
-        bool progress )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( DistMultiVec<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, d, invMap, info, front, W, meta,
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int LGMRESSolveAfter
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMultiVec<Base<F>>& d,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-  Base<F> relTol,
-  Int restart,
-  Int maxIts,
-  Base<F> relTolRefine,
-  Int maxRefineIts,
-  bool progress )
-{
-    DEBUG_CSE
-    ldl::DistMultiVecNodeMeta meta;
-    return LGMRESSolveAfter
-           ( A, reg, d, invMap, info, front, B, meta,
-             relTol, restart, maxIts, relTolRefine, maxRefineIts, progress );
-}
-
-template<typename F>
-Int FGMRESSolveAfter
-( const SparseMatrix<F>& A, 
-  const Matrix<Base<F>>& reg,
-  const vector<Int>& invMap, 
-  const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
-        Matrix<F>& B,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( Matrix<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, invMap, info, front, W, 
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int FGMRESSolveAfter
-( const SparseMatrix<F>& A, 
-  const Matrix<Base<F>>& reg,
-  const Matrix<Base<F>>& d,
-  const vector<Int>& invMap, 
-  const ldl::NodeInfo& info,
-  const ldl::Front<F>& front, 
-        Matrix<F>& B,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( Matrix<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, d, invMap, info, front, W,
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int FGMRESSolveAfter
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        ldl::DistMultiVecNodeMeta& meta,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( DistMultiVec<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, invMap, info, front, W, meta,
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int FGMRESSolveAfter
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-    ldl::DistMultiVecNodeMeta meta;
-    return FGMRESSolveAfter
-           ( A, reg, invMap, info, front, B, meta,
-             relTol, restart, maxIts, relTolRefine, maxRefineIts,
-             progress, time );
-}
-
-template<typename F>
-Int FGMRESSolveAfter
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMultiVec<Base<F>>& d,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        ldl::DistMultiVecNodeMeta& meta,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-
-    auto applyA =
-      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
-      {
-          Multiply( NORMAL, alpha, A, X, beta, Y );
-      };
-    auto precond =
-      [&]( DistMultiVec<F>& W )
-      {
-        RegularizedSolveAfter
-        ( A, reg, d, invMap, info, front, W, meta,
-          relTolRefine, maxRefineIts, progress );
-      };
-
-    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
-}
-
-template<typename F>
-Int FGMRESSolveAfter
-( const DistSparseMatrix<F>& A, 
-  const DistMultiVec<Base<F>>& reg,
-  const DistMultiVec<Base<F>>& d,
-  const DistMap& invMap, 
-  const ldl::DistNodeInfo& info,
-  const ldl::DistFront<F>& front, 
-        DistMultiVec<F>& B,
-        Base<F> relTol,
-        Int restart,
-        Int maxIts,
-        Base<F> relTolRefine,
-        Int maxRefineIts, 
-        bool progress,
-        bool time )
-{
-    DEBUG_CSE
-    ldl::DistMultiVecNodeMeta meta;
-    return FGMRESSolveAfter
-           ( A, reg, d, invMap, info, front, B, meta,
-             relTol, restart, maxIts, relTolRefine, maxRefineIts,
-             progress, time );
-}
-
-// TODO: Add RGMRES
-
 template<typename F>
 Int SolveAfter
 ( const SparseMatrix<F>& A,
@@ -1021,24 +450,7 @@ Int SolveAfter
   const RegSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    switch( ctrl.alg )
-    {
-    case REG_SOLVE_FGMRES:
-        return FGMRESSolveAfter
-        ( A, reg, invMap, info, front, B, 
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
-    case REG_SOLVE_LGMRES:
-        return LGMRESSolveAfter
-        ( A, reg, invMap, info, front, B, 
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
-    default:
-        LogicError("Invalid refinement algorithm");
-        return -1;
-    }
+    return KrylovSolveAfter( A, reg, invMap, info, front, B, ctrl );
 }
 
 template<typename F>
@@ -1053,24 +465,7 @@ Int SolveAfter
   const RegSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    switch( ctrl.alg )
-    {
-    case REG_SOLVE_FGMRES:
-        return FGMRESSolveAfter
-        ( A, reg, d, invMap, info, front, B, 
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
-    case REG_SOLVE_LGMRES:
-        return LGMRESSolveAfter
-        ( A, reg, d, invMap, info, front, B, 
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
-    default:
-        LogicError("Invalid refinement algorithm");
-        return -1;
-    }
+    return KrylovSolveAfter( A, reg, d, invMap, info, front, B, ctrl );
 }
 
 template<typename F>
@@ -1085,24 +480,7 @@ Int SolveAfter
   const RegSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    switch( ctrl.alg )
-    {
-    case REG_SOLVE_FGMRES:
-        return FGMRESSolveAfter
-        ( A, reg, invMap, info, front, B, meta,
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
-    case REG_SOLVE_LGMRES:
-        return LGMRESSolveAfter
-        ( A, reg, invMap, info, front, B, meta,
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
-    default:
-        LogicError("Invalid refinement algorithm");
-        return -1;
-    }
+    return KrylovSolveAfter( A, reg, invMap, info, front, B, meta, ctrl );
 }
 
 template<typename F>
@@ -1133,24 +511,7 @@ Int SolveAfter
   const RegSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
-    switch( ctrl.alg )
-    {
-    case REG_SOLVE_FGMRES:
-        return FGMRESSolveAfter
-        ( A, reg, d, invMap, info, front, B, meta,
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress, ctrl.time );
-    case REG_SOLVE_LGMRES:
-        return LGMRESSolveAfter
-        ( A, reg, d, invMap, info, front, B, meta,
-          ctrl.relTol, ctrl.restart, ctrl.maxIts,
-          ctrl.relTolRefine, ctrl.maxRefineIts, 
-          ctrl.progress );
-    default:
-        LogicError("Invalid refinement algorithm");
-        return -1;
-    }
+    return KrylovSolveAfter( A, reg, d, invMap, info, front, B, meta, ctrl );
 }
 
 template<typename F>
@@ -0,0 +1,595 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_REG_LDL_SOLVEAFTER_HPP
+#define EL_REG_LDL_SOLVEAFTER_HPP
+
+// The refinement and Krylov harnesses shared by the solves with fronts in the
+// precision of A (SolveAfter.cpp) and in a lower precision
+// (MixedSolveAfter.cpp). In the latter case, only the application of the
+// inverse of the factorization is performed in the precision of the fronts.
+
+namespace El {
+namespace reg_ldl {
+
+template<typename F>
+inline void ApplyInverse
+( const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<F>& front,
+        Matrix<F>& Y )
+{
+    DEBUG_CSE
+    ldl::MatrixNode<F> YNodal( invMap, info, Y );
+    ldl::SolveAfter( info, front, YNodal );
+    YNodal.Push( invMap, info, Y );
+}
+
+template<typename F,typename FFront>
+inline void ApplyInverse
+( const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& Y )
+{
+    DEBUG_CSE
+    Matrix<FFront> YFront;
+    Copy( Y, YFront );
+    ApplyInverse( invMap, info, front, YFront );
+    Copy( YFront, Y );
+}
+
+template<typename F>
+inline void ApplyInverse
+( const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<F>& front,
+        DistMultiVec<F>& Y,
+        ldl::DistMultiVecNodeMeta& meta )
+{
+    DEBUG_CSE
+    // TODO: Switch to DistMatrixNode with large numbers of RHS
+    ldl::DistMultiVecNode<F> YNodal;
+    YNodal.Pull( invMap, info, Y, meta );
+    ldl::SolveAfter( info, front, YNodal );
+    YNodal.Push( invMap, info, Y, meta );
+}
+
+template<typename F,typename FFront>
+inline void ApplyInverse
+( const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& Y,
+        ldl::DistMultiVecNodeMeta& meta )
+{
+    DEBUG_CSE
+    DistMultiVec<FFront> YFront(Y.Comm());
+    Copy( Y, YFront );
+    ApplyInverse( invMap, info, front, YFront, meta );
+    Copy( YFront, Y );
+}
+
+template<typename F,typename FFront>
+inline Int RegularizedSolveAfterNoPromote
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        ApplyInverse( invMap, info, front, Y );
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int RegularizedSolveAfterNoPromote
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    auto applyAInv =
+      [&]( Matrix<F>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        ApplyInverse( invMap, info, front, Y );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int RegularizedSolveAfterNoPromote
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        ApplyInverse( invMap, info, front, Y, meta );
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int RegularizedSolveAfterNoPromote
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+      {
+        Y = X;
+        DiagonalScale( LEFT, NORMAL, reg, Y );
+        Multiply( NORMAL, F(1), A, X, F(1), Y );
+      };
+    auto applyAInv =
+      [&]( DistMultiVec<F>& Y )
+      {
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+        ApplyInverse( invMap, info, front, Y, meta );
+        DiagonalSolve( LEFT, NORMAL, d, Y );
+      };
+
+    return RefinedSolve( applyA, applyAInv, B, relTol, maxRefineIts, progress );
+}
+
+// The preconditioners call the public RegularizedSolveAfter, which selects
+// between the promoted refinement (for fronts in the precision of A) and the
+// mixed-precision refinement (for fronts in a lower precision)
+
+template<typename F,typename FFront>
+inline Int LGMRESSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, invMap, info, front, W,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int LGMRESSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, invMap, info, front, W,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int LGMRESSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, invMap, info, front, W, meta,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int LGMRESSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, invMap, info, front, W, meta,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return LGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int FGMRESSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, invMap, info, front, W,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int FGMRESSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( Matrix<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, invMap, info, front, W,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int FGMRESSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, invMap, info, front, W, meta,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+template<typename F,typename FFront>
+inline Int FGMRESSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  Base<F> relTol,
+  Int restart,
+  Int maxIts,
+  Base<F> relTolRefine,
+  Int maxRefineIts,
+  bool progress )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( F alpha, const DistMultiVec<F>& X, F beta, DistMultiVec<F>& Y )
+      {
+          Multiply( NORMAL, alpha, A, X, beta, Y );
+      };
+    auto precond =
+      [&]( DistMultiVec<F>& W )
+      {
+        RegularizedSolveAfter
+        ( A, reg, d, invMap, info, front, W, meta,
+          relTolRefine, maxRefineIts, progress );
+      };
+
+    return FGMRES( applyA, precond, B, relTol, restart, maxIts, progress );
+}
+
+// TODO: Add RGMRES
+
+template<typename F,typename FFront>
+inline Int KrylovSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRESSolveAfter
+        ( A, reg, invMap, info, front, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRESSolveAfter
+        ( A, reg, invMap, info, front, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F,typename FFront>
+inline Int KrylovSolveAfter
+( const SparseMatrix<F>& A,
+  const Matrix<Base<F>>& reg,
+  const Matrix<Base<F>>& d,
+  const vector<Int>& invMap,
+  const ldl::NodeInfo& info,
+  const ldl::Front<FFront>& front,
+        Matrix<F>& B,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F,typename FFront>
+inline Int KrylovSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRESSolveAfter
+        ( A, reg, invMap, info, front, B, meta,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRESSolveAfter
+        ( A, reg, invMap, info, front, B, meta,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+template<typename F,typename FFront>
+inline Int KrylovSolveAfter
+( const DistSparseMatrix<F>& A,
+  const DistMultiVec<Base<F>>& reg,
+  const DistMultiVec<Base<F>>& d,
+  const DistMap& invMap,
+  const ldl::DistNodeInfo& info,
+  const ldl::DistFront<FFront>& front,
+        DistMultiVec<F>& B,
+        ldl::DistMultiVecNodeMeta& meta,
+  const RegSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    switch( ctrl.alg )
+    {
+    case REG_SOLVE_FGMRES:
+        return FGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B, meta,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    case REG_SOLVE_LGMRES:
+        return LGMRESSolveAfter
+        ( A, reg, d, invMap, info, front, B, meta,
+          ctrl.relTol, ctrl.restart, ctrl.maxIts,
+          ctrl.relTolRefine, ctrl.maxRefineIts, ctrl.progress );
+    default:
+        LogicError("Invalid refinement algorithm");
+        return -1;
+    }
+}
+
+} // namespace reg_ldl
+} // namespace El
+
+#endif // ifndef EL_REG_LDL_SOLVEAFTER_HPP
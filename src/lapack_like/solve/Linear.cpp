@@ -179,7 +179,7 @@ void Overwrite( Matrix<F>& A, Matrix<F>& B )
 
 template<typename F> 
 void Overwrite
-( ElementalMatrix<F>& APre, ElementalMatrix<F>& BPre )
+( ElementalMatrix<F>& APre, ElementalMatrix<F>& BPre, LUPivotType pivotType )
 {
     DEBUG_CSE
 
@@ -192,7 +192,7 @@ void Overwrite
     if( useFullLU )
     {
         DistPermutation P(A.Grid());
-        LU( A, P );
+        LU( A, P, pivotType );
         lu::SolveAfter( NORMAL, A, P, B );
     }
     else
@@ -202,12 +202,211 @@ void Overwrite
     }
 }
 
+// Factor A in the next-lower precision and refine the solution against the
+// original matrix. The return value signals whether the refined solution met
+// the requested normwise backward error,
+//
+//   || B - A X ||_F / ( || A ||_F || X ||_F + || B ||_F ),
+//
+// which, unlike the relative residual, is invariant to the scaling of A; if
+// not, B is left unmodified.
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,bool>
+MixedPrecision
+( const Matrix<F>& A, Matrix<F>& B, const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+
+    const Matrix<F> BOrig( B );
+    try
+    {
+        Matrix<FLow> ALow;
+        Copy( A, ALow );
+        Permutation P;
+        LU( ALow, P );
+
+        Matrix<FLow> YLow;
+        auto applyAInv =
+          [&]( Matrix<F>& Y )
+          {
+            Copy( Y, YLow );
+            lu::SolveAfter( NORMAL, ALow, P, YLow );
+            Copy( YLow, Y );
+          };
+        if( ctrl.refineAlg == LINEAR_SOLVE_REFINE_FGMRES )
+        {
+            auto applyA =
+              [&]( F alpha, const Matrix<F>& X, F beta, Matrix<F>& Y )
+              {
+                Gemm( NORMAL, NORMAL, alpha, A, X, beta, Y );
+              };
+            FGMRES
+            ( applyA, applyAInv, B,
+              ctrl.relTol, ctrl.restart, ctrl.maxRefineIts, ctrl.progress );
+        }
+        else
+        {
+            auto applyA =
+              [&]( const Matrix<F>& X, Matrix<F>& Y )
+              {
+                Gemm( NORMAL, NORMAL, F(1), A, X, Y );
+              };
+            RefinedSolve
+            ( applyA, applyAInv, B,
+              ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+        }
+    }
+    catch( SingularMatrixException& )
+    {
+        B = BOrig;
+        return false;
+    }
+
+    // Since batch refinement does not enforce the tolerance, explicitly check
+    // the final backward error (a failure to converge is also detected
+    // through NaN)
+    Matrix<F> R( BOrig );
+    Gemm( NORMAL, NORMAL, F(-1), A, B, F(1), R );
+    const Real backwardError =
+      FrobeniusNorm(R) /
+      (FrobeniusNorm(A)*FrobeniusNorm(B)+FrobeniusNorm(BOrig));
+    if( ctrl.progress )
+        Output("mixed-precision backward error: ",backwardError);
+    if( backwardError <= ctrl.relTol )
+        return true;
+    B = BOrig;
+    return false;
+}
+
+template<typename F>
+DisableIf<IsSame<F,Demote<F>>,bool>
+MixedPrecision
+( const ElementalMatrix<F>& APre,
+        ElementalMatrix<F>& BPre,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    typedef Demote<F> FLow;
+
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    DistMatrixReadWriteProxy<F,F,MC,MR> BProx( BPre );
+    auto& A = AProx.GetLocked();
+    auto& B = BProx.Get();
+    const Grid& g = A.Grid();
+
+    // The existing refinement and FGMRES implementations are driven through
+    // DistMultiVec, which only ever holds the (narrow) right-hand sides
+    DistMultiVec<F> BVec(g.Comm());
+    Copy( B, BVec );
+    DistMatrix<F> XDist(g), YDist(g);
+    // A singular low-precision factor may only be detected by some of the
+    // processes, so the decision to fall back is made collectively
+    byte singular = false;
+    try
+    {
+        DistMatrix<FLow> ALow(g);
+        Copy( A, ALow );
+        DistPermutation P(g);
+        LU( ALow, P, ctrl.pivotType );
+
+        DistMatrix<FLow> YLow(g);
+        auto applyAInv =
+          [&]( DistMultiVec<F>& Y )
+          {
+            Copy( Y, YDist );
+            Copy( YDist, YLow );
+            lu::SolveAfter( NORMAL, ALow, P, YLow );
+            Copy( YLow, YDist );
+            Copy( YDist, Y );
+          };
+        if( ctrl.refineAlg == LINEAR_SOLVE_REFINE_FGMRES )
+        {
+            auto applyA =
+              [&]( F alpha, const DistMultiVec<F>& X,
+                   F beta,        DistMultiVec<F>& Y )
+              {
+                Copy( X, XDist );
+                Copy( Y, YDist );
+                Gemm( NORMAL, NORMAL, alpha, A, XDist, beta, YDist );
+                Copy( YDist, Y );
+              };
+            FGMRES
+            ( applyA, applyAInv, BVec,
+              ctrl.relTol, ctrl.restart, ctrl.maxRefineIts, ctrl.progress );
+        }
+        else
+        {
+            auto applyA =
+              [&]( const DistMultiVec<F>& X, DistMultiVec<F>& Y )
+              {
+                Copy( X, XDist );
+                Gemm( NORMAL, NORMAL, F(1), A, XDist, YDist );
+                Copy( YDist, Y );
+              };
+            RefinedSolve
+            ( applyA, applyAInv, BVec,
+              ctrl.relTol, ctrl.maxRefineIts, ctrl.progress );
+        }
+    }
+    catch( SingularMatrixException& ) { singular = true; }
+    singular = mpi::AllReduce( singular, mpi::LOGICAL_OR, g.Comm() );
+    if( singular )
+        return false;
+
+    // Since batch refinement does not enforce the tolerance, explicitly check
+    // the final backward error (a failure to converge is also detected
+    // through NaN)
+    Copy( BVec, XDist );
+    DistMatrix<F> R( B );
+    Gemm( NORMAL, NORMAL, F(-1), A, XDist, F(1), R );
+    const Real backwardError =
+      FrobeniusNorm(R) /
+      (FrobeniusNorm(A)*FrobeniusNorm(XDist)+FrobeniusNorm(B));
+    if( ctrl.progress )
+        OutputFromRoot
+        (g.Comm(),"mixed-precision backward error: ",backwardError);
+    if( backwardError <= ctrl.relTol )
+    {
+        B = XDist;
+        return true;
+    }
+    return false;
+}
+
+// There is no lower precision to factor in
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,bool>
+MixedPrecision
+( const Matrix<F>& A, Matrix<F>& B, const LinearSolveCtrl<Base<F>>& ctrl )
+{ return false; }
+
+template<typename F>
+EnableIf<IsSame<F,Demote<F>>,bool>
+MixedPrecision
+( const ElementalMatrix<F>& A,
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
+{ return false; }
+
 } // namespace lin_solve
 
 template<typename F> 
-void LinearSolve( const Matrix<F>& A, Matrix<F>& B )
+void LinearSolve
+( const Matrix<F>& A, Matrix<F>& B, const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.mixedPrecision )
+    {
+        if( lin_solve::MixedPrecision( A, B, ctrl ) )
+            return;
+        if( !ctrl.fallback )
+            RuntimeError("Mixed-precision refinement did not converge");
+        if( ctrl.progress )
+            Output("Falling back to a working-precision factorization");
+    }
     Matrix<F> ACopy( A );
     lin_solve::Overwrite( ACopy, B );
 }
@@ -215,11 +414,23 @@ void LinearSolve( const Matrix<F>& A, Matrix<F>& B )
 template<typename F> 
 void LinearSolve
 ( const ElementalMatrix<F>& A,
-        ElementalMatrix<F>& B )
+        ElementalMatrix<F>& B,
+  const LinearSolveCtrl<Base<F>>& ctrl )
 {
     DEBUG_CSE
+    if( ctrl.mixedPrecision )
+    {
+        if( lin_solve::MixedPrecision( A, B, ctrl ) )
+            return;
+        if( !ctrl.fallback )
+            RuntimeError("Mixed-precision refinement did not converge");
+        if( ctrl.progress )
+            OutputFromRoot
+            (A.Grid().Comm(),
+             "Falling back to a working-precision factorization");
+    }
     DistMatrix<F> ACopy( A );
-    lin_solve::Overwrite( ACopy, B );
+    lin_solve::Overwrite( ACopy, B, ctrl.pivotType );
 }
 
 namespace lin_solve {
@@ -301,11 +512,15 @@ void LinearSolve
 #define PROTO(F) \
   template void lin_solve::Overwrite( Matrix<F>& A, Matrix<F>& B ); \
   template void lin_solve::Overwrite \
-  ( ElementalMatrix<F>& A, ElementalMatrix<F>& B ); \
-  template void LinearSolve( const Matrix<F>& A, Matrix<F>& B ); \
+  ( ElementalMatrix<F>& A, ElementalMatrix<F>& B, \
+    LUPivotType pivotType ); \
+  template void LinearSolve \
+  ( const Matrix<F>& A, Matrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const ElementalMatrix<F>& A, \
-          ElementalMatrix<F>& B ); \
+          ElementalMatrix<F>& B, \
+    const LinearSolveCtrl<Base<F>>& ctrl ); \
   template void LinearSolve \
   ( const DistMatrix<F,MC,MR,BLOCK>& A, \
           DistMatrix<F,MC,MR,BLOCK>& B ); \
@@ -0,0 +1,345 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+#include "./RandomizedSVD/RangeFinder.hpp"
+
+namespace El {
+
+template<typename F>
+Base<F> RandomizedRangeFinder
+( const Matrix<F>& A,
+        Matrix<F>& Q,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<F>& Y, Matrix<F>& X )
+      { Gemm( ADJOINT, NORMAL, F(1), A, Y, X ); };
+
+    Matrix<F> W;
+    const Base<F> residSquared =
+      rsvd::RangeFinder
+      ( A.Height(), A.Width(), applyA, applyAAdj, FrobeniusNorm(A),
+        Q, W, ctrl );
+    return Sqrt(residSquared);
+}
+
+template<typename F>
+Base<F> RandomizedRangeFinder
+( const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& QPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    auto applyA =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<F,VC,STAR>& Y, DistMatrix<F,VC,STAR>& X )
+      { Gemm( ADJOINT, NORMAL, F(1), A, Y, X ); };
+
+    DistMatrix<F,VC,STAR> Q(g), W(g);
+    const Base<F> residSquared =
+      rsvd::RangeFinder
+      ( A.Height(), A.Width(), applyA, applyAAdj, FrobeniusNorm(A),
+        Q, W, ctrl );
+    Copy( Q, QPre );
+    return Sqrt(residSquared);
+}
+
+template<typename F>
+Base<F> RandomizedSVD
+( const Matrix<F>& A,
+        Matrix<F>& U,
+        Matrix<Base<F>>& s,
+        Matrix<F>& V,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, Y ); };
+    auto applyAAdj =
+      [&]( const Matrix<F>& Y, Matrix<F>& X )
+      { Gemm( ADJOINT, NORMAL, F(1), A, Y, X ); };
+
+    // A ~= Q B, where B = Q^H A = W^H
+    Matrix<F> Q, W;
+    const Real frobNormA = FrobeniusNorm( A );
+    Real residSquared =
+      rsvd::RangeFinder
+      ( A.Height(), A.Width(), applyA, applyAAdj, frobNormA, Q, W, ctrl );
+
+    // Since W = Q_W R, B = R^H Q_W^H = U_R diag(s) (Q_W V_R)^H
+    Matrix<F> R, RAdj, UR, VR;
+    Matrix<Real> sR;
+    rsvd::Orthonormalize( W, R );
+    Adjoint( R, RAdj );
+    SVD( RAdj, UR, sR, VR );
+    const Int k = rsvd::TruncatedRank( sR, frobNormA, residSquared, ctrl );
+
+    Gemm( NORMAL, NORMAL, F(1), Q, UR(ALL,IR(0,k)), U );
+    Gemm( NORMAL, NORMAL, F(1), W, VR(ALL,IR(0,k)), V );
+    s = sR( IR(0,k), ALL );
+    return Sqrt(residSquared);
+}
+
+template<typename F>
+Base<F> RandomizedSVD
+( const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<F>& UPre,
+        AbstractDistMatrix<Base<F>>& sPre,
+        AbstractDistMatrix<F>& VPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+
+    auto applyA =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      { Gemm( NORMAL, NORMAL, F(1), A, X, Y ); };
+    auto applyAAdj =
+      [&]( const DistMatrix<F,VC,STAR>& Y, DistMatrix<F,VC,STAR>& X )
+      { Gemm( ADJOINT, NORMAL, F(1), A, Y, X ); };
+
+    // A ~= Q B, where B = Q^H A = W^H
+    DistMatrix<F,VC,STAR> Q(g), W(g);
+    const Real frobNormA = FrobeniusNorm( A );
+    Real residSquared =
+      rsvd::RangeFinder
+      ( A.Height(), A.Width(), applyA, applyAAdj, frobNormA, Q, W, ctrl );
+
+    // Since W = Q_W R (via TSQR), B = R^H Q_W^H = U_R diag(s) (Q_W V_R)^H,
+    // where the small SVD of R^H is redundantly computed on every process
+    DistMatrix<F,STAR,STAR> R(g);
+    rsvd::Orthonormalize( W, R );
+    Matrix<F> RAdj, UR, VR;
+    Matrix<Real> sR;
+    Adjoint( R.LockedMatrix(), RAdj );
+    SVD( RAdj, UR, sR, VR );
+    const Int k = rsvd::TruncatedRank( sR, frobNormA, residSquared, ctrl );
+
+    DistMatrix<F,STAR,STAR> URTrunc(g), VRTrunc(g);
+    DistMatrix<Real,STAR,STAR> s(g);
+    URTrunc.Resize( UR.Height(), k );
+    VRTrunc.Resize( VR.Height(), k );
+    s.Resize( k, 1 );
+    URTrunc.Matrix() = UR( ALL, IR(0,k) );
+    VRTrunc.Matrix() = VR( ALL, IR(0,k) );
+    s.Matrix() = sR( IR(0,k), ALL );
+
+    DistMatrix<F,VC,STAR> U(g), V(g);
+    U.AlignWith( Q );
+    V.AlignWith( W );
+    LocalGemm( NORMAL, NORMAL, F(1), Q, URTrunc, U );
+    LocalGemm( NORMAL, NORMAL, F(1), W, VRTrunc, V );
+    Copy( U, UPre );
+    Copy( s, sPre );
+    Copy( V, VPre );
+    return Sqrt(residSquared);
+}
+
+namespace rsvd {
+
+// Given the (Hermitian) projection T = Q^H A Q, return the eigenpairs of T
+// of largest magnitude, sorted by decreasing magnitude and truncated, and
+// return their number
+template<typename F>
+Int TruncatedEig
+( Matrix<F>& T,
+  Matrix<Base<F>>& w,
+  Matrix<F>& ZT,
+  Base<F> frobNormA,
+  Base<F>& residSquared,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Matrix<Real> wT;
+    Matrix<F> ZTUnsorted;
+    HermitianEig( LOWER, T, wT, ZTUnsorted );
+
+    const Int l = wT.Height();
+    vector<Int> order(l);
+    for( Int j=0; j<l; ++j )
+        order[j] = j;
+    std::sort
+    ( order.begin(), order.end(),
+      [&]( Int i, Int j ) { return Abs(wT(i)) > Abs(wT(j)); } );
+
+    Matrix<Real> magnitudes( l, 1 );
+    for( Int j=0; j<l; ++j )
+        magnitudes(j) = Abs(wT(order[j]));
+    const Int k = TruncatedRank( magnitudes, frobNormA, residSquared, ctrl );
+
+    w.Resize( k, 1 );
+    ZT.Resize( l, k );
+    for( Int j=0; j<k; ++j )
+    {
+        w(j) = wT(order[j]);
+        auto zt = ZT( ALL, IR(j) );
+        zt = ZTUnsorted( ALL, IR(order[j]) );
+    }
+    return k;
+}
+
+} // namespace rsvd
+
+template<typename F>
+Base<F> RandomizedHermitianEig
+( UpperOrLower uplo,
+  const Matrix<F>& A,
+        Matrix<Base<F>>& w,
+        Matrix<F>& Z,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    auto applyA =
+      [&]( const Matrix<F>& X, Matrix<F>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Hemm( LEFT, uplo, F(1), A, X, F(0), Y );
+      };
+
+    // W = A Q
+    Matrix<F> Q, W;
+    const Real frobNormA = HermitianFrobeniusNorm( uplo, A );
+    Real residSquared =
+      rsvd::RangeFinder( n, n, applyA, applyA, frobNormA, Q, W, ctrl );
+
+    // || A - Q T Q^H ||_F^2 = ||A||_F^2 - ||T||_F^2, where T = Q^H A Q
+    Matrix<F> T, ZT;
+    Gemm( ADJOINT, NORMAL, F(1), Q, W, T );
+    residSquared +=
+      Pow( FrobeniusNorm(W), Real(2) ) - Pow( FrobeniusNorm(T), Real(2) );
+    residSquared = Max( residSquared, Real(0) );
+
+    rsvd::TruncatedEig( T, w, ZT, frobNormA, residSquared, ctrl );
+    Gemm( NORMAL, NORMAL, F(1), Q, ZT, Z );
+    return Sqrt(residSquared);
+}
+
+template<typename F>
+Base<F> RandomizedHermitianEig
+( UpperOrLower uplo,
+  const AbstractDistMatrix<F>& APre,
+        AbstractDistMatrix<Base<F>>& wPre,
+        AbstractDistMatrix<F>& ZPre,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    DistMatrixReadProxy<F,F,MC,MR> AProx( APre );
+    auto& A = AProx.GetLocked();
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    if( A.Width() != n )
+        LogicError("A must be square");
+    auto applyA =
+      [&]( const DistMatrix<F,VC,STAR>& X, DistMatrix<F,VC,STAR>& Y )
+      {
+          Zeros( Y, n, X.Width() );
+          Hemm( LEFT, uplo, F(1), A, X, F(0), Y );
+      };
+
+    // W = A Q
+    DistMatrix<F,VC,STAR> Q(g), W(g);
+    const Real frobNormA = HermitianFrobeniusNorm( uplo, A );
+    Real residSquared =
+      rsvd::RangeFinder( n, n, applyA, applyA, frobNormA, Q, W, ctrl );
+
+    // || A - Q T Q^H ||_F^2 = ||A||_F^2 - ||T||_F^2, where T = Q^H A Q
+    DistMatrix<F,STAR,STAR> T(g);
+    LocalGemm( ADJOINT, NORMAL, F(1), Q, W, T );
+    El::AllReduce( T, Q.ColComm() );
+    residSquared +=
+      Pow( FrobeniusNorm(W), Real(2) ) -
+      Pow( FrobeniusNorm(T.LockedMatrix()), Real(2) );
+    residSquared = Max( residSquared, Real(0) );
+
+    // The small eigenproblem is redundantly solved on every process
+    Matrix<Real> wLoc;
+    Matrix<F> ZTLoc;
+    const Int k =
+      rsvd::TruncatedEig
+      ( T.Matrix(), wLoc, ZTLoc, frobNormA, residSquared, ctrl );
+
+    DistMatrix<F,STAR,STAR> ZT(g);
+    DistMatrix<Real,STAR,STAR> w(g);
+    ZT.Resize( ZTLoc.Height(), k );
+    w.Resize( k, 1 );
+    ZT.Matrix() = ZTLoc;
+    w.Matrix() = wLoc;
+
+    DistMatrix<F,VC,STAR> Z(g);
+    Z.AlignWith( Q );
+    LocalGemm( NORMAL, NORMAL, F(1), Q, ZT, Z );
+    Copy( w, wPre );
+    Copy( Z, ZPre );
+    return Sqrt(residSquared);
+}
+
+#define PROTO(F) \
+  template Base<F> RandomizedRangeFinder \
+  ( const Matrix<F>& A, \
+          Matrix<F>& Q, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template Base<F> RandomizedRangeFinder \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& Q, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template Base<F> RandomizedSVD \
+  ( const Matrix<F>& A, \
+          Matrix<F>& U, \
+          Matrix<Base<F>>& s, \
+          Matrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template Base<F> RandomizedSVD \
+  ( const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<F>& U, \
+          AbstractDistMatrix<Base<F>>& s, \
+          AbstractDistMatrix<F>& V, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template Base<F> RandomizedHermitianEig \
+  ( UpperOrLower uplo, \
+    const Matrix<F>& A, \
+          Matrix<Base<F>>& w, \
+          Matrix<F>& Z, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl ); \
+  template Base<F> RandomizedHermitianEig \
+  ( UpperOrLower uplo, \
+    const AbstractDistMatrix<F>& A, \
+          AbstractDistMatrix<Base<F>>& w, \
+          AbstractDistMatrix<F>& Z, \
+    const RandomizedSVDCtrl<Base<F>>& ctrl );
+
+#define EL_NO_INT_PROTO
+#define EL_ENABLE_DOUBLEDOUBLE
+#define EL_ENABLE_QUADDOUBLE
+#define EL_ENABLE_QUAD
+#define EL_ENABLE_BIGFLOAT
+#include <El/macros/Instantiate.h>
+
+} // namespace El
@@ -0,0 +1,253 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#ifndef EL_RSVD_RANGEFINDER_HPP
+#define EL_RSVD_RANGEFINDER_HPP
+
+namespace El {
+namespace rsvd {
+
+// Determine the number of columns sampled at a time and the maximum number
+// of columns in the sample
+template<typename Real>
+void SampleSizes
+( Int m, Int n, const RandomizedSVDCtrl<Real>& ctrl,
+  Int& blocksize, Int& maxWidth )
+{
+    const Int minDim = Min(m,n);
+    if( ctrl.adaptive )
+    {
+        maxWidth = ( ctrl.maxRank > 0 ? Min(ctrl.maxRank,minDim) : minDim );
+        blocksize = Max( Int(1), Min(ctrl.blocksize,maxWidth) );
+    }
+    else
+    {
+        maxWidth = Min( ctrl.rank+ctrl.oversample, minDim );
+        blocksize = maxWidth;
+    }
+}
+
+// Y := (I - P P^H) Y, where P has orthonormal columns. The projection is
+// applied twice to avoid the loss of orthogonality of classical Gram-Schmidt.
+template<typename F>
+void ProjectOut( const Matrix<F>& P, Matrix<F>& Y )
+{
+    DEBUG_CSE
+    if( P.Width() == 0 )
+        return;
+    Matrix<F> Z;
+    for( Int pass=0; pass<2; ++pass )
+    {
+        Gemm( ADJOINT, NORMAL, F(1), P, Y, Z );
+        Gemm( NORMAL, NORMAL, F(-1), P, Z, F(1), Y );
+    }
+}
+
+template<typename F>
+void ProjectOut( const DistMatrix<F,VC,STAR>& P, DistMatrix<F,VC,STAR>& Y )
+{
+    DEBUG_CSE
+    if( P.Width() == 0 )
+        return;
+    DistMatrix<F,STAR,STAR> Z( P.Grid() );
+    for( Int pass=0; pass<2; ++pass )
+    {
+        LocalGemm( ADJOINT, NORMAL, F(1), P, Y, Z );
+        El::AllReduce( Z, P.ColComm() );
+        LocalGemm( NORMAL, NORMAL, F(-1), P, Z, F(1), Y );
+    }
+}
+
+// Overwrite Y with the Q from its thin QR factorization, Y = Q R
+template<typename F>
+void Orthonormalize( Matrix<F>& Y, Matrix<F>& R )
+{
+    DEBUG_CSE
+    qr::Explicit( Y, R );
+}
+
+template<typename F>
+void Orthonormalize( DistMatrix<F,VC,STAR>& Y, DistMatrix<F,STAR,STAR>& R )
+{
+    DEBUG_CSE
+    // Use TSQR whenever its requirements are met
+    const Int p = mpi::Size( Y.ColComm() );
+    if( PowerOfTwo(p) && Y.Height() >= p*Y.Width() )
+        qr::ExplicitTS( Y, R );
+    else
+        qr::Explicit( Y, R );
+}
+
+// Q := [Q, Y]
+template<typename F>
+void Append( Matrix<F>& Q, const Matrix<F>& Y )
+{
+    DEBUG_CSE
+    Matrix<F> QNew;
+    HCat( Q, Y, QNew );
+    Q = QNew;
+}
+
+template<typename F>
+void Append( DistMatrix<F,VC,STAR>& Q, const DistMatrix<F,VC,STAR>& Y )
+{
+    DEBUG_CSE
+    if( Q.ColAlign() != Y.ColAlign() )
+        LogicError("Q and Y were not aligned");
+    Matrix<F> QNewLoc;
+    HCat( Q.LockedMatrix(), Y.LockedMatrix(), QNewLoc );
+    Q.Resize( Q.Height(), QNewLoc.Width() );
+    Q.Matrix() = QNewLoc;
+}
+
+// Form Q, with orthonormal columns, such that A ~= Q Q^H A, as well as
+// W = A^H Q, by applying A (and A^H) to blocks of Gaussian test vectors,
+// each followed by 'numPowerIts' orthonormalized subspace iterations. The
+// returned value is the (exact, up to rounding) squared Frobenius norm of
+// A - Q Q^H A, which, since Q has orthonormal columns, is
+// ||A||_F^2 - ||W||_F^2.
+template<typename F,class ApplyA,class ApplyAAdj>
+Base<F> RangeFinder
+( Int m, Int n,
+  const ApplyA& applyA,
+  const ApplyAAdj& applyAAdj,
+  Base<F> frobNormA,
+  Matrix<F>& Q,
+  Matrix<F>& W,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    Int blocksize, maxWidth;
+    SampleSizes( m, n, ctrl, blocksize, maxWidth );
+    const Real tolSquared = Pow( ctrl.tol*frobNormA, Real(2) );
+
+    Q.Resize( m, 0 );
+    W.Resize( n, 0 );
+    Real residSquared = frobNormA*frobNormA;
+    Matrix<F> Omega, Y, Z, R;
+    while( Q.Width() < maxWidth )
+    {
+        const Int nb = Min( blocksize, maxWidth-Q.Width() );
+        Gaussian( Omega, n, nb );
+        applyA( Omega, Y );
+        ProjectOut( Q, Y );
+        Orthonormalize( Y, R );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            applyAAdj( Y, Z );
+            Orthonormalize( Z, R );
+            applyA( Z, Y );
+            ProjectOut( Q, Y );
+            Orthonormalize( Y, R );
+        }
+        // Reorthogonalize in case the sample was (nearly) rank-deficient
+        ProjectOut( Q, Y );
+        Orthonormalize( Y, R );
+
+        applyAAdj( Y, Z );
+        residSquared -= Pow( FrobeniusNorm(Z), Real(2) );
+        Append( Q, Y );
+        Append( W, Z );
+        if( ctrl.adaptive && residSquared <= tolSquared )
+            break;
+    }
+    return Max( residSquared, Real(0) );
+}
+
+template<typename F,class ApplyA,class ApplyAAdj>
+Base<F> RangeFinder
+( Int m, Int n,
+  const ApplyA& applyA,
+  const ApplyAAdj& applyAAdj,
+  Base<F> frobNormA,
+  DistMatrix<F,VC,STAR>& Q,
+  DistMatrix<F,VC,STAR>& W,
+  const RandomizedSVDCtrl<Base<F>>& ctrl )
+{
+    DEBUG_CSE
+    typedef Base<F> Real;
+    const Grid& g = Q.Grid();
+    Int blocksize, maxWidth;
+    SampleSizes( m, n, ctrl, blocksize, maxWidth );
+    const Real tolSquared = Pow( ctrl.tol*frobNormA, Real(2) );
+
+    Q.Resize( m, 0 );
+    W.Resize( n, 0 );
+    Real residSquared = frobNormA*frobNormA;
+    DistMatrix<F,VC,STAR> Omega(g), Y(g), Z(g);
+    DistMatrix<F,STAR,STAR> R(g);
+    Y.AlignWith( Q );
+    Z.AlignWith( W );
+    while( Q.Width() < maxWidth )
+    {
+        const Int nb = Min( blocksize, maxWidth-Q.Width() );
+        Gaussian( Omega, n, nb );
+        applyA( Omega, Y );
+        ProjectOut( Q, Y );
+        Orthonormalize( Y, R );
+        for( Int it=0; it<ctrl.numPowerIts; ++it )
+        {
+            applyAAdj( Y, Z );
+            Orthonormalize( Z, R );
+            applyA( Z, Y );
+            ProjectOut( Q, Y );
+            Orthonormalize( Y, R );
+        }
+        // Reorthogonalize in case the sample was (nearly) rank-deficient
+        ProjectOut( Q, Y );
+        Orthonormalize( Y, R );
+
+        applyAAdj( Y, Z );
+        residSquared -= Pow( FrobeniusNorm(Z), Real(2) );
+        Append( Q, Y );
+        Append( W, Z );
+        if( ctrl.adaptive && residSquared <= tolSquared )
+            break;
+    }
+    return Max( residSquared, Real(0) );
+}
+
+// Given the magnitudes of the (descending) components of an approximation
+// and the squared Frobenius norm of its error, return the rank to which it
+// should be truncated, and update the error accordingly
+template<typename Real>
+Int TruncatedRank
+( const Matrix<Real>& magnitudes,
+  Real frobNormA,
+  Real& residSquared,
+  const RandomizedSVDCtrl<Real>& ctrl )
+{
+    DEBUG_CSE
+    const Int l = magnitudes.Height();
+    Int k = l;
+    if( ctrl.adaptive )
+    {
+        const Real tolSquared = Pow( ctrl.tol*frobNormA, Real(2) );
+        while( k > 0 )
+        {
+            const Real sigmaSquared = magnitudes(k-1)*magnitudes(k-1);
+            if( residSquared+sigmaSquared > tolSquared )
+                break;
+            residSquared += sigmaSquared;
+            --k;
+        }
+    }
+    else
+    {
+        k = Min( ctrl.rank, l );
+        for( Int j=k; j<l; ++j )
+            residSquared += magnitudes(j)*magnitudes(j);
+    }
+    return k;
+}
+
+} // namespace rsvd
+} // namespace El
+
+#endif // ifndef EL_RSVD_RANGEFINDER_HPP
@@ -0,0 +1,116 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+
+namespace El {
+
+namespace {
+
+bool SamePattern
+( Int numSources, Int numEdges, const Int* offsets, const Int* targets,
+  Int numSourcesNew, Int numEdgesNew,
+  const Int* offsetsNew, const Int* targetsNew )
+{
+    if( numSources != numSourcesNew || numEdges != numEdgesNew )
+        return false;
+    for( Int s=0; s<=numSources; ++s )
+        if( offsets[s] != offsetsNew[s] )
+            return false;
+    for( Int e=0; e<numEdges; ++e )
+        if( targets[e] != targetsNew[e] )
+            return false;
+    return true;
+}
+
+// NestedDissection assumes that the trees have not yet been constructed
+void ClearTree( ldl::Separator& rootSep, ldl::NodeInfo& info )
+{
+    for( auto* child : rootSep.children )
+        delete child;
+    SwapClear( rootSep.children );
+    for( auto* child : info.children )
+        delete child;
+    SwapClear( info.children );
+}
+
+void ClearTree( ldl::DistSeparator& rootSep, ldl::DistNodeInfo& info )
+{
+    delete rootSep.child;
+    delete rootSep.duplicate;
+    rootSep.child = nullptr;
+    rootSep.duplicate = nullptr;
+    if( rootSep.comm != mpi::COMM_WORLD )
+        mpi::Free( rootSep.comm );
+    rootSep.comm = mpi::COMM_WORLD;
+
+    delete info.child;
+    delete info.duplicate;
+    delete info.grid;
+    info.child = nullptr;
+    info.duplicate = nullptr;
+    info.grid = nullptr;
+    if( info.comm != mpi::COMM_WORLD )
+        mpi::Free( info.comm );
+    info.comm = mpi::COMM_WORLD;
+}
+
+} // anonymous namespace
+
+bool KKTAnalysis::Analyze( const Graph& kktGraph, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    const Int numSources = kktGraph.NumSources();
+    if( numSources > 0 &&
+        SamePattern
+        ( graph.NumSources(), graph.NumEdges(),
+          graph.LockedOffsetBuffer(), graph.LockedTargetBuffer(),
+          numSources, kktGraph.NumEdges(),
+          kktGraph.LockedOffsetBuffer(), kktGraph.LockedTargetBuffer() ) )
+        return false;
+
+    graph = kktGraph;
+    ClearTree( rootSep, info );
+    ldl::NestedDissection( graph, map, rootSep, info, ctrl );
+    InvertMap( map, invMap );
+    return true;
+}
+
+bool DistKKTAnalysis::Analyze
+( const DistGraph& kktGraph, const BisectCtrl& ctrl )
+{
+    DEBUG_CSE
+    mpi::Comm comm = kktGraph.Comm();
+    const Int numSources = kktGraph.NumSources();
+    bool samePattern = numSources > 0 &&
+      mpi::Congruent( graph.Comm(), comm ) &&
+      graph.NumSources() == numSources;
+    if( samePattern )
+        samePattern =
+          SamePattern
+          ( graph.NumLocalSources(), graph.NumLocalEdges(),
+            graph.LockedOffsetBuffer(), graph.LockedTargetBuffer(),
+            kktGraph.NumLocalSources(), kktGraph.NumLocalEdges(),
+            kktGraph.LockedOffsetBuffer(), kktGraph.LockedTargetBuffer() );
+    samePattern =
+      mpi::AllReduce( Int(samePattern), mpi::MIN, comm ) == Int(1);
+    if( samePattern )
+        return false;
+
+    graph = kktGraph;
+    ClearTree( rootSep, info );
+    ldl::NestedDissection( graph, map, rootSep, info, ctrl );
+    InvertMap( map, invMap );
+    SwapClear( mappedSources );
+    SwapClear( mappedTargets );
+    SwapClear( colOffs );
+    dmvMeta = ldl::DistMultiVecNodeMeta();
+    return true;
+}
+
+} // namespace El
@@ -1037,13 +1037,18 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    KKTAnalysis localAnalysis;
+    KKTAnalysis& analysis =
+      ( ctrl.kktAnalysis == nullptr ? localAnalysis : *ctrl.kktAnalysis );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
-    // augmented formulation
-    if( ctrl.system == AUGMENTED_KKT )
+    // augmented formulation (and a persistent analysis is only updated by
+    // the main iterations)
+    if( ctrl.system == AUGMENTED_KKT && ctrl.kktAnalysis == nullptr )
     {
         Initialize
         ( A, b, c, x, y, z, map, invMap, rootSep, info,
@@ -1223,8 +1228,7 @@ void Mehrotra
 
                 if( numIts == 0 )
                 {
-                    NestedDissection( J.LockedGraph(), map, rootSep, info );
-                    InvertMap( map, invMap );
+                    analysis.Analyze( J.LockedGraph() );
                 }
                 JFront.Pull( J, map, info );
 
@@ -1267,8 +1271,7 @@ void Mehrotra
             {
                 if( numIts == 0 )
                 {
-                    NestedDissection( J.LockedGraph(), map, rootSep, info );
-                    InvertMap( map, invMap );
+                    analysis.Analyze( J.LockedGraph() );
                 }
                 JFront.Pull( J, map, info );
 
@@ -1604,16 +1607,25 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    vector<Int> mappedSources, mappedTargets, colOffs;
+    DistKKTAnalysis localAnalysis;
+    DistKKTAnalysis& analysis =
+      ( ctrl.distKKTAnalysis == nullptr ? localAnalysis
+                                        : *ctrl.distKKTAnalysis );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
+    auto& mappedSources = analysis.mappedSources;
+    auto& mappedTargets = analysis.mappedTargets;
+    auto& colOffs = analysis.colOffs;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
-    // augmented formulation
+    // augmented formulation (and a persistent analysis is only updated by
+    // the main iterations)
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT &&
+        ctrl.distKKTAnalysis == nullptr )
     {
         Initialize
         ( A, b, c, x, y, z, map, invMap, rootSep, info, 
@@ -1666,6 +1678,13 @@ void Mehrotra
     DistGraphMultMeta metaOrig, meta;
     DistSparseMatrix<Real> J(comm), JOrig(comm);
     ldl::DistFront<Real> JFront;
+
+    // The normal equations are formed with a sparse-sparse multiply whose
+    // symbolic phase is only performed in the first iteration
+    DistSparseMatrix<Real> AT(comm);
+    DistSparseMultiplyPlan JPlan;
+    if( ctrl.system == NORMAL_KKT )
+        Transpose( A, AT );
     DistMultiVec<Real> d(comm), 
                        w(comm),
                        rc(comm),    rb(comm),    rmu(comm), 
@@ -1676,7 +1695,7 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
-    ldl::DistMultiVecNodeMeta dmvMeta;
+    auto& dmvMeta = analysis.dmvMeta;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1799,10 +1818,9 @@ void Mehrotra
                     meta = J.InitializeMultMeta();
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
-                    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
+                    analysis.Analyze( J.LockedDistGraph() );
                     if( commRank == 0 && ctrl.time )
                         Output("ND: ",timer.Stop()," secs");
-                    InvertMap( map, invMap );
                 }
                 else
                     J.LockedDistGraph().multMeta = meta;
@@ -1869,8 +1887,7 @@ void Mehrotra
         {
             // Assemble the KKT system
             // -----------------------
-            // TODO: Apply updates on top of explicit zeros
-            NormalKKT( A, gammaPerm, deltaPerm, x, z, J, false );
+            NormalKKT( A, AT, JPlan, gammaPerm, deltaPerm, x, z, J, false );
             NormalKKTRHS( A, gammaPerm, x, z, rc, rb, rmu, dyAff );
 
             // Solve for the direction
@@ -1890,10 +1907,9 @@ void Mehrotra
                     meta = J.InitializeMultMeta();
                     if( commRank == 0 && ctrl.time )
                         timer.Start();
-                    NestedDissection( J.LockedDistGraph(), map, rootSep, info );
+                    analysis.Analyze( J.LockedDistGraph() );
                     if( commRank == 0 && ctrl.time )
                         Output("ND: ",timer.Stop()," secs");
-                    InvertMap( map, invMap );
                 }
                 else
                     J.LockedDistGraph().multMeta = meta;
@@ -181,6 +181,19 @@ void NormalKKT
   const DistMultiVec<Real>& z,
         DistSparseMatrix<Real>& J,
   bool onlyLower=true );
+// Reuse the transpose of A and the plan for forming A D^2 A^T, which is
+// initialized during the first call
+template<typename Real>
+void NormalKKT
+( const DistSparseMatrix<Real>& A,
+  const DistSparseMatrix<Real>& AT,
+        DistSparseMultiplyPlan& plan,
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z,
+        DistSparseMatrix<Real>& J,
+  bool onlyLower=true );
 
 template<typename Real>
 void NormalKKTRHS
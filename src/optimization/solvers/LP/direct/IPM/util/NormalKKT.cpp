@@ -187,6 +187,8 @@ void NormalKKT
 template<typename Real>
 void NormalKKT
 ( const DistSparseMatrix<Real>& A, 
+  const DistSparseMatrix<Real>& AT,
+        DistSparseMultiplyPlan& plan,
         Real gamma,
         Real delta,
   const DistMultiVec<Real>& x,
@@ -195,7 +197,6 @@ void NormalKKT
   bool onlyLower )
 {
     DEBUG_CSE
-    const Int m = A.Height();
     const Int n = A.Width();
     mpi::Comm comm = A.Comm();
     if( !mpi::Congruent( comm, x.Comm() ) )
@@ -209,24 +210,31 @@ void NormalKKT
     auto& xLoc = x.LockedMatrix();
     auto& zLoc = z.LockedMatrix();
 
-    // dInv := sqrt( (z ./ x) .+ gamma^2 )
-    // ===================================
-    DistMultiVec<Real> dInv(comm);
-    dInv.Resize( n, 1 );
-    auto& dInvLoc = dInv.Matrix();
-    const Int dInvLocalHeight = dInv.LocalHeight();
+    // dInvSquared := (z ./ x) .+ gamma^2
+    // ==================================
+    DistMultiVec<Real> dInvSquared(comm);
+    dInvSquared.Resize( n, 1 );
+    auto& dInvSquaredLoc = dInvSquared.Matrix();
+    const Int dInvLocalHeight = dInvSquared.LocalHeight();
     for( Int iLoc=0; iLoc<dInvLocalHeight; ++iLoc )
-        dInvLoc(iLoc) = Sqrt(zLoc(iLoc)/xLoc(iLoc) + gamma*gamma);
+        dInvSquaredLoc(iLoc) = zLoc(iLoc)/xLoc(iLoc) + gamma*gamma;
 
     // Form A D^2 A^T + delta^2 I
     // ==========================
-    DistSparseMatrix<Real> G(comm);
-    // TODO: Avoid forming this within an inner loop...
-    Transpose( A, G );
-    DiagonalSolve( LEFT, NORMAL, dInv, G );
-    Zeros( J, m, m );
-    ShiftDiagonal( J, delta*delta );
-    Syrk( LOWER, TRANSPOSE, Real(1), G, Real(1), J );
+    // The sparsity pattern of A D^2 A^T is fixed, so only the numeric phase
+    // of the product is performed once the plan has been formed. The plan
+    // includes the structural diagonal (which is missing for the empty rows
+    // of A) and, if requested, only the lower triangle, so that J keeps the
+    // pattern of the plan.
+    DistSparseMatrix<Real> G(AT);
+    DiagonalSolve( LEFT, NORMAL, dInvSquared, G );
+    if( !plan.ready )
+        MultiplySymbolic
+        ( A.LockedDistGraph(), G.LockedDistGraph(), plan, true, onlyLower );
+    else if( plan.onlyLower != onlyLower || !plan.diagonal )
+        LogicError("The plan for J was formed with different options");
+    MultiplyNumeric( A, G, plan, J );
+    ShiftDiagonal( J, delta*delta, 0, true );
 
     // Inflate the diagonal in a small relative sense
     // ==============================================
@@ -240,9 +248,23 @@ void NormalKKT
         const Real diagAbs = Abs(valBuf[e]);
         valBuf[e] = (1+inflateRatio)*diagAbs;
     }
+}
 
-    if( !onlyLower )
-        MakeSymmetric( LOWER, J );
+template<typename Real>
+void NormalKKT
+( const DistSparseMatrix<Real>& A, 
+        Real gamma,
+        Real delta,
+  const DistMultiVec<Real>& x,
+  const DistMultiVec<Real>& z, 
+        DistSparseMatrix<Real>& J, 
+  bool onlyLower )
+{
+    DEBUG_CSE
+    DistSparseMatrix<Real> AT(A.Comm());
+    Transpose( A, AT );
+    DistSparseMultiplyPlan plan;
+    NormalKKT( A, AT, plan, gamma, delta, x, z, J, onlyLower );
 }
 
 template<typename Real>
@@ -634,6 +656,15 @@ void ExpandNormalSolution
     const DistMultiVec<Real>& x, \
     const DistMultiVec<Real>& z, \
           DistSparseMatrix<Real>& J, bool onlyLower ); \
+  template void NormalKKT \
+  ( const DistSparseMatrix<Real>& A, \
+    const DistSparseMatrix<Real>& AT, \
+          DistSparseMultiplyPlan& plan, \
+          Real gamma, \
+          Real delta, \
+    const DistMultiVec<Real>& x, \
+    const DistMultiVec<Real>& z, \
+          DistSparseMatrix<Real>& J, bool onlyLower ); \
   template void NormalKKTRHS \
   ( const Matrix<Real>& A, \
           Real gamma, \
@@ -827,11 +827,14 @@ void Mehrotra
     SparseMatrix<Real> JStatic;
     StaticKKT
     ( Q, A, G, ctrl.reg0Perm, ctrl.reg1Perm, ctrl.reg2Perm, JStatic, false );
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
-    NestedDissection( JStatic.LockedGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
+    KKTAnalysis localAnalysis;
+    KKTAnalysis& analysis =
+      ( ctrl.kktAnalysis == nullptr ? localAnalysis : *ctrl.kktAnalysis );
+    analysis.Analyze( JStatic.LockedGraph() );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
 
     Initialize
     ( JStatic, regTmp, b, c, h, x, y, z, s, map, invMap, rootSep, info, 
@@ -1243,19 +1246,27 @@ void Mehrotra
             Output("Imbalance factor of J: ",imbalanceJ);
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
+    DistKKTAnalysis localAnalysis;
+    DistKKTAnalysis& analysis =
+      ( ctrl.distKKTAnalysis == nullptr ? localAnalysis
+                                        : *ctrl.distKKTAnalysis );
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
+    if( analysis.Analyze( JStatic.LockedDistGraph() ) )
+    {
+        JStatic.MappedSources( analysis.map, analysis.mappedSources );
+        JStatic.MappedTargets
+        ( analysis.map, analysis.mappedTargets, analysis.colOffs );
+    }
     if( commRank == 0 && ctrl.time )
         Output("ND: ",timer.Stop()," secs");
-    InvertMap( map, invMap );
-
-    vector<Int> mappedSources, mappedTargets, colOffs;
-    JStatic.MappedSources( map, mappedSources );
-    JStatic.MappedTargets( map, mappedTargets, colOffs );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
+    auto& mappedSources = analysis.mappedSources;
+    auto& mappedTargets = analysis.mappedTargets;
+    auto& colOffs = analysis.colOffs;
 
     if( commRank == 0 && ctrl.time )
         timer.Start();
@@ -1277,7 +1288,7 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm);
-    ldl::DistMultiVecNodeMeta dmvMeta;
+    auto& dmvMeta = analysis.dmvMeta;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -833,14 +833,19 @@ void Mehrotra
         Output("|| c ||_2 = ",cNrm2);
     }
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
+    KKTAnalysis localAnalysis;
+    KKTAnalysis& analysis =
+      ( ctrl.kktAnalysis == nullptr ? localAnalysis : *ctrl.kktAnalysis );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
-    // augmented formulation
+    // augmented formulation (and a persistent analysis is only updated by
+    // the main iterations)
     // TODO: Add permanent regularization and cache J metadata
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT && ctrl.kktAnalysis == nullptr )
     {
         Initialize
         ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
@@ -1009,8 +1014,7 @@ void Mehrotra
                     (ctrl.system == FULL_KKT || 
                      (ctrl.primalInit && ctrl.dualInit) ) )
                 {
-                    NestedDissection( J.LockedGraph(), map, rootSep, info );
-                    InvertMap( map, invMap );
+                    analysis.Analyze( J.LockedGraph() );
                 }
                 JFront.Pull( J, map, info );
 
@@ -1286,17 +1290,26 @@ void Mehrotra
         }
     }
 
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    vector<Int> mappedSources, mappedTargets, colOffs;
+    DistKKTAnalysis localAnalysis;
+    DistKKTAnalysis& analysis =
+      ( ctrl.distKKTAnalysis == nullptr ? localAnalysis
+                                        : *ctrl.distKKTAnalysis );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
+    auto& mappedSources = analysis.mappedSources;
+    auto& mappedTargets = analysis.mappedTargets;
+    auto& colOffs = analysis.colOffs;
     // The initialization involves an augmented KKT system, and so we can
     // only reuse the factorization metadata if the this IPM is using the
-    // augmented formulation
+    // augmented formulation (and a persistent analysis is only updated by
+    // the main iterations)
     // TODO: Add permanent regularization and cache J metadata
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    if( ctrl.system == AUGMENTED_KKT )
+    if( ctrl.system == AUGMENTED_KKT &&
+        ctrl.distKKTAnalysis == nullptr )
     {
         Initialize
         ( Q, A, b, c, x, y, z, map, invMap, rootSep, info,
@@ -1356,7 +1369,7 @@ void Mehrotra
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), dzError(comm), prod(comm);
-    ldl::DistMultiVecNodeMeta dmvMeta;
+    auto& dmvMeta = analysis.dmvMeta;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -1484,11 +1497,9 @@ void Mehrotra
                     {
                         if( commRank == 0 && ctrl.time )
                             timer.Start();
-                        NestedDissection
-                        ( J.LockedDistGraph(), map, rootSep, info );
+                        analysis.Analyze( J.LockedDistGraph() );
                         if( commRank == 0 && ctrl.time )
                             Output("ND: ",timer.Stop()," secs");
-                        InvertMap( map, invMap );
                     }
                 }
                 else
@@ -910,11 +910,13 @@ void Mehrotra
       orders, firstInds, origToSparseOrders, origToSparseFirstInds, 
       kSparse, JStatic, onlyLower );
 
-    vector<Int> map, invMap;
-    ldl::NodeInfo info;
-    ldl::Separator rootSep;
-    NestedDissection( JStatic.LockedGraph(), map, rootSep, info );
-    InvertMap( map, invMap );
+    KKTAnalysis localAnalysis;
+    KKTAnalysis& analysis =
+      ( ctrl.kktAnalysis == nullptr ? localAnalysis : *ctrl.kktAnalysis );
+    analysis.Analyze( JStatic.LockedGraph() );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
  
     Real relError = 1;
     Matrix<Real> dInner;
@@ -1407,23 +1409,33 @@ void Mehrotra
     auto meta = JStatic.InitializeMultMeta();
     if( commRank == 0 && ctrl.time )
         timer.Start();
-    DistMap map, invMap;
-    ldl::DistNodeInfo info;
-    ldl::DistSeparator rootSep;
-    NestedDissection( JStatic.LockedDistGraph(), map, rootSep, info );
+    DistKKTAnalysis localAnalysis;
+    DistKKTAnalysis& analysis =
+      ( ctrl.distKKTAnalysis == nullptr ? localAnalysis
+                                        : *ctrl.distKKTAnalysis );
+    if( commRank == 0 && ctrl.time )
+        timer.Start();
+    if( analysis.Analyze( JStatic.LockedDistGraph() ) )
+    {
+        JStatic.MappedSources( analysis.map, analysis.mappedSources );
+        JStatic.MappedTargets
+        ( analysis.map, analysis.mappedTargets, analysis.colOffs );
+    }
     if( commRank == 0 && ctrl.time )
         Output("ND: ",timer.Stop()," secs");
-    InvertMap( map, invMap );
-
-    vector<Int> mappedSources, mappedTargets, colOffs;
-    JStatic.MappedSources( map, mappedSources );
-    JStatic.MappedTargets( map, mappedTargets, colOffs );
+    auto& map = analysis.map;
+    auto& invMap = analysis.invMap;
+    auto& info = analysis.info;
+    auto& rootSep = analysis.rootSep;
+    auto& mappedSources = analysis.mappedSources;
+    auto& mappedTargets = analysis.mappedTargets;
+    auto& colOffs = analysis.colOffs;
 
     Real relError = 1;
     DistMultiVec<Real> dInner(comm);
     DistMultiVec<Real> dxError(comm), dyError(comm), 
                        dzError(comm), dmuError(comm);
-    ldl::DistMultiVecNodeMeta dmvMeta;
+    auto& dmvMeta = analysis.dmvMeta;
     const Int indent = PushIndent();
     for( Int numIts=0; numIts<=ctrl.maxIts; ++numIts )
     {
@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The BigInt and BigFloat overloads of Dot, Axpy, Gemv, Trsv, and Gemm are
+// checked against the generic templates (selected by explicitly passing the
+// template argument). BigInt arithmetic is exact, so the two should agree
+// exactly, while the fused BigFloat updates round once rather than twice.
+// The BigFloat kernels are also checked against operands with a higher
+// precision than the default.
+
+#ifdef EL_HAVE_MPC
+BigInt Tolerance( const BigInt&, Int ) { return BigInt(0); }
+BigFloat Tolerance( const BigFloat& scale, Int depth )
+{ return BigFloat(10*(depth+1))*limits::Epsilon<BigFloat>()*scale; }
+
+template<typename T>
+void CheckAgreement
+( const string& name, const Matrix<T>& X, const Matrix<T>& XGeneric,
+  const T& scale, Int depth )
+{
+    T error = 0;
+    for( Int j=0; j<X.Width(); ++j )
+        for( Int i=0; i<X.Height(); ++i )
+            error = Max( error, Abs(X(i,j)-XGeneric(i,j)) );
+    if( error > Tolerance(scale,depth) )
+        LogicError(name," differed from the generic kernel by ",error);
+}
+
+template<typename T>
+void TestBig( Int m, Int n, Int k )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    // Every entry lies in [-radius,radius]
+    const T radius( 10 );
+    const T alpha( 3 ), beta( -2 );
+    const T scale = radius*radius*(Abs(alpha)+Abs(beta));
+
+    Matrix<T> x, y;
+    Uniform( x, k, 1, T(0), radius );
+    Uniform( y, k, 1, T(0), radius );
+
+    // Dot
+    Matrix<T> dot, dotGeneric;
+    Zeros( dot, 1, 1 );
+    Zeros( dotGeneric, 1, 1 );
+    dot(0,0) = blas::Dot( k, x.LockedBuffer(), 1, y.LockedBuffer(), 1 );
+    dotGeneric(0,0) =
+      blas::Dot<T>( k, x.LockedBuffer(), 1, y.LockedBuffer(), 1 );
+    CheckAgreement( "Dot", dot, dotGeneric, scale, k );
+
+    // Axpy
+    auto z( y ), zGeneric( y );
+    blas::Axpy( k, alpha, x.LockedBuffer(), 1, z.Buffer(), 1 );
+    blas::Axpy<T>( k, alpha, x.LockedBuffer(), 1, zGeneric.Buffer(), 1 );
+    CheckAgreement( "Axpy", z, zGeneric, scale, 1 );
+
+    // Gemv
+    const char transes[] = { 'N', 'T' };
+    for( char trans : transes )
+    {
+        Matrix<T> A, u, v;
+        Uniform( A, m, n, T(0), radius );
+        Uniform( u, trans=='N' ? n : m, 1, T(0), radius );
+        Uniform( v, trans=='N' ? m : n, 1, T(0), radius );
+        auto vGeneric( v );
+        blas::Gemv
+        ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(),
+          u.LockedBuffer(), 1, beta, v.Buffer(), 1 );
+        blas::Gemv<T>
+        ( trans, m, n, alpha, A.LockedBuffer(), A.LDim(),
+          u.LockedBuffer(), 1, beta, vGeneric.Buffer(), 1 );
+        CheckAgreement
+        ( string("Gemv(")+trans+")", v, vGeneric, scale, Max(m,n) );
+    }
+
+    // Gemm
+    for( char transA : transes )
+    {
+        for( char transB : transes )
+        {
+            Matrix<T> A, B, C;
+            if( transA == 'N' )
+                Uniform( A, m, k, T(0), radius );
+            else
+                Uniform( A, k, m, T(0), radius );
+            if( transB == 'N' )
+                Uniform( B, k, n, T(0), radius );
+            else
+                Uniform( B, n, k, T(0), radius );
+            Uniform( C, m, n, T(0), radius );
+            auto CGeneric( C );
+            blas::Gemm
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+              beta, C.Buffer(), C.LDim() );
+            blas::Gemm<T>
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+              beta, CGeneric.Buffer(), CGeneric.LDim() );
+            CheckAgreement
+            ( string("Gemm(")+transA+","+transB+")", C, CGeneric, scale, k );
+        }
+    }
+    PopIndent();
+}
+
+// A well-conditioned triangular matrix
+void MakeTriangle( Matrix<BigFloat>& A, Int m )
+{
+    Uniform( A, m, m );
+    A *= BigFloat(1)/BigFloat(m);
+    ShiftDiagonal( A, BigFloat(1) );
+}
+
+void TestTrsv( Int m )
+{
+    Output("Testing Trsv");
+    PushIndent();
+    const char uplos[] = { 'L', 'U' };
+    const char transes[] = { 'N', 'T' };
+    const char units[] = { 'N', 'U' };
+    Matrix<BigFloat> A;
+    MakeTriangle( A, m );
+    for( char uplo : uplos )
+    {
+        for( char trans : transes )
+        {
+            for( char unit : units )
+            {
+                Matrix<BigFloat> x;
+                Uniform( x, m, 1 );
+                auto xGeneric( x );
+                blas::Trsv
+                ( uplo, trans, unit, m, A.LockedBuffer(), A.LDim(),
+                  x.Buffer(), 1 );
+                blas::Trsv<BigFloat>
+                ( uplo, trans, unit, m, A.LockedBuffer(), A.LDim(),
+                  xGeneric.Buffer(), 1 );
+                CheckAgreement
+                ( string("Trsv(")+uplo+","+trans+","+unit+")",
+                  x, xGeneric, FrobeniusNorm(xGeneric), m );
+            }
+        }
+    }
+
+    PopIndent();
+}
+
+// The kernels should keep the precision of their operands even when the
+// default precision is lower. Since each entry is created at the default
+// precision in place at the time (and copies are rounded to the default),
+// everything except the kernels themselves runs at the higher precision.
+void TestHighPrecision( Int m, Int n, Int k )
+{
+    Output("Testing operands at twice the default precision");
+    PushIndent();
+    const mpfr_prec_t prec = mpfr::Precision();
+    mpfr::SetPrecision( 2*prec );
+    const BigFloat alpha( 3 ), beta( -2 );
+    const BigFloat scale = Abs(alpha) + Abs(beta);
+
+    // Form the results with the default precision matching the operands
+    Matrix<BigFloat> A, x, y, yRef, B, C, CRef, T, z, b;
+    Uniform( A, m, n );
+    Uniform( x, n, 1 );
+    Uniform( y, m, 1 );
+    yRef = y;
+    blas::Gemv
+    ( 'N', m, n, alpha, A.LockedBuffer(), A.LDim(),
+      x.LockedBuffer(), 1, beta, yRef.Buffer(), 1 );
+    Uniform( B, n, k );
+    Uniform( C, m, k );
+    CRef = C;
+    blas::Gemm
+    ( 'N', 'N', m, k, n,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, CRef.Buffer(), CRef.LDim() );
+    MakeTriangle( T, m );
+    MakeTrapezoidal( LOWER, T );
+    Uniform( z, m, 1 );
+    Zeros( b, m, 1 );
+    blas::Gemv
+    ( 'N', m, m, BigFloat(1), T.LockedBuffer(), T.LDim(),
+      z.LockedBuffer(), 1, BigFloat(0), b.Buffer(), 1 );
+
+    mpfr::SetPrecision( prec );
+    blas::Gemv
+    ( 'N', m, n, alpha, A.LockedBuffer(), A.LDim(),
+      x.LockedBuffer(), 1, beta, y.Buffer(), 1 );
+    blas::Gemm
+    ( 'N', 'N', m, k, n,
+      alpha, A.LockedBuffer(), A.LDim(), B.LockedBuffer(), B.LDim(),
+      beta, C.Buffer(), C.LDim() );
+    blas::Trsv( 'L', 'N', 'N', m, T.LockedBuffer(), T.LDim(), b.Buffer(), 1 );
+
+    mpfr::SetPrecision( 2*prec );
+    CheckAgreement( "High-precision Gemv", y, yRef, scale, n );
+    CheckAgreement( "High-precision Gemm", C, CRef, scale, n );
+    CheckAgreement( "High-precision Trsv", b, z, FrobeniusNorm(z), m );
+    mpfr::SetPrecision( prec );
+    PopIndent();
+}
+#endif
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+
+    try
+    {
+        const Int m = Input("--m","height of matrix",37);
+        const Int n = Input("--n","width of matrix",29);
+        const Int k = Input("--k","inner dimension",41);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_MPC
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestBig<BigInt>( m, n, k );
+            TestBig<BigFloat>( m, n, k );
+            TestTrsv( m );
+            TestHighPrecision( m, n, k );
+        }
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
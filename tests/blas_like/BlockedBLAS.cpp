@@ -0,0 +1,240 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// The extended-precision types route blas::Gemm, blas::Trsm, and blas::Herk
+// through cache-blocked kernels, which are checked here against naive loops
+// for dimensions which leave partial register blocks (of size 4 x 4) and
+// partial panels, and for triangular dimensions above the 64 x 64 blocksize
+// at which Trsm and Herk switch to their blocked algorithms.
+
+template<typename T>
+T OpEntry( char trans, const Matrix<T>& A, Int i, Int j )
+{
+    if( trans == 'N' )
+        return A(i,j);
+    else if( trans == 'T' )
+        return A(j,i);
+    else
+        return Conj(A(j,i));
+}
+
+// C := alpha op(A) op(B) + beta C
+template<typename T>
+void NaiveGemm
+( char transA, char transB,
+  T alpha, const Matrix<T>& A, const Matrix<T>& B, T beta, Matrix<T>& C )
+{
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int k = ( transA == 'N' ? A.Width() : A.Height() );
+    for( Int j=0; j<n; ++j )
+    {
+        for( Int i=0; i<m; ++i )
+        {
+            T gamma = 0;
+            for( Int l=0; l<k; ++l )
+                gamma += OpEntry(transA,A,i,l)*OpEntry(transB,B,l,j);
+            C(i,j) = alpha*gamma + beta*C(i,j);
+        }
+    }
+}
+
+template<typename T>
+void CheckError
+( const string& name, const Matrix<T>& X, const Matrix<T>& XRef,
+  Base<T> scale, Int depth )
+{
+    typedef Base<T> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<T> E( X );
+    E -= XRef;
+    const Real error = FrobeniusNorm( E );
+    if( error > Real(10*(depth+1))*eps*scale )
+        LogicError
+        (name," differed from the naive result by ",error,
+         " relative to a scale of ",scale);
+}
+
+template<typename T>
+void TestGemm( Int m, Int n, Int k )
+{
+    Output("Gemm with m=",m,", n=",n,", k=",k);
+    const char transes[] = { 'N', 'T', 'C' };
+    const T alpha( 3 ), beta( -2 );
+    for( char transA : transes )
+    {
+        for( char transB : transes )
+        {
+            Matrix<T> A, B, C;
+            if( transA == 'N' )
+                Uniform( A, m, k );
+            else
+                Uniform( A, k, m );
+            if( transB == 'N' )
+                Uniform( B, k, n );
+            else
+                Uniform( B, n, k );
+            Uniform( C, m, n );
+            auto CRef( C );
+
+            blas::Gemm
+            ( transA, transB, m, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+                     B.LockedBuffer(), B.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            NaiveGemm( transA, transB, alpha, A, B, beta, CRef );
+
+            const Base<T> scale =
+              Abs(alpha)*FrobeniusNorm(A)*FrobeniusNorm(B) +
+              Abs(beta)*FrobeniusNorm(CRef);
+            CheckError
+            ( string("Gemm(")+transA+","+transB+")", C, CRef, scale, k );
+        }
+    }
+}
+
+template<typename F>
+void TestTrsm( Int triDim, Int otherDim )
+{
+    Output("Trsm with triangular dimension ",triDim," and other dimension ",
+           otherDim);
+    const char sides[] = { 'L', 'R' };
+    const char uplos[] = { 'L', 'U' };
+    const char transes[] = { 'N', 'T', 'C' };
+    const char units[] = { 'N', 'U' };
+    const F alpha( 2 );
+    for( char side : sides )
+    {
+        const Int m = ( side == 'L' ? triDim : otherDim );
+        const Int n = ( side == 'L' ? otherDim : triDim );
+        for( char uplo : uplos )
+        {
+            // A well-conditioned triangle, with or without its unit diagonal
+            Matrix<F> A;
+            Uniform( A, triDim, triDim );
+            A *= F(1)/F(triDim);
+            ShiftDiagonal( A, F(1) );
+            Matrix<F> S( A );
+            MakeTrapezoidal( uplo=='L' ? LOWER : UPPER, S );
+            for( char trans : transes )
+            {
+                for( char unit : units )
+                {
+                    Matrix<F> SDiag( S );
+                    if( unit == 'U' )
+                        FillDiagonal( SDiag, F(1) );
+
+                    // B := op(S) X / alpha or X op(S) / alpha
+                    Matrix<F> X, B;
+                    Uniform( X, m, n );
+                    Zeros( B, m, n );
+                    if( side == 'L' )
+                        NaiveGemm( trans, 'N', F(1)/alpha, SDiag, X, F(0), B );
+                    else
+                        NaiveGemm( 'N', trans, F(1)/alpha, X, SDiag, F(0), B );
+
+                    blas::Trsm
+                    ( side, uplo, trans, unit, m, n,
+                      alpha, A.LockedBuffer(), A.LDim(),
+                             B.Buffer(),       B.LDim() );
+                    CheckError
+                    ( string("Trsm(")+side+","+uplo+","+trans+","+unit+")",
+                      B, X, FrobeniusNorm(X), triDim );
+                }
+            }
+        }
+    }
+}
+
+template<typename T>
+void TestHerk( Int n, Int k )
+{
+    typedef Base<T> Real;
+    Output("Herk with n=",n,", k=",k);
+    const char uplos[] = { 'L', 'U' };
+    const char transes[] = { 'N', 'C' };
+    const Real alpha( 3 ), beta( -2 );
+    for( char uplo : uplos )
+    {
+        for( char trans : transes )
+        {
+            Matrix<T> A, C;
+            if( trans == 'N' )
+                Uniform( A, n, k );
+            else
+                Uniform( A, k, n );
+            Uniform( C, n, n );
+            auto CRef( C );
+
+            blas::Herk
+            ( uplo, trans, n, k,
+              alpha, A.LockedBuffer(), A.LDim(),
+              beta,  C.Buffer(),       C.LDim() );
+            // The opposite triangle should have been left untouched
+            const char transAdj = ( trans == 'N' ? 'C' : 'N' );
+            Matrix<T> CFull( CRef );
+            NaiveGemm( trans, transAdj, T(alpha), A, A, T(beta), CFull );
+            MakeTrapezoidal( uplo=='L' ? LOWER : UPPER, CFull );
+            MakeTrapezoidal( uplo=='L' ? UPPER : LOWER, CRef, uplo=='L'?1:-1 );
+            CRef += CFull;
+
+            const Real scale =
+              Abs(alpha)*FrobeniusNorm(A)*FrobeniusNorm(A) +
+              Abs(beta)*FrobeniusNorm(CRef);
+            CheckError
+            ( string("Herk(")+uplo+","+trans+")", C, CRef, scale, k );
+        }
+    }
+}
+
+template<typename T>
+void TestBlocked()
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    // Below the cutoff for packing, just above it, and spanning several
+    // panels of every dimension
+    TestGemm<T>( 3, 5, 7 );
+    TestGemm<T>( 17, 18, 19 );
+    TestGemm<T>( 70, 45, 301 );
+    TestTrsm<T>( 101, 37 );
+    TestHerk<T>( 101, 37 );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+#ifdef EL_HAVE_QD
+            TestBlocked<DoubleDouble>();
+            TestBlocked<Complex<DoubleDouble>>();
+            TestBlocked<QuadDouble>();
+#endif
+#ifdef EL_HAVE_QUAD
+            TestBlocked<Quad>();
+            TestBlocked<Complex<Quad>>();
+#endif
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
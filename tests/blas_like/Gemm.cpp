@@ -141,6 +141,91 @@ void TestGemm
     if( correctness )
         TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
     PopIndent();
+
+    // Test the pipelined variant of Gemm that keeps C stationary
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Pipelined stationary C Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_C_PIPELINED );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Test the 2.5D variant of Gemm
+    C = COrig;
+    OutputFromRoot(g.Comm(),"2.5D Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_25D );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
+
+    // Test the 2.5D variant of Gemm with an explicit number of layers, which
+    // the automatic choice would only select on much larger grids
+    for( Int numLayers=2; numLayers<=4; numLayers*=2 )
+    {
+        if( g.Size() % numLayers != 0 )
+            continue;
+        C = COrig;
+        OutputFromRoot(g.Comm(),"2.5D Algorithm with ",numLayers," layers:");
+        PushIndent();
+        SetGemm25DNumLayers( numLayers );
+        mpi::Barrier( g.Comm() );
+        timer.Start();
+        Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_SUMMA_25D );
+        mpi::Barrier( g.Comm() );
+        runTime = timer.Stop();
+        SetGemm25DNumLayers( 0 );
+        realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+        gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+        OutputFromRoot
+        (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+        if( print )
+            Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+        if( correctness )
+            TestAssociativity
+            ( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+        PopIndent();
+    }
+    
+    // Test Cannon's algorithm
+    C = COrig;
+    OutputFromRoot(g.Comm(),"Cannon's Algorithm:");
+    PushIndent();
+    mpi::Barrier( g.Comm() );
+    timer.Start();
+    Gemm( orientA, orientB, alpha, A, B, beta, C, GEMM_CANNON );
+    mpi::Barrier( g.Comm() );
+    runTime = timer.Stop();
+    realGFlops = 2.*double(m)*double(n)*double(k)/(1.e9*runTime);
+    gFlops = ( IsComplex<T>::value ? 4*realGFlops : realGFlops );
+    OutputFromRoot
+    (g.Comm(),"Finished in ",runTime," seconds (",gFlops," GFlop/s)");
+    if( print )
+        Print( C, BuildString("C := ",alpha," A B + ",beta," C") );
+    if( correctness )
+        TestAssociativity( orientA, orientB, alpha, A, B, beta, COrig, C, print );
+    PopIndent();
     
     if( orientA == NORMAL && orientB == NORMAL )
     {
@@ -45,6 +45,425 @@ void TestMultiply(Int m, Int n=1)
         Output("Test passed");
 }
 
+// A deterministic value, so that every process can form the same matrices
+template<typename T>
+T Value( Int i, Int j )
+{
+    T value = T( 1 + (3*i+5*j)%7 );
+    if( IsComplex<T>::value )
+        SetImagPart( value, Base<T>((i+2*j)%5) );
+    return value;
+}
+
+template<typename T>
+void TestDistMultiply( Int m, Int n=3 )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    OutputFromRoot(comm,"Testing distributed multiply with ",TypeName<T>());
+
+    // Build a rectangular matrix whose rows reference entries owned by
+    // other processes (as well as, for some rows, only local entries) and
+    // a sequential copy of it on every process
+    const Int width = m + 3;
+    DistSparseMatrix<T> A(m,width,comm);
+    SparseMatrix<T> ASeq(m,width);
+    A.Reserve( 4*A.LocalHeight() );
+    ASeq.Reserve( 4*m );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int iLoc = i - A.FirstLocalRow();
+        const bool local = ( iLoc >= 0 && iLoc < A.LocalHeight() );
+        for( Int t=0; t<i%4+1; ++t )
+        {
+            const Int j = ( i%3 == 0 ? Min(i+t,width-1) : (7*i+13*t)%width );
+            ASeq.QueueUpdate( i, j, Value<T>(i,j) );
+            if( local )
+                A.QueueLocalUpdate( iLoc, j, Value<T>(i,j) );
+        }
+    }
+    A.ProcessLocalQueues();
+    ASeq.ProcessQueues();
+    DistSELLMatrix<T> ASELL( A, 4, 16 );
+
+    for( const Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        for( const bool useSELL : {false,true} )
+        {
+            const Int XHeight = ( orientation == NORMAL ? width : m );
+            const Int YHeight = ( orientation == NORMAL ? m : width );
+            DistMultiVec<T> X(comm), Y(comm);
+            Matrix<T> XSeq, YSeq;
+            Zeros( X, XHeight, n );
+            Zeros( Y, YHeight, n );
+            Zeros( XSeq, XHeight, n );
+            Zeros( YSeq, YHeight, n );
+            for( Int j=0; j<n; ++j )
+            {
+                for( Int i=0; i<XHeight; ++i )
+                    XSeq(i,j) = Value<T>(j,i);
+                for( Int i=0; i<YHeight; ++i )
+                    YSeq(i,j) = Value<T>(i+1,j);
+                for( Int iLoc=0; iLoc<X.LocalHeight(); ++iLoc )
+                    X.SetLocal( iLoc, j, XSeq(X.GlobalRow(iLoc),j) );
+                for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+                    Y.SetLocal( iLoc, j, YSeq(Y.GlobalRow(iLoc),j) );
+            }
+            if( useSELL )
+                Multiply( orientation, T(2), A, ASELL, X, T(3), Y );
+            else
+                Multiply( orientation, T(2), A, X, T(3), Y );
+            Multiply( orientation, T(2), ASeq, XSeq, T(3), YSeq );
+
+            Real errFrobSquared=0;
+            for( Int j=0; j<n; ++j )
+                for( Int iLoc=0; iLoc<Y.LocalHeight(); ++iLoc )
+                    errFrobSquared +=
+                      Pow( Abs(Y.GetLocal(iLoc,j)-YSeq(Y.GlobalRow(iLoc),j)),
+                           Real(2) );
+            const Real errFrob =
+              Sqrt( mpi::AllReduce( errFrobSquared, comm ) );
+            const Real YFrob = FrobeniusNorm( YSeq );
+            if( errFrob > 100*limits::Epsilon<Real>()*Max(YFrob,Real(1)) )
+            {
+                if( commRank == 0 )
+                    Output
+                    ("|| A X - ASeq XSeq ||_F = ",errFrob," for orientation ",
+                     int(orientation),( useSELL ? " with SELL" : "" ));
+                RuntimeError
+                ("Distributed multiply did not match sequential one");
+            }
+        }
+    }
+    OutputFromRoot(comm,"Test passed");
+}
+
+// A tridiagonal matrix only couples each process to the processes owning
+// the neighboring rows, so the rows of X exchanged by the distributed
+// multiply are checked against those fetched (or, in the adjoint case, the
+// updates of Y scattered) with a dense AllToAll over the whole communicator
+template<typename T>
+void TestNeighborMultiply( Int m, Int n=3 )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot
+    (comm,"Testing neighbor-only multiply exchange with ",TypeName<T>());
+
+    DistSparseMatrix<T> A(m,m,comm);
+    A.Reserve( 3*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int j=Max(i-1,Int(0)); j<=Min(i+1,m-1); ++j )
+            A.QueueLocalUpdate( iLoc, j, Value<T>(i,j) );
+    }
+    A.ProcessLocalQueues();
+
+    // Besides ourselves, only the owners of rows i-1 and i+1 may take part
+    const auto meta = A.InitializeMultMeta();
+    if( meta.sendNeighbors.size() > 3 || meta.recvNeighbors.size() > 3 )
+        RuntimeError
+        ("Process ",commRank," exchanged rows with ",
+         meta.sendNeighbors.size()," and ",meta.recvNeighbors.size(),
+         " processes for a tridiagonal matrix");
+
+    // The sorted list of the rows of X referenced by our rows, and the rows
+    // of ours which every other process references
+    vector<Int> cols;
+    for( Int e=0; e<A.NumLocalEntries(); ++e )
+        cols.push_back( A.Col(e) );
+    std::sort( cols.begin(), cols.end() );
+    cols.erase( std::unique(cols.begin(),cols.end()), cols.end() );
+    DistMultiVec<T> X(comm), Y(comm);
+    Zeros( X, m, n );
+    vector<int> requestCounts(commSize,0), requestOffs(commSize),
+                servedCounts(commSize), servedOffs(commSize);
+    for( const Int j : cols )
+        ++requestCounts[X.RowOwner(j)];
+    mpi::AllToAll( requestCounts.data(), 1, servedCounts.data(), 1, comm );
+    int numRequests=0, numServed=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        requestOffs[q] = numRequests;
+        servedOffs[q] = numServed;
+        numRequests += requestCounts[q];
+        numServed += servedCounts[q];
+    }
+    const vector<Int> served =
+      mpi::AllToAll( cols, requestCounts, requestOffs, comm );
+    auto colPos =
+      [&]( Int j )
+      { return Int(std::lower_bound(cols.begin(),cols.end(),j)-cols.begin()); };
+
+    // The values are exchanged in units of rows of width n
+    vector<int> requestValCounts(commSize), requestValOffs(commSize),
+                servedValCounts(commSize), servedValOffs(commSize);
+    for( int q=0; q<commSize; ++q )
+    {
+        requestValCounts[q] = requestCounts[q]*n;
+        requestValOffs[q] = requestOffs[q]*n;
+        servedValCounts[q] = servedCounts[q]*n;
+        servedValOffs[q] = servedOffs[q]*n;
+    }
+
+    const T alpha( 2 ), beta( 3 );
+    for( const Orientation orientation : {NORMAL,ADJOINT} )
+    {
+        Uniform( X, m, n );
+        Uniform( Y, m, n );
+        const Int localHeight = Y.LocalHeight();
+        const Int firstLocalRow = Y.FirstLocalRow();
+        Matrix<T> YRef;
+        Zeros( YRef, localHeight, n );
+        for( Int j=0; j<n; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                YRef(iLoc,j) = beta*Y.GetLocal(iLoc,j);
+
+        if( orientation == NORMAL )
+        {
+            vector<T> servedVals( numServed*n ), requestVals( numRequests*n );
+            for( Int s=0; s<numServed; ++s )
+                for( Int k=0; k<n; ++k )
+                    servedVals[s*n+k] =
+                      X.GetLocal( served[s]-firstLocalRow, k );
+            mpi::AllToAll
+            ( servedVals.data(), servedValCounts.data(), servedValOffs.data(),
+              requestVals.data(), requestValCounts.data(),
+              requestValOffs.data(), comm );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int eStart = A.RowOffset(iLoc);
+                const Int eStop = eStart + A.NumConnections(iLoc);
+                for( Int e=eStart; e<eStop; ++e )
+                {
+                    const Int pos = colPos( A.Col(e) );
+                    for( Int k=0; k<n; ++k )
+                        YRef(iLoc,k) += alpha*A.Value(e)*requestVals[pos*n+k];
+                }
+            }
+        }
+        else
+        {
+            vector<T> requestVals( numRequests*n, T(0) ),
+                      servedVals( numServed*n );
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            {
+                const Int eStart = A.RowOffset(iLoc);
+                const Int eStop = eStart + A.NumConnections(iLoc);
+                for( Int e=eStart; e<eStop; ++e )
+                {
+                    const Int pos = colPos( A.Col(e) );
+                    for( Int k=0; k<n; ++k )
+                        requestVals[pos*n+k] +=
+                          alpha*Conj(A.Value(e))*X.GetLocal(iLoc,k);
+                }
+            }
+            mpi::AllToAll
+            ( requestVals.data(), requestValCounts.data(),
+              requestValOffs.data(),
+              servedVals.data(), servedValCounts.data(), servedValOffs.data(),
+              comm );
+            for( Int s=0; s<numServed; ++s )
+                for( Int k=0; k<n; ++k )
+                    YRef(served[s]-firstLocalRow,k) += servedVals[s*n+k];
+        }
+
+        Multiply( orientation, alpha, A, X, beta, Y );
+        Real errFrobSquared=0;
+        for( Int j=0; j<n; ++j )
+            for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+                errFrobSquared +=
+                  Pow( Abs(Y.GetLocal(iLoc,j)-YRef(iLoc,j)), Real(2) );
+        const Real errFrob = Sqrt( mpi::AllReduce( errFrobSquared, comm ) );
+        const Real YFrob = FrobeniusNorm( Y );
+        if( errFrob > 100*limits::Epsilon<Real>()*Max(YFrob,Real(1)) )
+        {
+            if( commRank == 0 )
+                Output
+                ("|| A X - AllToAll reference ||_F = ",errFrob,
+                 " for orientation ",int(orientation));
+            RuntimeError
+            ("Neighbor-only multiply did not match dense AllToAll one");
+        }
+    }
+    OutputFromRoot(comm,"Test passed");
+}
+
+template<typename T>
+void TestSELL( Int m, Int n=3 )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    Output("Testing SELL-C-sigma with ",TypeName<T>());
+
+    // Build a rectangular matrix with rows of varying lengths
+    const Int width = m + 3;
+    SparseMatrix<T> A( m, width );
+    A.Reserve( 5*m );
+    for( Int i=0; i<m; ++i )
+        for( Int k=0; k<i%5; ++k )
+            A.QueueUpdate( i, (7*i+13*k)%width, SampleUniform<T>() );
+    A.ProcessQueues();
+    SELLMatrix<T> ASELL( A, 4, 16 );
+
+    for( const Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int XHeight = ( orientation == NORMAL ? width : m );
+        const Int YHeight = ( orientation == NORMAL ? m : width );
+        Matrix<T> X, Y, YSELL;
+        Uniform( X, XHeight, n );
+        Uniform( Y, YHeight, n );
+        YSELL = Y;
+        Multiply( orientation, T(2), A, X, T(3), Y );
+        Multiply( orientation, T(2), ASELL, X, T(3), YSELL );
+        Axpy( T(-1), Y, YSELL );
+        const Real errFrob = FrobeniusNorm( YSELL );
+        const Real YFrob = FrobeniusNorm( Y );
+        if( errFrob > 100*limits::Epsilon<Real>()*Max(YFrob,Real(1)) )
+        {
+            Output("|| A X - ASELL X ||_F = ",errFrob);
+            RuntimeError("SELL multiply did not match CSR multiply");
+        }
+    }
+
+    // An infinite entry of X may only affect the entries of Y whose rows
+    // (or columns) reference it, and not those which are merely padded
+    auto isFinite =
+      []( const T& alpha )
+      { return limits::IsFinite(RealPart(alpha)) &&
+               limits::IsFinite(ImagPart(alpha)); };
+    for( const Orientation orientation : {NORMAL,TRANSPOSE,ADJOINT} )
+    {
+        const Int XHeight = ( orientation == NORMAL ? width : m );
+        const Int YHeight = ( orientation == NORMAL ? m : width );
+        Matrix<T> X, Y, YSELL;
+        Uniform( X, XHeight, n );
+        for( Int j=0; j<n; ++j )
+            X(0,j) = limits::Infinity<Real>();
+        Zeros( Y, YHeight, n );
+        Zeros( YSELL, YHeight, n );
+        Multiply( orientation, T(1), A, X, T(0), Y );
+        Multiply( orientation, T(1), ASELL, X, T(0), YSELL );
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<YHeight; ++i )
+            {
+                if( isFinite(Y(i,j)) != isFinite(YSELL(i,j)) )
+                    RuntimeError
+                    ("SELL multiply produced ",YSELL(i,j)," instead of ",
+                     Y(i,j)," with an infinite input");
+                if( isFinite(Y(i,j)) &&
+                    Abs(Y(i,j)-YSELL(i,j)) >
+                    100*limits::Epsilon<Real>()*Max(Abs(Y(i,j)),Real(1)) )
+                    RuntimeError("SELL multiply did not match CSR multiply");
+            }
+    }
+    Output("Test passed");
+}
+
+template<typename T>
+void TestSpGEMM( Int m, Int n=3 )
+{
+    DEBUG_CSE
+    typedef Base<T> Real;
+    mpi::Comm comm = mpi::COMM_WORLD;
+    Output("Testing sparse-sparse multiply with ",TypeName<T>());
+
+    // Build A and B with rows of varying lengths
+    const Int k = m + 2;
+    const Int width = m + 3;
+    DistSparseMatrix<T> A(m,k,comm), B(k,width,comm);
+    A.Reserve( 4*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        for( Int t=0; t<i%4+1; ++t )
+            A.QueueLocalUpdate( iLoc, (5*i+11*t)%k, SampleUniform<T>() );
+    }
+    A.ProcessLocalQueues();
+    B.Reserve( 3*B.LocalHeight() );
+    for( Int iLoc=0; iLoc<B.LocalHeight(); ++iLoc )
+    {
+        const Int i = B.GlobalRow(iLoc);
+        for( Int t=0; t<i%3; ++t )
+            B.QueueLocalUpdate( iLoc, (3*i+7*t)%width, SampleUniform<T>() );
+    }
+    B.ProcessLocalQueues();
+
+    DistSparseMultiplyPlan plan;
+    MultiplySymbolic( A.LockedDistGraph(), B.LockedDistGraph(), plan );
+    DistSparseMatrix<T> C(comm);
+    for( Int it=0; it<2; ++it )
+    {
+        // The second pass only changes the values of B
+        if( it == 1 )
+            B *= T(2);
+        MultiplyNumeric( A, B, plan, C );
+
+        DistMultiVec<T> X(comm), Y(comm), Z(comm), W(comm);
+        Uniform( X, width, n );
+        Zeros( Z, k, n );
+        Zeros( W, m, n );
+        Zeros( Y, m, n );
+        Multiply( NORMAL, T(1), C, X, T(0), Y );
+        Multiply( NORMAL, T(1), B, X, T(0), Z );
+        Multiply( NORMAL, T(1), A, Z, T(0), W );
+        W -= Y;
+        const Real errFrob = FrobeniusNorm( W );
+        const Real YFrob = FrobeniusNorm( Y );
+        if( errFrob > 100*limits::Epsilon<Real>()*Max(YFrob,Real(1)) )
+        {
+            Output("|| (A B) X - A (B X) ||_F = ",errFrob);
+            RuntimeError("Sparse-sparse multiply was incorrect");
+        }
+    }
+
+    // A plan may insert the structural diagonal and only form the lower
+    // triangle, e.g., for the normal equations A D A^T + delta^2 I
+    DistSparseMatrix<T> AT(comm), CFull(comm), CLower(comm);
+    Transpose( A, AT );
+    Multiply( A, AT, CFull );
+    DistSparseMultiplyPlan lowerPlan;
+    MultiplySymbolic
+    ( A.LockedDistGraph(), AT.LockedDistGraph(), lowerPlan, true, true );
+    for( Int it=0; it<2; ++it )
+    {
+        MultiplyNumeric( A, AT, lowerPlan, CLower );
+        if( CLower.NumLocalEntries() != Int(lowerPlan.cols.size()) )
+            RuntimeError("C did not have the pattern of the plan");
+        for( Int iLoc=0; iLoc<CLower.LocalHeight(); ++iLoc )
+        {
+            const Int i = CLower.GlobalRow(iLoc);
+            const Int rowEnd =
+              CLower.Offset(iLoc,0) + CLower.NumConnections(iLoc);
+            const Int e = CLower.Offset( iLoc, i );
+            if( e >= rowEnd || CLower.Col(e) != i )
+                RuntimeError("C was missing its structural diagonal");
+            if( CLower.Col(rowEnd-1) > i )
+                RuntimeError("C had an entry above its diagonal");
+        }
+    }
+    const Grid grid( comm );
+    DistMatrix<T> CFullDense(grid), CLowerDense(grid);
+    Copy( CFull, CFullDense );
+    Copy( CLower, CLowerDense );
+    MakeTrapezoidal( LOWER, CFullDense );
+    CLowerDense -= CFullDense;
+    const Real errFrob = FrobeniusNorm( CLowerDense );
+    const Real CFrob = FrobeniusNorm( CFullDense );
+    if( errFrob > 100*limits::Epsilon<Real>()*Max(CFrob,Real(1)) )
+    {
+        Output("|| tril(A A^T) - C ||_F = ",errFrob);
+        RuntimeError("Lower-triangular sparse-sparse multiply was incorrect");
+    }
+    Output("Test passed");
+}
+
 void RunTests( Int m )
 {
     PushIndent();
@@ -52,6 +471,14 @@ void RunTests( Int m )
     TestMultiply<Complex<float>>(m);
     TestMultiply<double>(m);
     TestMultiply<Complex<double>>(m);
+    TestDistMultiply<double>(m);
+    TestDistMultiply<Complex<double>>(m);
+    TestNeighborMultiply<double>(m);
+    TestNeighborMultiply<Complex<double>>(m);
+    TestSELL<double>(m);
+    TestSELL<Complex<double>>(m);
+    TestSpGEMM<double>(m);
+    TestSpGEMM<Complex<double>>(m);
 #ifdef EL_HAVE_QD
     TestMultiply<DoubleDouble>(m);
     TestMultiply<Complex<DoubleDouble>>(m);
@@ -0,0 +1,122 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A recognizable value for entry i of the message from process q to r
+template<typename T>
+T Tag( int q, int r, Int i )
+{ return T(q) + T(1000)*T(r) + T(1000000)*T(i); }
+
+template<typename T>
+void TestLargeCounts( Int n, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+
+    // Broadcast
+    vector<T> buf(n);
+    for( Int i=0; i<n; ++i )
+        buf[i] = ( commRank == 0 ? Tag<T>(0,0,i) : T(0) );
+    mpi::LargeBroadcast( buf.data(), n, 0, comm );
+    for( Int i=0; i<n; ++i )
+        if( buf[i] != Tag<T>(0,0,i) )
+            LogicError("LargeBroadcast failed");
+
+    // SendRecv around a ring with differing message lengths
+    const int to = Mod( commRank+1, commSize );
+    const int from = Mod( commRank-1, commSize );
+    const Int sc = n + commRank;
+    const Int rc = n + from;
+    vector<T> sendBuf(sc), recvBuf(rc);
+    for( Int i=0; i<sc; ++i )
+        sendBuf[i] = Tag<T>(commRank,to,i);
+    mpi::LargeSendRecv
+    ( sendBuf.data(), sc, to, recvBuf.data(), rc, from, comm );
+    for( Int i=0; i<rc; ++i )
+        if( recvBuf[i] != Tag<T>(from,commRank,i) )
+            LogicError("LargeSendRecv failed");
+
+    // AllGather
+    sendBuf.resize( n );
+    for( Int i=0; i<n; ++i )
+        sendBuf[i] = Tag<T>(commRank,0,i);
+    recvBuf.resize( n*commSize );
+    mpi::LargeAllGather( sendBuf.data(), n, recvBuf.data(), n, comm );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n; ++i )
+            if( recvBuf[q*n+i] != Tag<T>(q,0,i) )
+                LogicError("LargeAllGather failed");
+
+    // AllToAll with a different message length for each pair
+    vector<Int> sendCounts(commSize), sendOffs;
+    for( int q=0; q<commSize; ++q )
+        sendCounts[q] = n + q + commRank;
+    const Int totalSend = Scan( sendCounts, sendOffs );
+    sendBuf.resize( totalSend );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<sendCounts[q]; ++i )
+            sendBuf[sendOffs[q]+i] = Tag<T>(commRank,q,i);
+    recvBuf = mpi::LargeAllToAll( sendBuf, sendCounts, sendOffs, comm );
+    Int off = 0;
+    for( int q=0; q<commSize; ++q )
+    {
+        for( Int i=0; i<n+q+commRank; ++i )
+            if( recvBuf[off+i] != Tag<T>(q,commRank,i) )
+                LogicError("LargeAllToAll failed");
+        off += n+q+commRank;
+    }
+    if( off != Int(recvBuf.size()) )
+        LogicError("LargeAllToAll received ",recvBuf.size()," entries");
+
+    // The same exchange through the pointer interface
+    vector<Int> recvCounts(commSize), recvOffs;
+    for( int q=0; q<commSize; ++q )
+        recvCounts[q] = n + q + commRank;
+    const Int totalRecv = Scan( recvCounts, recvOffs );
+    vector<T> recvBufPtr( totalRecv );
+    mpi::LargeAllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBufPtr.data(), recvCounts.data(), recvOffs.data(), comm );
+    if( recvBufPtr != recvBuf )
+        LogicError("LargeAllToAll with explicit counts failed");
+
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","base message length",100);
+        const Int maxCount =
+          Input("--maxCount","maximum entries per message",7);
+        ProcessInput();
+        PrintInputReport();
+
+        // Artificially lower the limit so that the messages are split
+        mpi::SetMaxMessageCount( maxCount );
+
+        TestLargeCounts<double>( n, comm );
+        TestLargeCounts<Complex<double>>( n, comm );
+#ifdef EL_HAVE_QD
+        TestLargeCounts<DoubleDouble>( n, comm );
+#endif
+#ifdef EL_HAVE_MPC
+        TestLargeCounts<BigFloat>( n, comm );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
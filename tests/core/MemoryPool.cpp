@@ -0,0 +1,85 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License, 
+   which can be found in the LICENSE file in the root directory, or at 
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename T> 
+void TestPool( Int m, Int n, Int numIts, size_t alignment )
+{
+    Output("Testing with ",TypeName<T>());
+    ResetMemoryPoolStatistics();
+
+    for( Int it=0; it<numIts; ++it )
+    {
+        Matrix<T> A, B;
+        Uniform( A, m, n );
+        Zeros( B, n, m );
+        Transpose( A, B );
+        if( size_t(A.Buffer()) % alignment != 0 || 
+            size_t(B.Buffer()) % alignment != 0 )
+            LogicError("Buffer was not aligned to ",alignment," bytes");
+        for( Int j=0; j<n; ++j )
+            for( Int i=0; i<m; ++i )
+                if( A.Get(i,j) != B.Get(j,i) )
+                    LogicError("Pooled buffers were corrupted");
+    }
+
+    const MemoryPoolStatistics stats = GetMemoryPoolStatistics();
+    Output("hit rate: ",stats.HitRate());
+    if( numIts > 1 && stats.numHits == 0 )
+        LogicError("Pool never recycled a block");
+    Output("passed");
+}
+
+int 
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try 
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int numIts = Input("--numIts","number of iterations",10);
+        const Int alignment = Input("--alignment","alignment in bytes",64);
+        const bool print = Input("--print","print statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        SetMemoryPolicy( MEMORY_POOLED );
+        SetMemoryAlignment( alignment );
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestPool<float>( m, n, numIts, alignment );
+            TestPool<Complex<float>>( m, n, numIts, alignment );
+
+            TestPool<double>( m, n, numIts, alignment );
+            TestPool<Complex<double>>( m, n, numIts, alignment );
+
+#ifdef EL_HAVE_QD
+            TestPool<DoubleDouble>( m, n, numIts, alignment );
+            TestPool<QuadDouble>( m, n, numIts, alignment );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestPool<Quad>( m, n, numIts, alignment );
+            TestPool<Complex<Quad>>( m, n, numIts, alignment );
+#endif
+
+#ifdef EL_HAVE_MPC
+            TestPool<BigFloat>( m, n, numIts, alignment );
+            TestPool<Complex<BigFloat>>( m, n, numIts, alignment );
+#endif
+            if( print )
+                PrintMemoryPoolStatistics();
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
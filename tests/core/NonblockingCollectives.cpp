@@ -0,0 +1,182 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// A recognizable (and exactly summable) value for entry i of the message
+// from process q to r
+template<typename T>
+T Tag( int q, int r, Int i )
+{ return T(q) + T(100)*T(r) + T(10000)*T(i); }
+
+template<typename T>
+void CheckEqual
+( const string& name, const vector<T>& blocking, const vector<T>& nonblocking )
+{
+    if( blocking.size() != nonblocking.size() )
+        LogicError(name," received ",nonblocking.size()," instead of ",
+                   blocking.size()," entries");
+    for( size_t i=0; i<blocking.size(); ++i )
+        if( blocking[i] != nonblocking[i] )
+            LogicError(name," differed from its blocking counterpart at ",i);
+}
+
+template<typename T>
+void TestNonblocking( Int n, mpi::Comm comm )
+{
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+    OutputFromRoot(comm,"Testing with ",TypeName<T>());
+
+    // AllGather
+    vector<T> sendBuf(n), recvBuf(n*commSize), recvBufNB(n*commSize);
+    for( Int i=0; i<n; ++i )
+        sendBuf[i] = Tag<T>(commRank,0,i);
+    mpi::AllGather( sendBuf.data(), n, recvBuf.data(), n, comm );
+    {
+        mpi::Request<T> request;
+        mpi::IAllGather
+        ( sendBuf.data(), n, recvBufNB.data(), n, comm, request );
+        mpi::Wait( request );
+    }
+    CheckEqual( "IAllGather", recvBuf, recvBufNB );
+
+    // AllToAll with uniform counts
+    sendBuf.resize( n*commSize );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n; ++i )
+            sendBuf[q*n+i] = Tag<T>(commRank,q,i);
+    mpi::AllToAll( sendBuf.data(), n, recvBuf.data(), n, comm );
+    {
+        mpi::Request<T> request;
+        mpi::IAllToAll
+        ( sendBuf.data(), n, recvBufNB.data(), n, comm, request );
+        mpi::Wait( request );
+    }
+    CheckEqual( "IAllToAll", recvBuf, recvBufNB );
+
+    // AllToAll with a different message length for each pair
+    vector<int> sendCounts(commSize), sendOffs(commSize),
+                recvCounts(commSize), recvOffs(commSize);
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendCounts[q] = n + q + commRank;
+        recvCounts[q] = n + commRank + q;
+        sendOffs[q] = totalSend;
+        recvOffs[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+    sendBuf.resize( totalSend );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<sendCounts[q]; ++i )
+            sendBuf[sendOffs[q]+i] = Tag<T>(commRank,q,i);
+    recvBuf.resize( totalRecv );
+    recvBufNB.resize( totalRecv );
+    mpi::AllToAll
+    ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+      recvBuf.data(), recvCounts.data(), recvOffs.data(), comm );
+    {
+        mpi::Request<T> request;
+        mpi::IAllToAll
+        ( sendBuf.data(), sendCounts.data(), sendOffs.data(),
+          recvBufNB.data(), recvCounts.data(), recvOffs.data(), comm,
+          request );
+        mpi::Wait( request );
+    }
+    CheckEqual( "Variable-length IAllToAll", recvBuf, recvBufNB );
+
+    // AllReduce (summation and, where ordered, maximization)
+    sendBuf.resize( n );
+    for( Int i=0; i<n; ++i )
+        sendBuf[i] = Tag<T>(commRank,commRank,i);
+    recvBuf.resize( n );
+    recvBufNB.resize( n );
+    mpi::AllReduce( sendBuf.data(), recvBuf.data(), n, comm );
+    {
+        mpi::Request<T> request;
+        mpi::IAllReduce( sendBuf.data(), recvBufNB.data(), n, comm, request );
+        mpi::Wait( request );
+    }
+    CheckEqual( "IAllReduce", recvBuf, recvBufNB );
+    if( !IsComplex<T>::value )
+    {
+        mpi::AllReduce( sendBuf.data(), recvBuf.data(), n, mpi::MAX, comm );
+        mpi::Request<T> request;
+        mpi::IAllReduce
+        ( sendBuf.data(), recvBufNB.data(), n, mpi::MAX, comm, request );
+        mpi::Wait( request );
+        CheckEqual( "IAllReduce with MAX", recvBuf, recvBufNB );
+    }
+
+    // In-place AllReduce
+    recvBuf = sendBuf;
+    recvBufNB = sendBuf;
+    mpi::AllReduce( recvBuf.data(), n, comm );
+    {
+        mpi::Request<T> request;
+        mpi::IAllReduce( recvBufNB.data(), n, comm, request );
+        mpi::Wait( request );
+    }
+    CheckEqual( "In-place IAllReduce", recvBuf, recvBufNB );
+
+    // ReduceScatter
+    sendBuf.resize( n*commSize );
+    for( int q=0; q<commSize; ++q )
+        for( Int i=0; i<n; ++i )
+            sendBuf[q*n+i] = Tag<T>(commRank,q,i);
+    vector<T> sendBufCopy( sendBuf );
+    mpi::ReduceScatter( sendBufCopy.data(), recvBuf.data(), n, comm );
+    {
+        mpi::Request<T> request;
+        mpi::IReduceScatter
+        ( sendBuf.data(), recvBufNB.data(), n, comm, request );
+        mpi::Wait( request );
+    }
+    CheckEqual( "IReduceScatter", recvBuf, recvBufNB );
+
+    OutputFromRoot(comm,"passed");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    try
+    {
+        const Int n = Input("--n","base message length",50);
+        ProcessInput();
+        PrintInputReport();
+
+#ifdef EL_HAVE_NONBLOCKING_COLLECTIVES
+        TestNonblocking<Int>( n, comm );
+        TestNonblocking<float>( n, comm );
+        TestNonblocking<double>( n, comm );
+        TestNonblocking<Complex<double>>( n, comm );
+#ifdef EL_HAVE_QD
+        TestNonblocking<DoubleDouble>( n, comm );
+        TestNonblocking<QuadDouble>( n, comm );
+        TestNonblocking<Complex<DoubleDouble>>( n, comm );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestNonblocking<Quad>( n, comm );
+#endif
+#ifdef EL_HAVE_MPC
+        TestNonblocking<BigFloat>( n, comm );
+#endif
+#else
+        OutputFromRoot(comm,"Non-blocking collectives are not available");
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,140 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Run numIts passes which each loan an m x n and an n x n temporary
+template<typename T>
+void LoanPasses( Int m, Int n, Int numIts, vector<T*>& buffers )
+{
+    buffers.clear();
+    for( Int it=0; it<numIts; ++it )
+    {
+        Matrix<T> A, B;
+        WorkspaceLoan<T> loan( A, B );
+        A.Resize( m, n );
+        B.Resize( n, n );
+        buffers.push_back( A.Buffer() );
+        buffers.push_back( B.Buffer() );
+
+        const WorkspaceStatistics stats = GetWorkspaceStatistics();
+        if( stats.peakBytes < stats.cachedBytes+stats.loanedBytes )
+            LogicError("Peak was below the current footprint");
+    }
+}
+
+template<typename T>
+void TestWorkspace( const Grid& g, Int m, Int n, Int numIts )
+{
+    Output("Testing with ",TypeName<T>());
+    PushIndent();
+    const size_t ABytes = m*n*sizeof(T);
+    const size_t BBytes = n*n*sizeof(T);
+    vector<T*> buffers;
+
+    // Reuse: every pass after the first should borrow both buffers
+    {
+        WorkspaceScope scope;
+        LoanPasses( m, n, numIts, buffers );
+        const WorkspaceStatistics stats = GetWorkspaceStatistics();
+        if( stats.numBorrows != size_t(2*(numIts-1)) )
+            LogicError
+            ("Expected ",2*(numIts-1)," borrows but found ",stats.numBorrows);
+        if( stats.numEvictions != 0 )
+            LogicError("Unexpected evictions");
+        for( Int it=1; it<numIts; ++it )
+            if( buffers[2*it] != buffers[0] && buffers[2*it] != buffers[1] )
+                LogicError("Pass ",it," did not reuse a cached buffer");
+        if( stats.loanedBytes != 0 )
+            LogicError("Buffers were still on loan after the last pass");
+        if( stats.cachedBytes != ABytes+BBytes )
+            LogicError
+            ("Expected ",ABytes+BBytes," cached bytes but found ",
+             stats.cachedBytes);
+        if( stats.peakBytes != ABytes+BBytes )
+            LogicError
+            ("Expected a peak of ",ABytes+BBytes," bytes but found ",
+             stats.peakBytes);
+    }
+    if( WorkspaceActive() )
+        LogicError("Workspace was still active after its scope");
+
+    // Eviction: only the larger of the two buffers fits within the limit
+    {
+        const size_t maxBytes = Max(ABytes,BBytes);
+        WorkspaceScope scope( maxBytes );
+        LoanPasses( m, n, numIts, buffers );
+        const WorkspaceStatistics stats = GetWorkspaceStatistics();
+        if( stats.numEvictions == 0 )
+            LogicError("Expected evictions with a limit of ",maxBytes);
+        if( stats.cachedBytes > maxBytes || stats.peakBytes > maxBytes )
+            LogicError("Arena exceeded its limit of ",maxBytes," bytes");
+        if( stats.numBorrows+stats.numEvictions != size_t(2*numIts-1) )
+            LogicError("Borrows and evictions did not account for the loans");
+    }
+
+    // Integration with the SUMMA kernels
+    {
+        DistMatrix<T> A(g), B(g), C(g);
+        Uniform( A, m, n );
+        Uniform( B, n, m );
+        Zeros( C, m, m );
+        WorkspaceScope scope;
+        for( Int it=0; it<numIts; ++it )
+            Gemm( NORMAL, NORMAL, T(1), A, B, T(0), C, GEMM_SUMMA_A );
+        const WorkspaceStatistics stats = GetWorkspaceStatistics();
+        if( numIts > 1 && stats.numBorrows == 0 )
+            LogicError("Gemm never borrowed from the workspace");
+        if( stats.peakBytes < stats.cachedBytes )
+            LogicError("Peak was below the cached footprint");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    try
+    {
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",60);
+        const Int numIts = Input("--numIts","number of iterations",4);
+        const bool print = Input("--print","print statistics?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( numIts < 2 )
+            LogicError("At least two iterations are required");
+        const Grid g( mpi::COMM_SELF );
+        if( mpi::Rank(mpi::COMM_WORLD) == 0 )
+        {
+            TestWorkspace<float>( g, m, n, numIts );
+            TestWorkspace<Complex<float>>( g, m, n, numIts );
+
+            TestWorkspace<double>( g, m, n, numIts );
+            TestWorkspace<Complex<double>>( g, m, n, numIts );
+
+#ifdef EL_HAVE_QD
+            TestWorkspace<DoubleDouble>( g, m, n, numIts );
+            TestWorkspace<QuadDouble>( g, m, n, numIts );
+#endif
+
+#ifdef EL_HAVE_QUAD
+            TestWorkspace<Quad>( g, m, n, numIts );
+            TestWorkspace<Complex<Quad>>( g, m, n, numIts );
+#endif
+            if( print )
+                PrintWorkspaceStatistics();
+        }
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -0,0 +1,436 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Unpack member j of a batch of m x n matrices
+template<typename F>
+Matrix<F> Member( const Matrix<F>& batch, Int j, Int m, Int n )
+{
+    Matrix<F> A( m, n );
+    for( Int jMem=0; jMem<n; ++jMem )
+        for( Int iMem=0; iMem<m; ++iMem )
+            A(iMem,jMem) = batch(iMem+jMem*m,j);
+    return A;
+}
+
+template<typename F>
+void CheckMember
+( const string& name, const Matrix<F>& A, const Matrix<F>& AExpected )
+{
+    typedef Base<F> Real;
+    const Real eps = limits::Epsilon<Real>();
+    Matrix<F> E( A );
+    E -= AExpected;
+    const Real relErr =
+      FrobeniusNorm(E) / (eps*Max(FrobeniusNorm(AExpected),Real(1)));
+    if( relErr > Real(100) )
+        LogicError(name," member differed: ||E||_F / (eps ||A||_F) = ",relErr);
+}
+
+// Form the permutation applied by the pivots of member j of a batched LU
+Permutation MemberPermutation( const Matrix<Int>& p, Int j, Int m )
+{
+    Permutation P;
+    P.MakeIdentity( m );
+    P.ReserveSwaps( p.Height() );
+    P.ImplicitSwapSequence( p(ALL,IR(j)) );
+    return P;
+}
+
+void CheckPivots
+( const string& name, const Permutation& P, const Permutation& PExpected,
+  Int j )
+{
+    Matrix<Int> perm, permExpected;
+    P.ExplicitVector( perm );
+    PExpected.ExplicitVector( permExpected );
+    for( Int i=0; i<perm.Height(); ++i )
+        if( perm(i) != permExpected(i) )
+            LogicError(name," pivots of member ",j," differed from LU");
+}
+
+void CheckSamePivots
+( const string& name, const Matrix<Int>& p, const Matrix<Int>& pExpected )
+{
+    for( Int j=0; j<p.Width(); ++j )
+        for( Int i=0; i<p.Height(); ++i )
+            if( p(i,j) != pExpected(i,j) )
+                LogicError(name," pivots of member ",j," differed");
+}
+
+// A batch of well-conditioned (when either triangle is used) d x d members
+template<typename F>
+void MakeTriangles( Matrix<F>& A, Int d, Int batchSize )
+{
+    Uniform( A, d*d, batchSize );
+    for( Int j=0; j<batchSize; ++j )
+        for( Int i=0; i<d; ++i )
+            A(i+i*d,j) += F(d);
+}
+
+template<typename F>
+void MakeTriangles( DistMatrix<F>& A, Int d, Int batchSize )
+{
+    Uniform( A, d*d, batchSize );
+    for( Int i=0; i<d; ++i )
+    {
+        auto diagRow = A( IR(i+i*d), ALL );
+        Shift( diagRow, F(d) );
+    }
+}
+
+template<typename F>
+void TestSequentialGemm( Int m, Int n, Int k, Int batchSize )
+{
+    const Orientation orients[] = { NORMAL, TRANSPOSE, ADJOINT };
+    const F alpha( 2 ), beta( -3 );
+    Timer timer;
+    for( Orientation orientA : orients )
+    {
+        for( Orientation orientB : orients )
+        {
+            const Int AHeight = ( orientA == NORMAL ? m : k );
+            const Int AWidth = ( orientA == NORMAL ? k : m );
+            const Int BHeight = ( orientB == NORMAL ? k : n );
+            const Int BWidth = ( orientB == NORMAL ? n : k );
+            Matrix<F> A, B, C;
+            Uniform( A, AHeight*AWidth, batchSize );
+            Uniform( B, BHeight*BWidth, batchSize );
+            Uniform( C, m*n, batchSize );
+            Matrix<F> COrig( C );
+            timer.Start();
+            BatchedGemm( orientA, orientB, m, n, k, alpha, A, B, beta, C );
+            const double runTime = timer.Stop();
+            const string name =
+              string("BatchedGemm(")+OrientationToChar(orientA)+","+
+              OrientationToChar(orientB)+")";
+            Output(name,": ",runTime," seconds");
+            for( Int j=0; j<batchSize; ++j )
+            {
+                auto CMember = Member(COrig,j,m,n);
+                Gemm
+                ( orientA, orientB,
+                  alpha, Member(A,j,AHeight,AWidth), Member(B,j,BHeight,BWidth),
+                  beta, CMember );
+                CheckMember( name, Member(C,j,m,n), CMember );
+            }
+        }
+    }
+}
+
+template<typename F>
+void TestSequentialTrsm( Int m, Int n, Int batchSize )
+{
+    const LeftOrRight sides[] = { LEFT, RIGHT };
+    const UpperOrLower uplos[] = { LOWER, UPPER };
+    const Orientation orients[] = { NORMAL, TRANSPOSE, ADJOINT };
+    const UnitOrNonUnit diags[] = { NON_UNIT, UNIT };
+    const F alpha( 3 );
+    Matrix<F> B;
+    Uniform( B, m*n, batchSize );
+    Timer timer;
+    double runTime = 0;
+    for( LeftOrRight side : sides )
+    {
+        const Int d = ( side == LEFT ? m : n );
+        Matrix<F> A;
+        MakeTriangles( A, d, batchSize );
+        for( UpperOrLower uplo : uplos )
+        {
+            for( Orientation orient : orients )
+            {
+                for( UnitOrNonUnit diag : diags )
+                {
+                    Matrix<F> X( B );
+                    timer.Start();
+                    BatchedTrsm( side, uplo, orient, diag, m, n, alpha, A, X );
+                    runTime += timer.Stop();
+                    const string name =
+                      string("BatchedTrsm(")+LeftOrRightToChar(side)+","+
+                      UpperOrLowerToChar(uplo)+","+OrientationToChar(orient)+
+                      ","+UnitOrNonUnitToChar(diag)+")";
+                    for( Int j=0; j<batchSize; ++j )
+                    {
+                        auto XMember = Member(B,j,m,n);
+                        Trsm
+                        ( side, uplo, orient, diag,
+                          alpha, Member(A,j,d,d), XMember );
+                        CheckMember( name, Member(X,j,m,n), XMember );
+                    }
+                }
+            }
+        }
+    }
+    Output("BatchedTrsm (all 24 variants): ",runTime," seconds");
+}
+
+template<typename F>
+void TestSequentialLU( Int m, Int n, Int batchSize, bool print )
+{
+    // Without a dominant diagonal, (almost) every member requires pivoting
+    const Int minDim = Min(m,n);
+    Matrix<F> A;
+    Uniform( A, m*n, batchSize );
+    Matrix<F> ALU( A );
+    Matrix<Int> p;
+    Timer timer;
+    timer.Start();
+    BatchedLU( m, n, ALU, p );
+    const string name = BuildString("BatchedLU(",m,"x",n,")");
+    Output(name,": ",timer.Stop()," seconds");
+    if( print )
+        Print( p, "p" );
+    bool pivoted = false;
+    for( Int j=0; j<batchSize; ++j )
+    {
+        for( Int k=0; k<minDim; ++k )
+            if( p(k,j) != k )
+                pivoted = true;
+
+        // P A = L U
+        auto AMember = Member(A,j,m,n);
+        auto ALUMember = Member(ALU,j,m,n);
+        const Permutation P = MemberPermutation( p, j, m );
+        Matrix<F> L( ALUMember(ALL,IR(0,minDim)) ),
+                  U( ALUMember(IR(0,minDim),ALL) );
+        MakeTrapezoidal( LOWER, L );
+        FillDiagonal( L, F(1) );
+        MakeTrapezoidal( UPPER, U );
+        Matrix<F> LUProd;
+        Zeros( LUProd, m, n );
+        Gemm( NORMAL, NORMAL, F(1), L, U, F(0), LUProd );
+        auto PA( AMember );
+        P.PermuteRows( PA );
+        CheckMember( name, LUProd, PA );
+
+        // LAPACK's complex pivot search (used by LU) maximizes |Re|+|Im|
+        // rather than the modulus, so only the real pivots must match
+        if( !IsComplex<F>::value )
+        {
+            Permutation PLU;
+            LU( AMember, PLU );
+            CheckPivots( name, P, PLU, j );
+            CheckMember( name, Member(ALU,j,m,n), AMember );
+        }
+    }
+    if( !pivoted && minDim > 1 )
+        LogicError(name," did not exercise any pivoting");
+}
+
+template<typename F>
+void TestSequentialCholesky( Int m, Int batchSize )
+{
+    // The Hermitian positive-definite members A A^H + I
+    Matrix<F> A, AChol;
+    Uniform( A, m*m, batchSize );
+    Zeros( AChol, m*m, batchSize );
+    BatchedGemm( NORMAL, ADJOINT, m, m, m, F(1), A, A, F(0), AChol );
+    for( Int j=0; j<batchSize; ++j )
+        for( Int i=0; i<m; ++i )
+            AChol(i+i*m,j) += F(1);
+    const UpperOrLower uplos[] = { LOWER, UPPER };
+    Timer timer;
+    for( UpperOrLower uplo : uplos )
+    {
+        Matrix<F> AFact( AChol );
+        timer.Start();
+        BatchedCholesky( uplo, m, AFact );
+        const string name =
+          string("BatchedCholesky(")+UpperOrLowerToChar(uplo)+")";
+        Output(name,": ",timer.Stop()," seconds");
+        for( Int j=0; j<batchSize; ++j )
+        {
+            auto AMember = Member(AChol,j,m,m);
+            Cholesky( uplo, AMember );
+            auto AFactMember = Member(AFact,j,m,m);
+            MakeTrapezoidal( uplo, AMember );
+            MakeTrapezoidal( uplo, AFactMember );
+            CheckMember( name, AFactMember, AMember );
+        }
+    }
+}
+
+template<typename F>
+void TestSequentialQR( Int m, Int n, Int batchSize )
+{
+    Matrix<F> A;
+    Uniform( A, m*n, batchSize );
+    Matrix<F> AQR( A ), householderScalars;
+    Matrix<Base<F>> signature;
+    Timer timer;
+    timer.Start();
+    BatchedQR( m, n, AQR, householderScalars, signature );
+    const string name = BuildString("BatchedQR(",m,"x",n,")");
+    Output(name,": ",timer.Stop()," seconds");
+    for( Int j=0; j<batchSize; ++j )
+    {
+        auto AMember = Member(A,j,m,n);
+        Matrix<F> householderScalarsMember;
+        Matrix<Base<F>> signatureMember;
+        QR( AMember, householderScalarsMember, signatureMember );
+        CheckMember( name, Member(AQR,j,m,n), AMember );
+        CheckMember
+        ( name, householderScalars(ALL,IR(j)), householderScalarsMember );
+        CheckMember( name, signature(ALL,IR(j)), signatureMember );
+    }
+}
+
+template<typename F>
+void TestSequentialBatched( Int m, Int n, Int batchSize, bool print )
+{
+    Output("Testing sequential batched routines with ",TypeName<F>());
+    PushIndent();
+    TestSequentialGemm<F>( m, m, m, batchSize );
+    TestSequentialGemm<F>( m, n, m+1, batchSize );
+    TestSequentialTrsm<F>( m, n, batchSize );
+    TestSequentialLU<F>( m, m, batchSize, print );
+    TestSequentialLU<F>( m, n, batchSize, print );
+    TestSequentialLU<F>( n, m, batchSize, print );
+    TestSequentialCholesky<F>( m, batchSize );
+    TestSequentialQR<F>( m, m, batchSize );
+    TestSequentialQR<F>( m, n, batchSize );
+    TestSequentialQR<F>( n, m, batchSize );
+    PopIndent();
+}
+
+template<typename F>
+void TestBatched( const Grid& g, Int m, Int n, Int batchSize )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing distributed batched routines with ",TypeName<F>());
+    PushIndent();
+
+    // Compare against the sequential routines applied to the entire batch
+    const Int k = m+1;
+    DistMatrix<F> A(g), B(g), C(g);
+    Uniform( A, k*m, batchSize );
+    Uniform( B, k*n, batchSize );
+    Uniform( C, m*n, batchSize );
+    DistMatrix<F,STAR,STAR> A_STAR_STAR( A ), B_STAR_STAR( B ),
+      C_STAR_STAR( C );
+    BatchedGemm( ADJOINT, NORMAL, m, n, k, F(2), A, B, F(-1), C );
+    BatchedGemm
+    ( ADJOINT, NORMAL, m, n, k, F(2), A_STAR_STAR.Matrix(),
+      B_STAR_STAR.Matrix(), F(-1), C_STAR_STAR.Matrix() );
+    CheckMember
+    ( "Distributed BatchedGemm",
+      DistMatrix<F,STAR,STAR>(C).Matrix(), C_STAR_STAR.Matrix() );
+
+    DistMatrix<F> T(g);
+    MakeTriangles( T, n, batchSize );
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( T );
+    BatchedTrsm( RIGHT, UPPER, ADJOINT, NON_UNIT, m, n, F(3), T, C );
+    BatchedTrsm
+    ( RIGHT, UPPER, ADJOINT, NON_UNIT, m, n, F(3),
+      T_STAR_STAR.Matrix(), C_STAR_STAR.Matrix() );
+    CheckMember
+    ( "Distributed BatchedTrsm",
+      DistMatrix<F,STAR,STAR>(C).Matrix(), C_STAR_STAR.Matrix() );
+
+    DistMatrix<F> ALU(g);
+    Uniform( ALU, m*n, batchSize );
+    DistMatrix<F,STAR,STAR> ALU_STAR_STAR( ALU );
+    DistMatrix<Int> p(g);
+    Matrix<Int> pSeq;
+    BatchedLU( m, n, ALU, p );
+    BatchedLU( m, n, ALU_STAR_STAR.Matrix(), pSeq );
+    CheckMember
+    ( "Distributed BatchedLU",
+      DistMatrix<F,STAR,STAR>(ALU).Matrix(), ALU_STAR_STAR.Matrix() );
+    CheckSamePivots
+    ( "Distributed BatchedLU", DistMatrix<Int,STAR,STAR>(p).Matrix(), pSeq );
+
+    // The Hermitian positive-definite members G G^H + I
+    DistMatrix<F> G(g), AChol(g);
+    Uniform( G, m*m, batchSize );
+    Zeros( AChol, m*m, batchSize );
+    BatchedGemm( NORMAL, ADJOINT, m, m, m, F(1), G, G, F(0), AChol );
+    for( Int i=0; i<m; ++i )
+    {
+        auto diagRow = AChol( IR(i+i*m), ALL );
+        Shift( diagRow, F(1) );
+    }
+    DistMatrix<F,STAR,STAR> AChol_STAR_STAR( AChol );
+    BatchedCholesky( UPPER, m, AChol );
+    BatchedCholesky( UPPER, m, AChol_STAR_STAR.Matrix() );
+    CheckMember
+    ( "Distributed BatchedCholesky",
+      DistMatrix<F,STAR,STAR>(AChol).Matrix(), AChol_STAR_STAR.Matrix() );
+
+    DistMatrix<F> householderScalars(g);
+    DistMatrix<Base<F>> signature(g);
+    Matrix<F> householderScalarsSeq;
+    Matrix<Base<F>> signatureSeq;
+    BatchedQR( k, n, B, householderScalars, signature );
+    BatchedQR
+    ( k, n, B_STAR_STAR.Matrix(), householderScalarsSeq, signatureSeq );
+    CheckMember
+    ( "Distributed BatchedQR",
+      DistMatrix<F,STAR,STAR>(B).Matrix(), B_STAR_STAR.Matrix() );
+    CheckMember
+    ( "Distributed BatchedQR",
+      DistMatrix<F,STAR,STAR>(householderScalars).Matrix(),
+      householderScalarsSeq );
+    CheckMember
+    ( "Distributed BatchedQR",
+      DistMatrix<Base<F>,STAR,STAR>(signature).Matrix(), signatureSeq );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int m = Input("--m","height of each member",8);
+        const Int n = Input("--n","width of the non-square members",5);
+        const Int batchSize = Input("--batchSize","number of members",1000);
+        const bool print = Input("--print","print matrices?",false);
+        const bool sequential = Input("--sequential","test sequential?",true);
+        ProcessInput();
+        PrintInputReport();
+
+        const Grid g( comm );
+        ComplainIfDebug();
+
+        if( sequential && mpi::Rank(comm) == 0 )
+        {
+            TestSequentialBatched<float>( m, n, batchSize, print );
+            TestSequentialBatched<Complex<float>>( m, n, batchSize, print );
+            TestSequentialBatched<double>( m, n, batchSize, print );
+            TestSequentialBatched<Complex<double>>( m, n, batchSize, print );
+#ifdef EL_HAVE_QD
+            TestSequentialBatched<DoubleDouble>( m, n, batchSize, print );
+            TestSequentialBatched<QuadDouble>( m, n, batchSize, print );
+#endif
+#ifdef EL_HAVE_QUAD
+            TestSequentialBatched<Quad>( m, n, batchSize, print );
+#endif
+        }
+
+        TestBatched<float>( g, m, n, batchSize );
+        TestBatched<Complex<float>>( g, m, n, batchSize );
+        TestBatched<double>( g, m, n, batchSize );
+        TestBatched<Complex<double>>( g, m, n, batchSize );
+#ifdef EL_HAVE_QD
+        TestBatched<DoubleDouble>( g, m, n, batchSize );
+        TestBatched<QuadDouble>( g, m, n, batchSize );
+#endif
+#ifdef EL_HAVE_QUAD
+        TestBatched<Quad>( g, m, n, batchSize );
+#endif
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
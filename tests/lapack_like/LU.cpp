@@ -35,7 +35,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -82,7 +82,7 @@ void TestCorrectness
     const Real oneNormY = OneNorm( Y );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, P, Y );
     else
         lu::SolveAfter( NORMAL, A, P, Q, Y );
@@ -135,6 +135,8 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+        LU( A, P, LU_TOURNAMENT );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
     const double gFlops = ( IsComplex<F>::value ? 4*realGFlops : realGFlops );
@@ -208,6 +210,8 @@ void TestLU
         LU( A, P );
     else if( pivoting == 2 )
         LU( A, P, Q );
+    else if( pivoting == 3 )
+        LU( A, P, LU_TOURNAMENT );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = 2./3.*Pow(double(m),3.)/(1.e9*runTime);
@@ -248,6 +252,219 @@ void TestLU
     PopIndent();
 }
 
+template<typename F>
+void TestTSTournament( const Grid& g, Int m, Int n, bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing tall-skinny CALU with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F,VC,STAR> A(g);
+    DistPermutation P(g);
+    Uniform( A, m, n );
+    DistMatrix<F> AOrig( A );
+    if( print )
+        Print( A, "A" );
+
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    LU( A, P, LU_TOURNAMENT );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+
+    // Check || P A - L U ||_F / || A ||_F
+    DistMatrix<F> L( A ), U(g);
+    U = L( IR(0,n), ALL );
+    MakeTrapezoidal( LOWER, L, -1 );
+    FillDiagonal( L, F(1) );
+    MakeTrapezoidal( UPPER, U );
+    const Real frobA = FrobeniusNorm( AOrig );
+    P.PermuteRows( AOrig );
+    Gemm( NORMAL, NORMAL, F(-1), L, U, F(1), AOrig );
+    const Real relError = FrobeniusNorm( AOrig ) / frobA;
+    OutputFromRoot(g.Comm(),"|| P A - L U ||_F / || A ||_F = ",relError);
+    if( relError > Real(m)*limits::Epsilon<Real>()*Real(100) )
+        LogicError("Relative error was unacceptably large");
+
+    PopIndent();
+}
+
+template<typename F>
+void TestMixedLinearSolve
+( Int m,
+  LinearSolveRefineAlg refineAlg,
+  Int numRHS=10 )
+{
+    typedef Base<F> Real;
+    Output("Testing sequential mixed-precision LinearSolve with ",
+           TypeName<F>());
+    PushIndent();
+
+    Matrix<F> A, X;
+    Uniform( A, m, m );
+    Uniform( X, m, numRHS );
+    auto Y( X );
+
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = true;
+    ctrl.refineAlg = refineAlg;
+    ctrl.fallback = false;
+    Timer timer;
+    timer.Start();
+    LinearSolve( A, Y, ctrl );
+    Output(timer.Stop()," seconds");
+
+    // Now investigate the residual, ||A Y - X||_oo
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+    const Real oneNormY = OneNorm( Y );
+    Gemm( NORMAL, NORMAL, F(-1), A, Y, F(1), X );
+    const Real infError = InfinityNorm( X );
+    const Real relError = infError / (eps*m*Max(oneNormA,oneNormY));
+    Output("|| Y - A X ||_oo / (eps m Max(||A||_1,||Y||_1)) = ",relError);
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+
+    PopIndent();
+}
+
+template<typename F>
+void TestMixedLinearSolve
+( const Grid& g,
+  Int m,
+  LinearSolveRefineAlg refineAlg,
+  Int numRHS=10 )
+{
+    typedef Base<F> Real;
+    OutputFromRoot
+    (g.Comm(),"Testing mixed-precision LinearSolve with ",TypeName<F>());
+    PushIndent();
+
+    DistMatrix<F> A(g), X(g);
+    Uniform( A, m, m );
+    Uniform( X, m, numRHS );
+    auto Y( X );
+
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = true;
+    ctrl.refineAlg = refineAlg;
+    ctrl.fallback = false;
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    LinearSolve( A, Y, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),timer.Stop()," seconds");
+
+    // Now investigate the residual, ||A Y - X||_oo
+    const Real eps = limits::Epsilon<Real>();
+    const Real oneNormA = OneNorm( A );
+    const Real oneNormY = OneNorm( Y );
+    Gemm( NORMAL, NORMAL, F(-1), A, Y, F(1), X );
+    const Real infError = InfinityNorm( X );
+    const Real relError = infError / (eps*m*Max(oneNormA,oneNormY));
+    OutputFromRoot
+    (g.Comm(),
+     "|| Y - A X ||_oo / (eps m Max(||A||_1,||Y||_1)) = ",relError);
+    if( relError > Real(100) )
+        LogicError("Relative error was unacceptably large");
+
+    PopIndent();
+}
+
+// A = U diag(sigma) V^H with singular values graded from 1 down to 1e-10,
+// which is too ill-conditioned for a single-precision factorization to be
+// refined to double precision
+template<typename F>
+void MakeIllConditioned( Matrix<F>& A, Int m )
+{
+    typedef Base<F> Real;
+    Matrix<F> U, V;
+    Gaussian( U, m, m );
+    Gaussian( V, m, m );
+    qr::ExplicitUnitary( U );
+    qr::ExplicitUnitary( V );
+    Matrix<Real> sigma;
+    sigma.Resize( m, 1 );
+    for( Int j=0; j<m; ++j )
+        sigma(j) = Pow(Real(10),-Real(10*j)/Real(Max(m-1,Int(1))));
+    DiagonalScale( RIGHT, NORMAL, sigma, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, A );
+}
+
+template<typename F>
+void MakeIllConditioned( DistMatrix<F>& A, Int m )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    DistMatrix<F> U(g), V(g);
+    Gaussian( U, m, m );
+    Gaussian( V, m, m );
+    qr::ExplicitUnitary( U );
+    qr::ExplicitUnitary( V );
+    DistMatrix<Real,VR,STAR> sigma(g);
+    sigma.Resize( m, 1 );
+    for( Int j=0; j<m; ++j )
+        sigma.Set( j, 0, Pow(Real(10),-Real(10*j)/Real(Max(m-1,Int(1)))) );
+    DiagonalScale( RIGHT, NORMAL, sigma, U );
+    Gemm( NORMAL, ADJOINT, F(1), U, V, A );
+}
+
+// Refinement of an ill-conditioned system should report its failure when
+// 'fallback' is disabled and otherwise fall back to a working-precision
+// factorization with a small normwise backward error
+template<typename F,class MatrixType>
+void CheckMixedFallback
+( const MatrixType& A, const MatrixType& X, const string& prefix )
+{
+    typedef Base<F> Real;
+    LinearSolveCtrl<Real> ctrl;
+    ctrl.mixedPrecision = true;
+    ctrl.fallback = false;
+    auto Y( X );
+    bool reported = false;
+    try { LinearSolve( A, Y, ctrl ); }
+    catch( std::runtime_error& ) { reported = true; }
+    if( !reported )
+        LogicError
+        (prefix,"refinement of an ill-conditioned system did not fail");
+
+    Y = X;
+    ctrl.fallback = true;
+    LinearSolve( A, Y, ctrl );
+    auto R( X );
+    Gemm( NORMAL, NORMAL, F(-1), A, Y, F(1), R );
+    const Real backwardError =
+      FrobeniusNorm(R) / (FrobeniusNorm(A)*FrobeniusNorm(Y)+FrobeniusNorm(X));
+    if( backwardError > ctrl.relTol )
+        LogicError
+        (prefix,"fallback only reached a backward error of ",backwardError);
+}
+
+template<typename F>
+void TestMixedFallback( Int m, Int numRHS=2 )
+{
+    Output("Testing the sequential mixed-precision fallback with ",
+           TypeName<F>());
+    Matrix<F> A, X;
+    MakeIllConditioned( A, m );
+    Uniform( X, m, numRHS );
+    CheckMixedFallback<F>( A, X, "Sequential " );
+}
+
+template<typename F>
+void TestMixedFallback( const Grid& g, Int m, Int numRHS=2 )
+{
+    OutputFromRoot
+    (g.Comm(),"Testing the mixed-precision fallback with ",TypeName<F>());
+    DistMatrix<F> A(g), X(g);
+    MakeIllConditioned( A, m );
+    Uniform( X, m, numRHS );
+    CheckMixedFallback<F>( A, X, "Distributed " );
+}
+
 int 
 main( int argc, char* argv[] )
 {
@@ -260,19 +477,22 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot =
+          Input("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool sequential = Input("--sequential","test sequential?",true);
         const bool correctness = 
           Input("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
+        const bool mixed =
+          Input("--mixed","test mixed-precision LinearSolve?",true);
 #ifdef EL_HAVE_MPC
         const mpfr_prec_t prec = Input("--prec","MPFR precision",256);
 #endif
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
 #ifdef EL_HAVE_MPC
@@ -291,6 +511,8 @@ main( int argc, char* argv[] )
             OutputFromRoot(g.Comm(),"Testing LU with partial pivoting");
         else if( pivot == 2 )
             OutputFromRoot(g.Comm(),"Testing LU with full pivoting");
+        else if( pivot == 3 )
+            OutputFromRoot(g.Comm(),"Testing LU with tournament pivoting");
 
         if( sequential && mpi::Rank() == 0 )
         {
@@ -341,6 +563,39 @@ main( int argc, char* argv[] )
         TestLU<Complex<double>>
         ( g, m, pivot, correctness, forceGrowth, print );
 
+        // Tournament pivoting is checked alongside whichever strategy was
+        // requested, including on a tall-skinny panel
+        if( pivot != 3 )
+        {
+            OutputFromRoot(g.Comm(),"Testing LU with tournament pivoting");
+            TestLU<double>( g, m, 3, true, false, print );
+            TestLU<Complex<double>>( g, m, 3, true, false, print );
+        }
+        TestTSTournament<double>( g, 10*m, Max(m/10,Int(1)), print );
+        TestTSTournament<Complex<double>>( g, 10*m, Max(m/10,Int(1)), print );
+
+        if( mixed )
+        {
+            if( mpi::Rank() == 0 )
+            {
+                TestMixedLinearSolve<double>
+                ( m, LINEAR_SOLVE_REFINE_CLASSICAL );
+                TestMixedLinearSolve<double>
+                ( m, LINEAR_SOLVE_REFINE_FGMRES );
+                TestMixedLinearSolve<Complex<double>>
+                ( m, LINEAR_SOLVE_REFINE_CLASSICAL );
+                TestMixedFallback<double>( m );
+            }
+            TestMixedLinearSolve<double>
+            ( g, m, LINEAR_SOLVE_REFINE_CLASSICAL );
+            TestMixedLinearSolve<double>
+            ( g, m, LINEAR_SOLVE_REFINE_FGMRES );
+            TestMixedLinearSolve<Complex<double>>
+            ( g, m, LINEAR_SOLVE_REFINE_CLASSICAL );
+            TestMixedFallback<double>( g, m );
+            TestMixedFallback<Complex<double>>( g, m );
+        }
+
 #ifdef EL_HAVE_QD
         TestLU<DoubleDouble>
         ( g, m, pivot, correctness, forceGrowth, print );
@@ -0,0 +1,177 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Solving with a single-precision factorization (either demoted from the
+// double-precision one or computed directly from a single-precision copy of
+// the regularized matrix) should still drive the residual of the
+// double-precision system down to that reached by solving with the
+// double-precision factorization
+template<typename Real>
+void CheckResiduals
+( const string& name,
+  Real residNorm, Real residNormLow, const RegSolveCtrl<Real>& ctrl )
+{
+    if( residNorm > ctrl.relTol )
+        LogicError
+        (name," solve only reduced the residual to ",residNorm);
+    if( residNormLow > Max(Real(10)*residNorm,ctrl.relTol) )
+        LogicError
+        (name," mixed-precision solve only reduced the residual to ",
+         residNormLow," rather than ",residNorm);
+}
+
+template<typename F>
+void TestSequential( Int n1, Int n2, Int n3, Int numRHS, bool progress )
+{
+    typedef Base<F> Real;
+    Output("Testing sequential solves with ",TypeName<F>());
+    PushIndent();
+    const Int N = n1*n2*n3;
+
+    SparseMatrix<F> A;
+    Laplacian( A, n1, n2, n3 );
+    A *= F(-1);
+    Matrix<Real> reg;
+    Ones( reg, N, 1 );
+    reg *= Sqrt(limits::Epsilon<Real>());
+    SparseMatrix<F> J( A );
+    UpdateRealPartOfDiagonal( J, Real(1), reg );
+
+    vector<Int> map, invMap;
+    ldl::NodeInfo info;
+    ldl::Separator rootSep;
+    ldl::NestedDissection( J.LockedGraph(), map, rootSep, info );
+    InvertMap( map, invMap );
+    ldl::Front<F> front( J, map, info );
+    LDL( info, front, LDL_2D );
+    ldl::Front<Demote<F>> frontLow;
+    ldl::DemoteFronts( front, frontLow );
+    SparseMatrix<Demote<F>> JLow;
+    Copy( J, JLow );
+    ldl::Front<Demote<F>> frontDirect( JLow, map, info );
+    LDL( info, frontDirect, LDL_2D );
+
+    Matrix<F> B;
+    Uniform( B, N, numRHS );
+    const Real BNorm = FrobeniusNorm( B );
+    RegSolveCtrl<Real> ctrl;
+    ctrl.progress = progress;
+
+    Matrix<F> X( B ), XLow( B ), XDirect( B );
+    reg_ldl::SolveAfter( A, reg, invMap, info, front, X, ctrl );
+    reg_ldl::SolveAfter( A, reg, invMap, info, frontLow, XLow, ctrl );
+    reg_ldl::SolveAfter( A, reg, invMap, info, frontDirect, XDirect, ctrl );
+
+    Matrix<F> R( B ), RLow( B ), RDirect( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    Multiply( NORMAL, F(-1), A, XLow, F(1), RLow );
+    Multiply( NORMAL, F(-1), A, XDirect, F(1), RDirect );
+    const Real residNorm = FrobeniusNorm( R ) / BNorm;
+    const Real residNormLow = FrobeniusNorm( RLow ) / BNorm;
+    const Real residNormDirect = FrobeniusNorm( RDirect ) / BNorm;
+    Output("|| B - A X ||_F / || B ||_F = ",residNorm);
+    Output("|| B - A XLow ||_F / || B ||_F = ",residNormLow);
+    Output("|| B - A XDirect ||_F / || B ||_F = ",residNormDirect);
+    CheckResiduals( "Sequential demoted", residNorm, residNormLow, ctrl );
+    CheckResiduals( "Sequential direct", residNorm, residNormDirect, ctrl );
+    PopIndent();
+}
+
+template<typename F>
+void TestDistributed
+( Int n1, Int n2, Int n3, Int numRHS, bool progress, mpi::Comm comm )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(comm,"Testing distributed solves with ",TypeName<F>());
+    PushIndent();
+    const Int N = n1*n2*n3;
+
+    DistSparseMatrix<F> A(comm);
+    Laplacian( A, n1, n2, n3 );
+    A *= F(-1);
+    DistMultiVec<Real> reg(comm);
+    Ones( reg, N, 1 );
+    reg *= Sqrt(limits::Epsilon<Real>());
+    DistSparseMatrix<F> J( A );
+    UpdateRealPartOfDiagonal( J, Real(1), reg );
+
+    DistMap map, invMap;
+    ldl::DistNodeInfo info;
+    ldl::DistSeparator rootSep;
+    ldl::NestedDissection( J.LockedDistGraph(), map, rootSep, info );
+    InvertMap( map, invMap );
+    ldl::DistFront<F> front( J, map, rootSep, info );
+    LDL( info, front, LDL_2D );
+    ldl::DistFront<Demote<F>> frontLow;
+    ldl::DemoteFronts( front, frontLow );
+    DistSparseMatrix<Demote<F>> JLow(comm);
+    Copy( J, JLow );
+    ldl::DistFront<Demote<F>> frontDirect( JLow, map, rootSep, info );
+    LDL( info, frontDirect, LDL_2D );
+
+    DistMultiVec<F> B(comm);
+    Uniform( B, N, numRHS );
+    const Real BNorm = FrobeniusNorm( B );
+    RegSolveCtrl<Real> ctrl;
+    ctrl.progress = progress;
+
+    DistMultiVec<F> X( B ), XLow( B ), XDirect( B );
+    ldl::DistMultiVecNodeMeta meta;
+    reg_ldl::SolveAfter( A, reg, invMap, info, front, X, meta, ctrl );
+    reg_ldl::SolveAfter( A, reg, invMap, info, frontLow, XLow, meta, ctrl );
+    reg_ldl::SolveAfter
+    ( A, reg, invMap, info, frontDirect, XDirect, meta, ctrl );
+
+    DistMultiVec<F> R( B ), RLow( B ), RDirect( B );
+    Multiply( NORMAL, F(-1), A, X, F(1), R );
+    Multiply( NORMAL, F(-1), A, XLow, F(1), RLow );
+    Multiply( NORMAL, F(-1), A, XDirect, F(1), RDirect );
+    const Real residNorm = FrobeniusNorm( R ) / BNorm;
+    const Real residNormLow = FrobeniusNorm( RLow ) / BNorm;
+    const Real residNormDirect = FrobeniusNorm( RDirect ) / BNorm;
+    OutputFromRoot(comm,"|| B - A X ||_F / || B ||_F = ",residNorm);
+    OutputFromRoot(comm,"|| B - A XLow ||_F / || B ||_F = ",residNormLow);
+    OutputFromRoot
+    (comm,"|| B - A XDirect ||_F / || B ||_F = ",residNormDirect);
+    CheckResiduals( "Distributed demoted", residNorm, residNormLow, ctrl );
+    CheckResiduals
+    ( "Distributed direct", residNorm, residNormDirect, ctrl );
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",10);
+        const Int n2 = Input("--n2","second grid dimension",10);
+        const Int n3 = Input("--n3","third grid dimension",10);
+        const Int numRHS = Input("--numRHS","number of right-hand sides",2);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequential<double>( n1, n2, n3, numRHS, progress );
+            TestSequential<Complex<double>>( n1, n2, n3, numRHS, progress );
+        }
+        TestDistributed<double>( n1, n2, n3, numRHS, progress, comm );
+        TestDistributed<Complex<double>>( n1, n2, n3, numRHS, progress, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
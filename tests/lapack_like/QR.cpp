@@ -171,7 +171,8 @@ void TestQR
   Int n,
   bool correctness,
   bool print,
-  bool scalapack )
+  bool scalapack,
+  bool caqr )
 {
     OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
     PushIndent();
@@ -208,7 +209,9 @@ void TestQR
     OutputFromRoot(g.Comm(),"Starting QR factorization...");
     mpi::Barrier( g.Comm() );
     timer.Start();
-    QR( A, householderScalars, signature );
+    QRCtrl<Base<F>> ctrl;
+    ctrl.communicationAvoiding = caqr;
+    QR( A, householderScalars, signature, ctrl );
     mpi::Barrier( g.Comm() );
     const double runTime = timer.Stop();
     const double realGFlops = (2.*mD*nD*nD - 2./3.*nD*nD*nD)/(1.e9*runTime);
@@ -346,14 +349,26 @@ main( int argc, char* argv[] )
         }
 
         TestQR<float>
-        ( g, m, n, correctness, print, scalapack );
+        ( g, m, n, correctness, print, scalapack, false );
         TestQR<Complex<float>>
-        ( g, m, n, correctness, print, scalapack );
+        ( g, m, n, correctness, print, scalapack, false );
 
         TestQR<double>
-        ( g, m, n, correctness, print, scalapack );
+        ( g, m, n, correctness, print, scalapack, false );
         TestQR<Complex<double>>
-        ( g, m, n, correctness, print, scalapack );
+        ( g, m, n, correctness, print, scalapack, false );
+
+        // CAQR, both on the requested matrix and on one tall enough for TSQR
+        // to factor the leading panels (which requires a height of at least
+        // the process column size times the blocksize)
+        OutputFromRoot(g.Comm(),"Testing communication-avoiding QR");
+        const Int mTall = Max( m, 4*g.Height()*nb );
+        TestQR<float>( g, m, n, true, print, false, true );
+        TestQR<Complex<float>>( g, m, n, true, print, false, true );
+        TestQR<double>( g, m, n, true, print, false, true );
+        TestQR<Complex<double>>( g, m, n, true, print, false, true );
+        TestQR<double>( g, mTall, n, true, print, false, true );
+        TestQR<Complex<double>>( g, mTall, n, true, print, false, true );
 
 #ifdef EL_HAVE_QD
         TestQR<DoubleDouble>
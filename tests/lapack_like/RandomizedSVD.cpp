@@ -0,0 +1,330 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A,
+  const DistMatrix<F>& U,
+  const DistMatrix<Base<F>,VR,STAR>& s,
+  const DistMatrix<F>& V,
+  Base<F> errorEst,
+  Base<F> tol,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int k = s.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobNormA = FrobeniusNorm( A );
+
+    // Form I - U^H U and I - V^H V
+    DistMatrix<F> Z(g);
+    Identity( Z, k, k );
+    Herk( UPPER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real orthogUError = HermitianFrobeniusNorm( UPPER, Z );
+    Identity( Z, k, k );
+    Herk( UPPER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real orthogVError = HermitianFrobeniusNorm( UPPER, Z );
+    OutputFromRoot
+    (g.Comm(),"||U' U - I||_F = ",orthogUError,", ||V' V - I||_F = ",
+     orthogVError);
+
+    // Form A - U S V^H
+    auto E( A );
+    auto VCopy( V );
+    DiagonalScale( RIGHT, NORMAL, s, VCopy );
+    Gemm( NORMAL, ADJOINT, F(-1), U, VCopy, F(1), E );
+    if( print )
+        Print( E, "A - U S V'" );
+    const Real relError = FrobeniusNorm( E ) / frobNormA;
+    OutputFromRoot
+    (g.Comm(),"rank ",k,": ||A - U S V'||_F / ||A||_F = ",relError,
+     " (estimated ",errorEst/frobNormA,")");
+
+    if( orthogUError > Sqrt(eps) || orthogVError > Sqrt(eps) )
+        LogicError("Unacceptably large orthogonality error");
+    if( relError > tol )
+        LogicError("Unacceptably large relative error");
+}
+
+template<typename F>
+void TestCorrectness
+( const Matrix<F>& A,
+  const Matrix<F>& U,
+  const Matrix<Base<F>>& s,
+  const Matrix<F>& V,
+  Base<F> errorEst,
+  Base<F> tol,
+  bool print )
+{
+    typedef Base<F> Real;
+    const Int k = s.Height();
+    const Real eps = limits::Epsilon<Real>();
+    const Real frobNormA = FrobeniusNorm( A );
+
+    // Form I - U^H U and I - V^H V
+    Matrix<F> Z;
+    Identity( Z, k, k );
+    Herk( UPPER, ADJOINT, Real(-1), U, Real(1), Z );
+    const Real orthogUError = HermitianFrobeniusNorm( UPPER, Z );
+    Identity( Z, k, k );
+    Herk( UPPER, ADJOINT, Real(-1), V, Real(1), Z );
+    const Real orthogVError = HermitianFrobeniusNorm( UPPER, Z );
+    Output
+    ("||U' U - I||_F = ",orthogUError,", ||V' V - I||_F = ",orthogVError);
+
+    // Form A - U S V^H
+    auto E( A );
+    auto VCopy( V );
+    DiagonalScale( RIGHT, NORMAL, s, VCopy );
+    Gemm( NORMAL, ADJOINT, F(-1), U, VCopy, F(1), E );
+    if( print )
+        Print( E, "A - U S V'" );
+    const Real error = FrobeniusNorm( E );
+    const Real relError = error / frobNormA;
+    Output
+    ("rank ",k,": ||A - U S V'||_F / ||A||_F = ",relError,
+     " (estimated ",errorEst/frobNormA,")");
+
+    if( orthogUError > Sqrt(eps) || orthogVError > Sqrt(eps) )
+        LogicError("Unacceptably large orthogonality error");
+    if( relError > tol )
+        LogicError("Unacceptably large relative error");
+    // The estimate is formed from a difference of squared norms
+    if( Abs(errorEst-error) > Real(10)*Sqrt(eps)*frobNormA )
+        LogicError("Inaccurate error estimate");
+}
+
+template<typename F>
+void TestRandomizedSVD
+( const Grid& g,
+  Int m,
+  Int n,
+  Int rank,
+  bool print )
+{
+    typedef Base<F> Real;
+    OutputFromRoot(g.Comm(),"Testing with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form a matrix of the given rank with a graded spectrum
+    DistMatrix<F> X(g), Y(g), A(g);
+    DistMatrix<Base<F>,VR,STAR> d(g);
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    qr::ExplicitUnitary( X );
+    qr::ExplicitUnitary( Y );
+    d.Resize( rank, 1 );
+    for( Int j=0; j<rank; ++j )
+        d.Set( j, 0, Pow(Real(2),-Real(j)/Real(4)) );
+    DiagonalScale( RIGHT, NORMAL, d, X );
+    Zeros( A, m, n );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+    if( print )
+        Print( A, "A" );
+
+    DistMatrix<F> U(g), V(g);
+    DistMatrix<Real,VR,STAR> s(g);
+    RandomizedSVDCtrl<Real> ctrl;
+
+    OutputFromRoot(g.Comm(),"Fixed-rank randomized SVD...");
+    PushIndent();
+    ctrl.rank = rank;
+    mpi::Barrier( g.Comm() );
+    Timer timer;
+    timer.Start();
+    Real errorEst = RandomizedSVD( A, U, s, V, ctrl );
+    mpi::Barrier( g.Comm() );
+    OutputFromRoot(g.Comm(),"Time = ",timer.Stop()," seconds");
+    TestCorrectness( A, U, s, V, errorEst, Sqrt(eps), print );
+    PopIndent();
+
+    OutputFromRoot(g.Comm(),"Adaptive randomized SVD...");
+    PushIndent();
+    ctrl.adaptive = true;
+    ctrl.tol = Real(10)*Sqrt(eps);
+    ctrl.blocksize = Max( Int(1), rank/4 );
+    timer.Start();
+    errorEst = RandomizedSVD( A, U, s, V, ctrl );
+    OutputFromRoot(g.Comm(),"Time = ",timer.Stop()," seconds");
+    TestCorrectness( A, U, s, V, errorEst, Real(2)*ctrl.tol, print );
+    PopIndent();
+
+    OutputFromRoot(g.Comm(),"Randomized Hermitian eigensolver...");
+    PushIndent();
+    DistMatrix<F> H(g), XScaled(g), Z(g);
+    DistMatrix<Real,VR,STAR> w(g);
+    Gaussian( X, n, rank );
+    qr::ExplicitUnitary( X );
+    for( Int j=0; j<rank; ++j )
+        d.Set( j, 0, (j%2==0 ? Real(1) : Real(-1))*Pow(Real(2),-Real(j)) );
+    XScaled = X;
+    DiagonalScale( RIGHT, NORMAL, d, XScaled );
+    Zeros( H, n, n );
+    Gemm( NORMAL, ADJOINT, F(1), XScaled, X, F(0), H );
+    ctrl.adaptive = false;
+    ctrl.rank = rank;
+    errorEst = RandomizedHermitianEig( LOWER, H, w, Z, ctrl );
+    auto E( H );
+    auto ZScaled( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZScaled );
+    Gemm( NORMAL, ADJOINT, F(-1), ZScaled, Z, F(1), E );
+    const Real relError = FrobeniusNorm( E ) / FrobeniusNorm( H );
+    OutputFromRoot
+    (g.Comm(),"||H - Z W Z'||_F / ||H||_F = ",relError,
+     " (estimated ",errorEst/FrobeniusNorm(H),")");
+    if( relError > Sqrt(eps) )
+        LogicError("Unacceptably large relative error");
+    PopIndent();
+
+    PopIndent();
+}
+
+template<typename F>
+void TestSequentialRandomizedSVD( Int m, Int n, Int rank, bool print )
+{
+    typedef Base<F> Real;
+    Output("Testing sequential routines with ",TypeName<F>());
+    PushIndent();
+    const Real eps = limits::Epsilon<Real>();
+
+    // Form a matrix of the given rank with a graded spectrum
+    Matrix<F> X, Y, A;
+    Matrix<Real> d;
+    Gaussian( X, m, rank );
+    Gaussian( Y, n, rank );
+    qr::ExplicitUnitary( X );
+    qr::ExplicitUnitary( Y );
+    d.Resize( rank, 1 );
+    for( Int j=0; j<rank; ++j )
+        d(j) = Pow(Real(2),-Real(j)/Real(4));
+    DiagonalScale( RIGHT, NORMAL, d, X );
+    Zeros( A, m, n );
+    Gemm( NORMAL, ADJOINT, F(1), X, Y, F(0), A );
+    if( print )
+        Print( A, "A" );
+    const Real frobNormA = FrobeniusNorm( A );
+    RandomizedSVDCtrl<Real> ctrl;
+    ctrl.rank = rank;
+
+    Output("Randomized range finder...");
+    PushIndent();
+    Matrix<F> Q;
+    Real errorEst = RandomizedRangeFinder( A, Q, ctrl );
+    Matrix<F> Z;
+    Identity( Z, Q.Width(), Q.Width() );
+    Herk( UPPER, ADJOINT, Real(-1), Q, Real(1), Z );
+    const Real orthogError = HermitianFrobeniusNorm( UPPER, Z );
+    Matrix<F> QHA, E( A );
+    Gemm( ADJOINT, NORMAL, F(1), Q, A, QHA );
+    Gemm( NORMAL, NORMAL, F(-1), Q, QHA, F(1), E );
+    Real error = FrobeniusNorm( E );
+    Output
+    ("||Q' Q - I||_F = ",orthogError,", ||A - Q Q' A||_F / ||A||_F = ",
+     error/frobNormA," (estimated ",errorEst/frobNormA,")");
+    if( orthogError > Sqrt(eps) )
+        LogicError("Unacceptably large orthogonality error");
+    if( error > Sqrt(eps)*frobNormA )
+        LogicError("Unacceptably large relative error");
+    if( Abs(errorEst-error) > Real(10)*Sqrt(eps)*frobNormA )
+        LogicError("Inaccurate error estimate");
+    PopIndent();
+
+    Output("Fixed-rank randomized SVD...");
+    PushIndent();
+    Matrix<F> U, V;
+    Matrix<Real> s;
+    errorEst = RandomizedSVD( A, U, s, V, ctrl );
+    TestCorrectness( A, U, s, V, errorEst, Sqrt(eps), print );
+    PopIndent();
+
+    Output("Adaptive randomized SVD...");
+    PushIndent();
+    ctrl.adaptive = true;
+    ctrl.tol = Real(10)*Sqrt(eps);
+    ctrl.blocksize = Max( Int(1), rank/4 );
+    errorEst = RandomizedSVD( A, U, s, V, ctrl );
+    TestCorrectness( A, U, s, V, errorEst, Real(2)*ctrl.tol, print );
+    PopIndent();
+
+    Output("Randomized Hermitian eigensolver...");
+    PushIndent();
+    Matrix<F> H, XScaled;
+    Matrix<Real> w;
+    Gaussian( X, n, rank );
+    qr::ExplicitUnitary( X );
+    for( Int j=0; j<rank; ++j )
+        d(j) = (j%2==0 ? Real(1) : Real(-1))*Pow(Real(2),-Real(j));
+    XScaled = X;
+    DiagonalScale( RIGHT, NORMAL, d, XScaled );
+    Zeros( H, n, n );
+    Gemm( NORMAL, ADJOINT, F(1), XScaled, X, F(0), H );
+    ctrl.adaptive = false;
+    ctrl.rank = rank;
+    errorEst = RandomizedHermitianEig( LOWER, H, w, Z, ctrl );
+    E = H;
+    auto ZScaled( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZScaled );
+    Gemm( NORMAL, ADJOINT, F(-1), ZScaled, Z, F(1), E );
+    const Real frobNormH = FrobeniusNorm( H );
+    error = FrobeniusNorm( E );
+    Output
+    ("||H - Z W Z'||_F / ||H||_F = ",error/frobNormH,
+     " (estimated ",errorEst/frobNormH,")");
+    if( error > Sqrt(eps)*frobNormH )
+        LogicError("Unacceptably large relative error");
+    if( Abs(errorEst-error) > Real(10)*Sqrt(eps)*frobNormH )
+        LogicError("Inaccurate error estimate");
+    PopIndent();
+
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",400);
+        const Int n = Input("--width","width of matrix",200);
+        const Int rank = Input("--rank","rank of matrix",20);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        if( mpi::Rank(comm) == 0 )
+        {
+            TestSequentialRandomizedSVD<float>( m, n, rank, print );
+            TestSequentialRandomizedSVD<Complex<float>>( m, n, rank, print );
+            TestSequentialRandomizedSVD<double>( m, n, rank, print );
+            TestSequentialRandomizedSVD<Complex<double>>
+            ( m, n, rank, print );
+        }
+        TestRandomizedSVD<float>( g, m, n, rank, print );
+        TestRandomizedSVD<Complex<float>>( g, m, n, rank, print );
+        TestRandomizedSVD<double>( g, m, n, rank, print );
+        TestRandomizedSVD<Complex<double>>( g, m, n, rank, print );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}
@@ -21,10 +21,199 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include <El.hpp>
+#include <map>
 using namespace El;
 
 // TODO(poulson): Modernize this test driver
 
+// The order in which the children of a node are processed and how many of
+// them have their updates held until the update matrix of the node is formed
+struct ChildChoice
+{
+    vector<Int> order;
+    Int numStacked=0;
+};
+typedef std::map<const ldl::NodeInfo*,ChildChoice> ChildChoices;
+
+// Replay the allocations and frees of the update matrices (and of the copy
+// made while factoring each front) of the sequential factorization of a
+// subtree, tracking the current and peak numbers of work entries. The
+// update matrix of the node is left allocated.
+void ReplayPeak
+( const ldl::NodeInfo& node, const ChildChoices& choices,
+  double& current, double& peak )
+{
+    const Int numChildren = node.children.size();
+    const double lowerSize = node.lowerStruct.size();
+    const double updateEntries = lowerSize*lowerSize;
+    const ChildChoice noChildren;
+    const ChildChoice& choice =
+      ( numChildren == 0 ? noChildren : choices.at(&node) );
+    double stackedEntries = 0;
+    for( Int t=0; t<=numChildren; ++t )
+    {
+        if( t == choice.numStacked )
+        {
+            // Form our update matrix and add the held updates into it
+            current += updateEntries;
+            peak = Max( peak, current );
+            current -= stackedEntries;
+        }
+        if( t == numChildren )
+            break;
+        const ldl::NodeInfo& child = *node.children[choice.order[t]];
+        ReplayPeak( child, choices, current, peak );
+        const double childLowerSize = child.lowerStruct.size();
+        if( t < choice.numStacked )
+            stackedEntries += childLowerSize*childLowerSize;
+        else
+            current -= childLowerSize*childLowerSize;
+    }
+    peak = Max( peak, current+lowerSize*node.size );
+}
+
+double ReplayPeak( const ldl::NodeInfo& root, const ChildChoices& choices )
+{
+    double current=0, peak=0;
+    ReplayPeak( root, choices, current, peak );
+    return peak;
+}
+
+// The choices made by the analysis
+void AnalyzedChoices( const ldl::NodeInfo& node, ChildChoices& choices )
+{
+    if( node.children.empty() )
+        return;
+    auto& choice = choices[&node];
+    choice.order = node.childOrder;
+    choice.numStacked = node.numStackedChildren;
+    for( const auto* child : node.children )
+        AnalyzedChoices( *child, choices );
+}
+
+// A root with four children, two of which have three (leaf) children of
+// their own, with random sizes and original structures
+ldl::NodeInfo* SmallTree()
+{
+    auto* root = new ldl::NodeInfo;
+    for( Int c=0; c<4; ++c )
+    {
+        auto* child = new ldl::NodeInfo(root);
+        root->children.push_back( child );
+        if( c % 2 == 0 )
+            for( Int g=0; g<3; ++g )
+                child->children.push_back( new ldl::NodeInfo(child) );
+    }
+
+    // Number the variables in postorder
+    Int off = 0;
+    function<void(ldl::NodeInfo&)> number =
+      [&]( ldl::NodeInfo& node )
+      {
+          for( auto* child : node.children )
+              number( *child );
+          node.size = SampleUniform( Int(1), Int(9) );
+          node.off = off;
+          off += node.size;
+      };
+    number( *root );
+
+    // Couple each node to a random subset of the variables of its ancestors
+    function<void(ldl::NodeInfo&)> connect =
+      [&]( ldl::NodeInfo& node )
+      {
+          for( auto* anc=node.parent; anc!=nullptr; anc=anc->parent )
+              for( Int i=anc->off; i<anc->off+anc->size; ++i )
+                  if( SampleUniform( Int(0), Int(2) ) == 0 )
+                      node.origLowerStruct.push_back( i );
+          std::sort( node.origLowerStruct.begin(), node.origLowerStruct.end() );
+          for( auto* child : node.children )
+              connect( *child );
+      };
+    connect( *root );
+    return root;
+}
+
+// Compare the peak predicted for the analyzed child orders against replays
+// of every combination of child orders and numbers of held children. Liu's
+// ordering is only guaranteed to be optimal when every child is held, so the
+// prediction must lie between the overall minimum and the minimum with every
+// child held (and must not exceed the minimum for the natural orders).
+void TestChildOrdering( Int numTrees )
+{
+    Output("Testing the child ordering against a brute-force search");
+    PushIndent();
+    for( Int tree=0; tree<numTrees; ++tree )
+    {
+        unique_ptr<ldl::NodeInfo> root( SmallTree() );
+        ldl::Analysis( *root );
+
+        ChildChoices choices;
+        AnalyzedChoices( *root, choices );
+        const double predicted = root->peakWorkEntries;
+        const double replayed = ReplayPeak( *root, choices );
+        if( replayed != predicted )
+            LogicError
+            ("Predicted a peak of ",predicted," work entries but replaying "
+             "the analyzed child orders gave ",replayed);
+
+        vector<const ldl::NodeInfo*> parents;
+        for( const auto& entry : choices )
+            parents.push_back( entry.first );
+        double minPeak = std::numeric_limits<double>::max();
+        double minHeldPeak = minPeak, minNaturalPeak = minPeak;
+        function<void(Int,bool,bool)> search =
+          [&]( Int t, bool allHeld, bool natural )
+          {
+              if( t == Int(parents.size()) )
+              {
+                  const double peak = ReplayPeak( *root, choices );
+                  minPeak = Min( minPeak, peak );
+                  if( allHeld )
+                      minHeldPeak = Min( minHeldPeak, peak );
+                  if( natural )
+                      minNaturalPeak = Min( minNaturalPeak, peak );
+                  return;
+              }
+              auto& choice = choices[parents[t]];
+              const Int numChildren = parents[t]->children.size();
+              choice.order.resize( numChildren );
+              for( Int c=0; c<numChildren; ++c )
+                  choice.order[c] = c;
+              bool isNatural = true;
+              do
+              {
+                  for( Int k=0; k<=numChildren; ++k )
+                  {
+                      choice.numStacked = k;
+                      search
+                      ( t+1, allHeld && k == numChildren, natural && isNatural );
+                  }
+                  isNatural = false;
+              } while( std::next_permutation
+                       ( choice.order.begin(), choice.order.end() ) );
+          };
+        search( 0, true, true );
+
+        Output
+        ("tree ",tree,": predicted ",predicted,", minimum ",minPeak,
+         ", minimum with every child held ",minHeldPeak,
+         ", minimum in the natural order ",minNaturalPeak);
+        if( predicted < minPeak || predicted > minHeldPeak ||
+            predicted > minNaturalPeak )
+            LogicError("The analyzed child orders were not within the bounds");
+    }
+    PopIndent();
+}
+
+Int MaxFrontHeight( const ldl::NodeInfo& node )
+{
+    Int height = node.size + node.lowerStruct.size();
+    for( const auto* child : node.children )
+        height = Max( height, MaxFrontHeight(*child) );
+    return height;
+}
+
 template<typename F>
 void TestSparseDirect
 ( Int n1,
@@ -34,6 +223,7 @@ void TestSparseDirect
   bool solve2d,
   bool selInv,
   bool intraPiv, 
+  bool blr,
   Int nbFact,
   Int nbSolve,
   bool natural,
@@ -41,6 +231,8 @@ void TestSparseDirect
   bool unpack,
   bool print,
   bool display,
+  const string& spillFile,
+  const ldl::MultifrontalCtrl& frontCtrl,
   const BisectCtrl& ctrl,
   mpi::Comm comm )
 {
@@ -104,6 +296,35 @@ void TestSparseDirect
 
     const Int rootSepSize = info.size;
     OutputFromRoot(comm,rootSepSize," vertices in root separator\n");
+    const auto frontStats = ldl::GetFrontStatistics( info );
+    if( mpi::Rank(comm) == 0 )
+        ldl::PrintFrontStatistics( frontStats );
+    const auto memory = ldl::PredictMemory( info, frontCtrl );
+    const double maxPeakEntries =
+      mpi::AllReduce( memory.PeakEntries(), mpi::MAX, comm );
+    OutputFromRoot
+    (comm,"Predicted peak factorization memory per process: ",
+     maxPeakEntries*sizeof(F)/1e6," MB");
+
+    // The predicted peak of the local subtree should match a replay of the
+    // factorization in the analyzed child orders
+    const ldl::DistNodeInfo* distNode = &info;
+    Int maxFrontHeight = 0;
+    while( distNode->duplicate == nullptr )
+    {
+        const Int frontHeight = distNode->size + distNode->lowerStruct.size();
+        maxFrontHeight = Max( maxFrontHeight, frontHeight );
+        distNode = distNode->child;
+    }
+    const ldl::NodeInfo& localInfo = *distNode->duplicate;
+    maxFrontHeight = Max( maxFrontHeight, MaxFrontHeight(localInfo) );
+    ChildChoices choices;
+    AnalyzedChoices( localInfo, choices );
+    const double replayedPeak = ReplayPeak( localInfo, choices );
+    if( replayedPeak != localInfo.peakWorkEntries )
+        LogicError
+        ("Predicted a peak of ",localInfo.peakWorkEntries," work entries but "
+         "replaying the analyzed child orders gave ",replayedPeak);
     /*
     if( display )
     {
@@ -154,8 +375,14 @@ void TestSparseDirect
     SetBlocksize( nbFact );
     mpi::Barrier( comm );
     timer.Start();
+    ResetMemoryPoolStatistics();
+    const size_t liveBytesBefore = GetMemoryPoolStatistics().liveBytes;
     LDLFrontType type;
-    if( solve2d )
+    if( blr )
+    {
+        type = ( solve2d ? BLR_LDL_2D : BLR_LDL_1D );
+    }
+    else if( solve2d )
     {
         if( intraPiv )
             type = ( selInv ? LDL_INTRAPIV_SELINV_2D : LDL_INTRAPIV_2D );
@@ -169,7 +396,9 @@ void TestSparseDirect
         else
             type = ( selInv ? LDL_SELINV_1D : LDL_1D );
     }
-    LDL( info, front, type );
+    LDL( info, front, type, frontCtrl );
+    const size_t peakBytes =
+      GetMemoryPoolStatistics().peakLiveBytes - liveBytesBefore;
     mpi::Barrier( comm );
     const double factTime = timer.Stop();
     const double localFactGFlops = front.LocalFactorGFlops( selInv );
@@ -192,19 +421,60 @@ void TestSparseDirect
      "  max entries:   ",maxLocalEntriesAfter,"\n",Indent(),
      "  total entries: ",entriesAfter,"\n");
 
+    // The growth of the live memory during the factorization should be
+    // bounded by the prediction, which, in addition to the fronts that were
+    // already allocated, only omits the diagonals and the panel workspaces
+    // of the dense kernels. The entries of BigFloat matrices hold their
+    // mantissas elsewhere, and compressed fronts are not predicted.
+    if( !blr && IsPacked<F>::value )
+    {
+#ifdef EL_HYBRID
+        const double numThreads = omp_get_max_threads();
+#else
+        const double numThreads = 1;
+#endif
+        const double slackEntries = N + 4*numThreads*nbFact*maxFrontHeight;
+        const double boundBytes =
+          (memory.PeakEntries()+slackEntries)*sizeof(F);
+        OutputFromRoot
+        (comm,"Measured (predicted) peak work memory on process 0: ",
+         peakBytes/1e6," (",memory.peakWorkEntries*sizeof(F)/1e6,") MB");
+        if( peakBytes > boundBytes )
+            LogicError
+            ("Factorization memory grew by ",peakBytes," bytes, which "
+             "exceeded the predicted bound of ",boundBytes);
+    }
+
+    const bool spill = !spillFile.empty() && IsPacked<F>::value;
+    if( spill )
+    {
+        OutputFromRoot(comm,"Spilling the fronts to disk...");
+        mpi::Barrier( comm );
+        timer.Start();
+        ldl::SpillFronts( front, spillFile );
+        mpi::Barrier( comm );
+        OutputFromRoot(comm,timer.Stop()," seconds");
+    }
+
     OutputFromRoot(comm,"Solving against Y...");
+    DistMultiVec<F> B( Y );
     SetBlocksize( nbSolve );
     mpi::Barrier( comm );
     timer.Start();
-    ldl::SolveAfter( invMap, info, front, Y );
+    ldl::SolveAfter( invMap, info, front, Y, frontCtrl );
     mpi::Barrier( comm );
     const double solveTime = timer.Stop();
+    if( spill )
+        ldl::RestoreFronts( front );
     const double localSolveGFlops = front.LocalSolveGFlops( numRHS );
     const double solveGFlops = mpi::AllReduce( localSolveGFlops, comm ); 
     const double solveSpeed = solveGFlops / factTime;
     OutputFromRoot(comm,solveTime," seconds (",solveSpeed," GFlop/s)");
 
     OutputFromRoot(comm,"Checking error in computed solution...");
+    Multiply( NORMAL, F(-1), A, Y, F(1), B );
+    Matrix<Real> residNorms;
+    ColumnTwoNorms( B, residNorms );
     Matrix<Real> XNorms, YNorms;
     ColumnTwoNorms( X, XNorms );
     ColumnTwoNorms( Y, YNorms );
@@ -217,7 +487,99 @@ void TestSparseDirect
          "Right-hand side ",j,":\n",Indent(),
          "|| x     ||_2 = ",XNorms.Get(j,0),"\n",Indent(),
          "|| error ||_2 = ",errorNorms.Get(j,0),"\n",Indent(),
-         "|| A x   ||_2 = ",YOrigNorms.Get(j,0),"\n");
+         "|| A x   ||_2 = ",YOrigNorms.Get(j,0),"\n",Indent(),
+         "|| resid ||_2 = ",residNorms.Get(j,0),"\n");
+
+    // Only the compressed fronts are allowed to be less accurate than a
+    // backward-stable factorization
+    const Real eps = limits::Epsilon<Real>();
+    Real tol = Sqrt(eps);
+    if( blr )
+        tol = Max( tol, Real(1000*frontCtrl.blr.tol) );
+    for( int j=0; j<numRHS; ++j )
+        if( residNorms.Get(j,0) > tol*YOrigNorms.Get(j,0) )
+            LogicError
+            ("Relative residual of right-hand side ",j," was ",
+             residNorms.Get(j,0)/YOrigNorms.Get(j,0));
+}
+
+// Run the requested configuration along with those which it leaves disabled
+template<typename F>
+void RunTests
+( Int n1,
+  Int n2,
+  Int n3,
+  Int numRHS,
+  bool solve2d,
+  bool selInv,
+  bool intraPiv,
+  bool blr,
+  Int nbFact,
+  Int nbSolve,
+  bool natural,
+  Int cutoff,
+  bool unpack,
+  bool print,
+  bool display,
+  const string& spillFile,
+  const ldl::MultifrontalCtrl& frontCtrl,
+  const BisectCtrl& ctrl,
+  mpi::Comm comm )
+{
+    TestSparseDirect<F>
+    ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+      natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+      comm );
+
+    if( !frontCtrl.parallelTree )
+    {
+        OutputFromRoot(comm,"Task-parallel traversal of the subtrees");
+        ldl::MultifrontalCtrl treeCtrl( frontCtrl );
+        treeCtrl.parallelTree = true;
+        treeCtrl.minTaskSize = Min( frontCtrl.minTaskSize, Int(100) );
+        TestSparseDirect<F>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact,
+          nbSolve, natural, cutoff, false, false, false, spillFile, treeCtrl,
+          ctrl, comm );
+    }
+
+    // The analytical dissection does not amalgamate supernodes
+    if( natural || ctrl.relaxedFill <= 0 )
+    {
+        OutputFromRoot(comm,"Relaxed supernode amalgamation");
+        BisectCtrl relaxedCtrl( ctrl );
+        if( relaxedCtrl.relaxedFill <= 0 )
+            relaxedCtrl.relaxedFill = 0.25;
+        TestSparseDirect<F>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact,
+          nbSolve, false, cutoff, false, false, false, spillFile, frontCtrl,
+          relaxedCtrl, comm );
+    }
+
+    // Only the fronts of packed datatypes can be spilled
+    if( spillFile.empty() && IsPacked<F>::value )
+    {
+        OutputFromRoot(comm,"Out-of-core solves");
+        TestSparseDirect<F>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact,
+          nbSolve, natural, cutoff, false, false, false, "SparseLDL-spill",
+          frontCtrl, ctrl, comm );
+    }
+
+    // The default minimum front size is larger than any front of the
+    // default problem, so small tiles are needed for compression to occur
+    if( !blr )
+    {
+        OutputFromRoot(comm,"Block low-rank fronts");
+        ldl::MultifrontalCtrl blrCtrl( frontCtrl );
+        blrCtrl.blr.tol = 1e-10;
+        blrCtrl.blr.tileSize = 32;
+        blrCtrl.blr.minFrontSize = 128;
+        TestSparseDirect<F>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, true, nbFact,
+          nbSolve, natural, cutoff, false, false, false, spillFile, blrCtrl,
+          ctrl, comm );
+    }
 }
 
 int main( int argc, char* argv[] )
@@ -234,6 +596,12 @@ int main( int argc, char* argv[] )
         const bool solve2d = Input("--solve2d","use 2d solve?",false);
         const bool selInv = Input("--selInv","selectively invert?",false);
         const bool intraPiv = Input("--intraPiv","pivot within fronts?",false);
+        const bool blr = Input("--blr","block low-rank fronts?",false);
+        const double blrTol =
+          Input("--blrTol","relative tolerance for BLR tiles",1e-8);
+        const Int blrTileSize = Input("--blrTileSize","BLR tile size",256);
+        const Int blrMinSize =
+          Input("--blrMinSize","min. height of a compressed front",2048);
         const bool natural = Input("--natural","analytical nested-diss?",true);
         const bool sequential = Input
             ("--sequential","sequential partitions?",true);
@@ -246,6 +614,14 @@ int main( int argc, char* argv[] )
         const Int nbFact = Input("--nbFact","factorization blocksize",96);
         const Int nbSolve = Input("--nbSolve","solve blocksize",96);
         const Int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const double relaxedFill =
+          Input("--relaxedFill","max. fraction of zeros from amalgamation",0.);
+        const bool parallelTree =
+          Input("--parallelTree","process subtrees as tasks?",false);
+        const Int minTaskSize =
+          Input("--minTaskSize","min. number of variables of a task",1000);
+        const string spillFile =
+          Input("--spillFile","out-of-core front file (if any)",string(""));
         const bool unpack = Input("--unpack","unpack frontal matrix?",true);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
@@ -254,38 +630,55 @@ int main( int argc, char* argv[] )
 #endif
         ProcessInput();
 
+        ldl::MultifrontalCtrl frontCtrl;
+        frontCtrl.parallelTree = parallelTree;
+        frontCtrl.minTaskSize = minTaskSize;
+        frontCtrl.blr.tol = blrTol;
+        frontCtrl.blr.tileSize = blrTileSize;
+        frontCtrl.blr.minFrontSize = blrMinSize;
+
         BisectCtrl ctrl;
         ctrl.sequential = sequential;
         ctrl.numSeqSeps = numSeqSeps;
         ctrl.numDistSeps = numDistSeps;
         ctrl.cutoff = cutoff;
+        ctrl.relaxedFill = relaxedFill;
+
+        if( mpi::Rank(comm) == 0 )
+            TestChildOrdering( 5 );
 
         // TODO(poulson): Call complex variants as well
 
-        TestSparseDirect<float>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, cutoff, unpack, print, display, ctrl, comm );
-        TestSparseDirect<double>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, cutoff, unpack, print, display, ctrl, comm );
+        RunTests<float>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+          comm );
+        RunTests<double>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+          comm );
 #ifdef EL_HAVE_QD
-        TestSparseDirect<DoubleDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, cutoff, unpack, print, display, ctrl, comm );
-        TestSparseDirect<QuadDouble>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, cutoff, unpack, print, display, ctrl, comm );
+        RunTests<DoubleDouble>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+          comm );
+        RunTests<QuadDouble>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+          comm );
 #endif
 #ifdef EL_HAVE_QUAD
-        TestSparseDirect<Quad>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, cutoff, unpack, print, display, ctrl, comm );
+        RunTests<Quad>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+          comm );
 #endif
 #ifdef EL_HAVE_MPC
         mpfr::SetPrecision( prec );
-        TestSparseDirect<BigFloat>
-        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, nbFact, nbSolve,
-          natural, cutoff, unpack, print, display, ctrl, comm );
+        RunTests<BigFloat>
+        ( n1, n2, n3, numRHS, solve2d, selInv, intraPiv, blr, nbFact, nbSolve,
+          natural, cutoff, unpack, print, display, spillFile, frontCtrl, ctrl,
+          comm );
 #endif
     }
     catch( exception& e ) { ReportException(e); }
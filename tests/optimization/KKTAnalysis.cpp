@@ -0,0 +1,225 @@
+/*
+   Copyright (c) 2009-2016, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include <El.hpp>
+using namespace El;
+
+// Each problem in a sequence shares the sparsity pattern of its constraint
+// matrices but not their values:
+//
+//   min c^T x s.t. A x = b, G x + s = h, s in K,
+//
+// where A is m x n with n=2m, G=-I, h=0, and K is either the nonnegative
+// orthant or a product of second-order cones of order two. The primal
+// constraints are satisfied by x0=(2,1,2,1,...), which lies within the
+// interior of either cone, and the dual constraints by y0 and z0=x0.
+template<typename Real>
+Real Value( Int i, Int j, Int problem )
+{ return Real(1) + Real((3*i+5*j+7*problem)%11)/Real(10); }
+
+template<typename Real>
+Real PrimalValue( Int j ) { return j%2==0 ? Real(2) : Real(1); }
+
+template<typename Real>
+Real DualValue( Int i ) { return Real(i%5-2)/Real(4); }
+
+template<typename Real>
+void MakeProblem
+( Int n, Int problem,
+  SparseMatrix<Real>& A, SparseMatrix<Real>& G,
+  Matrix<Real>& b, Matrix<Real>& c, Matrix<Real>& h )
+{
+    const Int m = n/2;
+    Zeros( A, m, n );
+    A.Reserve( 3*m );
+    for( Int i=0; i<m; ++i )
+    {
+        A.QueueUpdate( i, i, Value<Real>(i,i,problem) );
+        A.QueueUpdate( i, i+m, Value<Real>(i,i+m,problem) );
+        const Int j = (7*i+3) % n;
+        A.QueueUpdate( i, j, Value<Real>(i,j,problem) );
+    }
+    A.ProcessQueues();
+    Identity( G, n, n );
+    G *= Real(-1);
+    Zeros( h, n, 1 );
+
+    Matrix<Real> x0, y0;
+    x0.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+        x0(j) = PrimalValue<Real>( j );
+    y0.Resize( m, 1 );
+    for( Int i=0; i<m; ++i )
+        y0(i) = DualValue<Real>( i );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = x0;
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+template<typename Real>
+void MakeProblem
+( Int n, Int problem,
+  DistSparseMatrix<Real>& A, DistSparseMatrix<Real>& G,
+  DistMultiVec<Real>& b, DistMultiVec<Real>& c, DistMultiVec<Real>& h )
+{
+    const Int m = n/2;
+    Zeros( A, m, n );
+    A.Reserve( 3*A.LocalHeight() );
+    for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+    {
+        const Int i = A.GlobalRow(iLoc);
+        A.QueueUpdate( i, i, Value<Real>(i,i,problem) );
+        A.QueueUpdate( i, i+m, Value<Real>(i,i+m,problem) );
+        const Int j = (7*i+3) % n;
+        A.QueueUpdate( i, j, Value<Real>(i,j,problem) );
+    }
+    A.ProcessQueues();
+    Identity( G, n, n );
+    G *= Real(-1);
+    Zeros( h, n, 1 );
+
+    DistMultiVec<Real> x0(A.Comm()), y0(A.Comm());
+    Zeros( x0, n, 1 );
+    for( Int jLoc=0; jLoc<x0.LocalHeight(); ++jLoc )
+        x0.SetLocal( jLoc, 0, PrimalValue<Real>(x0.GlobalRow(jLoc)) );
+    Zeros( y0, m, 1 );
+    for( Int iLoc=0; iLoc<y0.LocalHeight(); ++iLoc )
+        y0.SetLocal( iLoc, 0, DualValue<Real>(y0.GlobalRow(iLoc)) );
+    Zeros( b, m, 1 );
+    Multiply( NORMAL, Real(1), A, x0, Real(0), b );
+    c = x0;
+    Multiply( TRANSPOSE, Real(-1), A, y0, Real(1), c );
+}
+
+// The analysis only determines the ordering of the KKT systems, so the
+// iterates with a reused analysis should follow those with a fresh one
+template<typename Real,class Vector>
+void CheckAgreement
+( const string& name, Int problem, const Vector& x, const Vector& xReuse )
+{
+    const Real eps = limits::Epsilon<Real>();
+    Vector error( x );
+    error -= xReuse;
+    const Real relError = FrobeniusNorm( error ) / FrobeniusNorm( x );
+    if( relError > Pow(eps,Real(0.25)) )
+        LogicError
+        (name," solution ",problem," with a reused analysis differed from "
+         "that with a fresh one by a relative amount of ",relError);
+}
+
+template<typename Real>
+void TestSequential( Int n, Int numProblems, bool print )
+{
+    Output("Testing sequential solvers with ",TypeName<Real>());
+    PushIndent();
+    Matrix<Int> orders, firstInds;
+    orders.Resize( n, 1 );
+    firstInds.Resize( n, 1 );
+    for( Int j=0; j<n; ++j )
+    {
+        orders(j) = 2;
+        firstInds(j) = j - j%2;
+    }
+
+    KKTAnalysis lpAnalysis, socpAnalysis;
+    Graph lpPattern, socpPattern;
+    for( Int problem=0; problem<numProblems; ++problem )
+    {
+        SparseMatrix<Real> A, G;
+        Matrix<Real> b, c, h;
+        MakeProblem( n, problem, A, G, b, c, h );
+
+        lp::affine::Ctrl<Real> lpCtrl;
+        lpCtrl.mehrotraCtrl.print = print;
+        Matrix<Real> x, y, z, s, xReuse, yReuse, zReuse, sReuse;
+        LP( A, G, b, c, h, x, y, z, s, lpCtrl );
+        lpCtrl.mehrotraCtrl.kktAnalysis = &lpAnalysis;
+        LP( A, G, b, c, h, xReuse, yReuse, zReuse, sReuse, lpCtrl );
+        CheckAgreement<Real>( "LP", problem, x, xReuse );
+
+        socp::affine::Ctrl<Real> socpCtrl;
+        socpCtrl.mehrotraCtrl.print = print;
+        SOCP( A, G, b, c, h, orders, firstInds, x, y, z, s, socpCtrl );
+        socpCtrl.mehrotraCtrl.kktAnalysis = &socpAnalysis;
+        SOCP
+        ( A, G, b, c, h, orders, firstInds, xReuse, yReuse, zReuse, sReuse,
+          socpCtrl );
+        CheckAgreement<Real>( "SOCP", problem, x, xReuse );
+
+        // Every later problem should have left the first analysis in place
+        if( problem == 0 )
+        {
+            lpPattern = lpAnalysis.graph;
+            socpPattern = socpAnalysis.graph;
+        }
+        else if( lpAnalysis.Analyze(lpPattern) ||
+                 socpAnalysis.Analyze(socpPattern) )
+            LogicError("The KKT pattern of problem ",problem," was reanalyzed");
+    }
+    PopIndent();
+}
+
+template<typename Real>
+void TestDistributed( Int n, Int numProblems, bool print, mpi::Comm comm )
+{
+    OutputFromRoot(comm,"Testing distributed solvers with ",TypeName<Real>());
+    PushIndent();
+    DistKKTAnalysis analysis;
+    DistGraph pattern(comm);
+    for( Int problem=0; problem<numProblems; ++problem )
+    {
+        DistSparseMatrix<Real> A(comm), G(comm);
+        DistMultiVec<Real> b(comm), c(comm), h(comm);
+        MakeProblem( n, problem, A, G, b, c, h );
+
+        lp::affine::Ctrl<Real> ctrl;
+        ctrl.mehrotraCtrl.print = print;
+        DistMultiVec<Real> x(comm), y(comm), z(comm), s(comm),
+          xReuse(comm), yReuse(comm), zReuse(comm), sReuse(comm);
+        LP( A, G, b, c, h, x, y, z, s, ctrl );
+        ctrl.mehrotraCtrl.distKKTAnalysis = &analysis;
+        LP( A, G, b, c, h, xReuse, yReuse, zReuse, sReuse, ctrl );
+        CheckAgreement<Real>( "LP", problem, x, xReuse );
+
+        if( problem == 0 )
+            pattern = analysis.graph;
+        else if( analysis.Analyze(pattern) )
+            LogicError("The KKT pattern of problem ",problem," was reanalyzed");
+    }
+    PopIndent();
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Environment env( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+
+    try
+    {
+        const Int n = Input("--n","number of primal variables",200);
+        const Int numProblems =
+          Input("--numProblems","number of problems sharing a pattern",3);
+        const bool print = Input("--print","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( n < 2 || n % 2 != 0 )
+            LogicError("The number of primal variables must be even");
+        if( numProblems < 2 )
+            LogicError("At least two problems are required");
+
+        if( mpi::Rank(comm) == 0 )
+            TestSequential<double>( n, numProblems, print );
+        TestDistributed<double>( n, numProblems, print, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    return 0;
+}